@@ -10,6 +10,7 @@
 #include <sof/debug/panic.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
+#include <sof/lib/cache.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
 #include <sof/math/numbers.h>
@@ -899,10 +900,17 @@ static int asrc_reset(struct comp_dev *dev)
 	return 0;
 }
 
+static void asrc_writeback(struct comp_dev *dev)
+{
+	dcache_writeback_region(comp_get_drvdata(dev),
+				sizeof(struct comp_data));
+}
+
 static const struct comp_driver comp_asrc = {
 	.type = SOF_COMP_ASRC,
 	.uid = SOF_RT_UUID(asrc_uuid),
 	.tctx = &asrc_tr,
+	.mcps = 30,
 	.ops = {
 		.create = asrc_new,
 		.free = asrc_free,
@@ -912,6 +920,7 @@ static const struct comp_driver comp_asrc = {
 		.copy = asrc_copy,
 		.prepare = asrc_prepare,
 		.reset = asrc_reset,
+		.writeback = asrc_writeback,
 	},
 };
 
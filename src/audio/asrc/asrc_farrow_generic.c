@@ -8,105 +8,271 @@
 
 #include <sof/audio/asrc/asrc_farrow.h>
 #include <sof/audio/format.h>
+#include <sof/platform.h>
+
+/*
+ * The ring buffer holds frames of num_channels samples, so the filters
+ * apply each tap of the impulse response to all channels of a frame
+ * with consecutive loads. Like in the HiFi3 version every sample is
+ * written twice, half of the buffer apart, for a wrap free read of
+ * filter_length frames.
+ */
+void asrc_write_to_ring_buffer16(struct asrc_farrow *src_obj,
+				 int16_t **input_buffers, int index_input_frame)
+{
+	int nch = src_obj->num_channels;
+	int16_t *frame_j;
+	int16_t *frame_k;
+	int ch;
+	int m;
+
+	/* update the buffer_write_position */
+	(src_obj->buffer_write_position)++;
+
+	/* since it's a ring buffer we need a wrap around */
+	if (src_obj->buffer_write_position >= src_obj->buffer_length)
+		src_obj->buffer_write_position -= (src_obj->buffer_length >> 1);
+
+	/* handle input format */
+	if (src_obj->input_format == ASRC_IOF_INTERLEAVED)
+		m = nch * index_input_frame;
+	else
+		m = index_input_frame; /* For SRC_IOF_DEINTERLEAVED */
+
+	/* write the frame to both halves */
+	frame_j = &src_obj->ring_buffers16[0]
+		[src_obj->buffer_write_position * nch];
+	frame_k = frame_j - (src_obj->buffer_length >> 1) * nch;
+	for (ch = 0; ch < nch; ch++) {
+		frame_j[ch] = input_buffers[ch][m];
+		frame_k[ch] = input_buffers[ch][m];
+	}
+}
+
+void asrc_write_to_ring_buffer32(struct asrc_farrow *src_obj,
+				 int32_t **input_buffers, int index_input_frame)
+{
+	int nch = src_obj->num_channels;
+	int32_t *frame_j;
+	int32_t *frame_k;
+	int ch;
+	int m;
+
+	/* update the buffer_write_position */
+	(src_obj->buffer_write_position)++;
+
+	/* since it's a ring buffer we need a wrap around */
+	if (src_obj->buffer_write_position >= src_obj->buffer_length)
+		src_obj->buffer_write_position -= (src_obj->buffer_length >> 1);
+
+	/* handle input format */
+	if (src_obj->input_format == ASRC_IOF_INTERLEAVED)
+		m = nch * index_input_frame;
+	else
+		m = index_input_frame; /* For SRC_IOF_DEINTERLEAVED */
+
+	/* write the frame to both halves */
+	frame_j = &src_obj->ring_buffers32[0]
+		[src_obj->buffer_write_position * nch];
+	frame_k = frame_j - (src_obj->buffer_length >> 1) * nch;
+	for (ch = 0; ch < nch; ch++) {
+		frame_j[ch] = input_buffers[ch][m];
+		frame_k[ch] = input_buffers[ch][m];
+	}
+}
+
+/*
+ * Accumulates the taps for all channels of the frames, from the newest
+ * frame to the oldest. Inlined with a constant channel count the
+ * accumulators stay in registers and the channel loop maps to vector
+ * lanes. Even and odd taps go to separate accumulators, so each step
+ * works on two frames next to each other and even stereo fills the 64
+ * bit lanes of a 256 bit vector. The filter lengths are all even.
+ */
+static inline void asrc_fir_mac16(int64_t *prod, const int16_t *buffer_p,
+				  const int32_t *filter_p, int filter_length,
+				  const int nch)
+{
+	int64_t acc_even[PLATFORM_MAX_CHANNELS];
+	int64_t acc_odd[PLATFORM_MAX_CHANNELS];
+	int32_t coef_even;
+	int32_t coef_odd;
+	int ch;
+	int n;
+
+	for (ch = 0; ch < nch; ch++) {
+		acc_even[ch] = 0;
+		acc_odd[ch] = 0;
+	}
+
+	for (n = 0; n < filter_length; n += 2) {
+		coef_even = filter_p[0];
+		coef_odd = filter_p[1];
+		for (ch = 0; ch < nch; ch++) {
+			acc_even[ch] += (int64_t)buffer_p[ch] * coef_even;
+			acc_odd[ch] += (int64_t)buffer_p[ch - nch] * coef_odd;
+		}
+
+		filter_p += 2;
+		buffer_p -= 2 * nch;
+	}
+
+	for (ch = 0; ch < nch; ch++)
+		prod[ch] = acc_even[ch] + acc_odd[ch];
+}
+
+static inline void asrc_fir_mac32(int64_t *prod, const int32_t *buffer_p,
+				  const int32_t *filter_p, int filter_length,
+				  const int nch)
+{
+	int64_t acc_even[PLATFORM_MAX_CHANNELS];
+	int64_t acc_odd[PLATFORM_MAX_CHANNELS];
+	int32_t coef_even;
+	int32_t coef_odd;
+	int ch;
+	int n;
+
+	for (ch = 0; ch < nch; ch++) {
+		acc_even[ch] = 0;
+		acc_odd[ch] = 0;
+	}
+
+	for (n = 0; n < filter_length; n += 2) {
+		coef_even = filter_p[0] >> 8;
+		coef_odd = filter_p[1] >> 8;
+		for (ch = 0; ch < nch; ch++) {
+			acc_even[ch] += (int64_t)buffer_p[ch] * coef_even;
+			acc_odd[ch] += (int64_t)buffer_p[ch - nch] * coef_odd;
+		}
+
+		filter_p += 2;
+		buffer_p -= 2 * nch;
+	}
+
+	for (ch = 0; ch < nch; ch++)
+		prod[ch] = acc_even[ch] + acc_odd[ch];
+}
 
 void asrc_fir_filter16(struct asrc_farrow *src_obj, int16_t **output_buffers,
 		       int index_output_frame)
 {
-	int64_t prod;
+	int64_t prod[PLATFORM_MAX_CHANNELS];
 	int32_t prod32;
-	int16_t prod16;
-	int32_t *filter_p;
-	int16_t *buffer_p;
+	const int32_t *filter_p;
+	const int16_t *buffer_p;
+	int filter_length = src_obj->filter_length;
+	int nch = src_obj->num_channels;
 	int ch;
-	int n;
 	int i;
 
 	if (src_obj->output_format == ASRC_IOF_INTERLEAVED)
-		i = src_obj->num_channels * index_output_frame;
+		i = nch * index_output_frame;
 	else
 		i = index_output_frame;
 
-	/* Iterate over each channel */
-	for (ch = 0; ch < src_obj->num_channels; ch++) {
-		/* Pointer to the beginning of the impulse response */
-		filter_p = &src_obj->impulse_response[0];
-
-		/* Pointer to the buffered input data */
-		buffer_p = &src_obj->ring_buffers16[ch]
-			[src_obj->buffer_write_position];
+	/* Pointer to the beginning of the impulse response */
+	filter_p = &src_obj->impulse_response[0];
 
-		/* Initialise the accumulator */
-		prod = 0;
+	/* Pointer to the newest buffered frame */
+	buffer_p = &src_obj->ring_buffers16[0]
+		[src_obj->buffer_write_position * nch];
 
-		/* Iterate over the filter bins.
-		 * Data is Q1.15, coefficients are Q1.30. Prod will be Qx.45.
-		 */
-		for (n = 0; n < src_obj->filter_length; n++)
-			prod += (int64_t)(*buffer_p--) * (*filter_p++);
+	/* Iterate over the filter bins. Data is Q1.15, coefficients
+	 * are Q1.30. Prod will be Qx.45.
+	 */
+	switch (nch) {
+	case 1:
+		asrc_fir_mac16(prod, buffer_p, filter_p, filter_length, 1);
+		break;
+	case 2:
+		asrc_fir_mac16(prod, buffer_p, filter_p, filter_length, 2);
+		break;
+	case 4:
+		asrc_fir_mac16(prod, buffer_p, filter_p, filter_length, 4);
+		break;
+	case 6:
+		asrc_fir_mac16(prod, buffer_p, filter_p, filter_length, 6);
+		break;
+	case 8:
+		asrc_fir_mac16(prod, buffer_p, filter_p, filter_length, 8);
+		break;
+	default:
+		asrc_fir_mac16(prod, buffer_p, filter_p, filter_length, nch);
+		break;
+	}
 
+	for (ch = 0; ch < nch; ch++) {
 		/* Shift left after accumulation, because interim
 		 * results might saturate during filtering prod = prod
 		 * << 1; will shift after last addition
 		 */
-		prod32 = sat_int32(Q_SHIFT(prod, 45, 31));
+		prod32 = sat_int32(Q_SHIFT(prod[ch], 45, 31));
 
 		/* Round 'prod' to 16 bit and store it in
 		 * (de-)interleaved format in the output buffers
 		 */
-		prod16 = sat_int16(Q_SHIFT_RND(prod32, 31, 15));
-		output_buffers[ch][i] = prod16;
+		output_buffers[ch][i] = sat_int16(Q_SHIFT_RND(prod32, 31, 15));
 	}
 }
 
 void asrc_fir_filter32(struct asrc_farrow *src_obj, int32_t **output_buffers,
 		       int index_output_frame)
 {
-	int64_t prod;
-	int32_t prod32;
+	int64_t prod[PLATFORM_MAX_CHANNELS];
 	const int32_t *filter_p;
-	int32_t *buffer_p;
+	const int32_t *buffer_p;
+	int filter_length = src_obj->filter_length;
+	int nch = src_obj->num_channels;
 	int ch;
-	int n;
 	int i;
 
 	if (src_obj->output_format == ASRC_IOF_INTERLEAVED)
-		i = src_obj->num_channels * index_output_frame;
+		i = nch * index_output_frame;
 	else
 		i = index_output_frame;
 
-	/* Iterate over each channel */
-	for (ch = 0; ch < src_obj->num_channels; ch++) {
-		/* Pointer to the beginning of the impulse response */
-		filter_p = &src_obj->impulse_response[0];
-
-		/* Pointer to the buffered input data */
-		buffer_p = &src_obj->ring_buffers32[ch]
-			[src_obj->buffer_write_position];
-
-		/* Initialise the accumulator */
-		prod = 0;
+	/* Pointer to the beginning of the impulse response */
+	filter_p = &src_obj->impulse_response[0];
 
-		/* Iterate over the filter bins. Data is Q1.31, coefficients
-		 * are Q1.22. They are down scaled by 1 shift. In addition
-		 * there C is implementation specific right shift by 8. It
-		 * gives headroom to calculate up to 256 taps FIR. The use
-		 * of 24 bits of 32 bits is not a practical limitation for
-		 * quality. The product is Qx.54.
-		 */
-		for (n = 0; n < src_obj->filter_length; n++)
-			prod += (int64_t)(*buffer_p--) * (*filter_p++ >> 8);
-
-		/* Shift left after accumulation, because interim
-		 * results might saturate during filtering prod = prod
-		 * << 1; will shift after last addition
-		 */
-		prod32 = sat_int32(Q_SHIFT(prod, 53, 31));
+	/* Pointer to the newest buffered frame */
+	buffer_p = &src_obj->ring_buffers32[0]
+		[src_obj->buffer_write_position * nch];
 
-		/* Store 'prod' in (de-)interleaved format in the output
-		 * buffers
-		 */
-		output_buffers[ch][i] = prod32;
+	/* Iterate over the filter bins. Data is Q1.31, coefficients
+	 * are Q1.22. They are down scaled by 1 shift. In addition
+	 * there C is implementation specific right shift by 8. It
+	 * gives headroom to calculate up to 256 taps FIR. The use
+	 * of 24 bits of 32 bits is not a practical limitation for
+	 * quality. The product is Qx.54.
+	 */
+	switch (nch) {
+	case 1:
+		asrc_fir_mac32(prod, buffer_p, filter_p, filter_length, 1);
+		break;
+	case 2:
+		asrc_fir_mac32(prod, buffer_p, filter_p, filter_length, 2);
+		break;
+	case 4:
+		asrc_fir_mac32(prod, buffer_p, filter_p, filter_length, 4);
+		break;
+	case 6:
+		asrc_fir_mac32(prod, buffer_p, filter_p, filter_length, 6);
+		break;
+	case 8:
+		asrc_fir_mac32(prod, buffer_p, filter_p, filter_length, 8);
+		break;
+	default:
+		asrc_fir_mac32(prod, buffer_p, filter_p, filter_length, nch);
+		break;
 	}
+
+	/* Shift left after accumulation, because interim results
+	 * might saturate during filtering prod = prod << 1; will
+	 * shift after last addition. Store in (de-)interleaved
+	 * format in the output buffers.
+	 */
+	for (ch = 0; ch < nch; ch++)
+		output_buffers[ch][i] = sat_int32(Q_SHIFT(prod[ch], 53, 31));
 }
 
 /* + ALGORITHM SPECIFIC FUNCTIONS */
@@ -9,6 +9,90 @@
 
 #include <xtensa/tie/xt_hifi3.h>
 
+void asrc_write_to_ring_buffer16(struct asrc_farrow  *src_obj,
+				 int16_t **input_buffers, int index_input_frame)
+{
+	int ch;
+	int j;
+	int k;
+	int m;
+
+	/* update the buffer_write_position */
+	(src_obj->buffer_write_position)++;
+
+	/* since it's a ring buffer we need a wrap around */
+	if (src_obj->buffer_write_position >= src_obj->buffer_length)
+		src_obj->buffer_write_position -= (src_obj->buffer_length >> 1);
+
+	/* handle input format */
+	if (src_obj->input_format == ASRC_IOF_INTERLEAVED)
+		m = src_obj->num_channels * index_input_frame;
+	else
+		m = index_input_frame; /* For SRC_IOF_DEINTERLEAVED */
+
+	/* write data to each channel */
+	j = src_obj->buffer_write_position;
+	k = j - (src_obj->buffer_length >> 1);
+	for (ch = 0; ch < src_obj->num_channels; ch++) {
+		/*
+		 * Since we want the filter function to load 64 bit of
+		 * buffer data in one cycle, this function writes each
+		 * input sample to the buffer twice, one with an
+		 * offset of half the buffer size. This way we don't
+		 * need a wrap around while loading #filter_length of
+		 * buffered samples. The upper and lower half of the
+		 * buffer are redundant. If the memory tradeoff is
+		 * critical, the buffer can be reduced to half the
+		 * size but therefore increased filter operations have
+		 * to be expected.
+		 */
+		src_obj->ring_buffers16[ch][j] = input_buffers[ch][m];
+		src_obj->ring_buffers16[ch][k] = input_buffers[ch][m];
+	}
+}
+
+void asrc_write_to_ring_buffer32(struct asrc_farrow  *src_obj,
+				 int32_t **input_buffers, int index_input_frame)
+{
+	int ch;
+	int j;
+	int k;
+	int m;
+
+	/* update the buffer_write_position */
+	(src_obj->buffer_write_position)++;
+
+	/* since it's a ring buffer we need a wrap around */
+	if (src_obj->buffer_write_position >= src_obj->buffer_length)
+		src_obj->buffer_write_position -= (src_obj->buffer_length >> 1);
+
+	/* handle input format */
+	if (src_obj->input_format == ASRC_IOF_INTERLEAVED)
+		m = src_obj->num_channels * index_input_frame;
+	else
+		m = index_input_frame; /* For SRC_IOF_DEINTERLEAVED */
+
+	/* write data to each channel */
+	j = src_obj->buffer_write_position;
+	k = j - (src_obj->buffer_length >> 1);
+	for (ch = 0; ch < src_obj->num_channels; ch++) {
+		/*
+		 * Since we want the filter function to load 64 bit of
+		 * buffer data in one cycle, this function writes each
+		 * input sample to the buffer twice, one with an
+		 * offset of half the buffer size. This way we don't
+		 * need a wrap around while loading #filter_length of
+		 * buffered samples. The upper and lower half of the
+		 * buffer are redundant. If the memory tradeoff is
+		 * critical, the buffer can be reduced to half the
+		 * size but therefore increased filter operations have
+		 * to be expected.
+		 */
+		src_obj->ring_buffers32[ch][j] = input_buffers[ch][m];
+		src_obj->ring_buffers32[ch][k] = input_buffers[ch][m];
+	}
+}
+
 void asrc_fir_filter16(struct asrc_farrow *src_obj, int16_t **output_buffers,
 		       int index_output_frame)
 {
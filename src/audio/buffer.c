@@ -16,6 +16,7 @@
 #include <sof/spinlock.h>
 #include <ipc/topology.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -102,6 +103,7 @@ struct comp_buffer *buffer_new(struct sof_ipc_buffer *desc)
 int buffer_set_size(struct comp_buffer *buffer, uint32_t size)
 {
 	void *new_ptr = NULL;
+	int ret;
 
 	/* validate request */
 	if (size == 0 || size > HEAP_BUFFER_SIZE) {
@@ -109,6 +111,20 @@ int buffer_set_size(struct comp_buffer *buffer, uint32_t size)
 		return -EINVAL;
 	}
 
+	if (size == buffer->stream.size)
+		return 0;
+
+	/* a resized data area can't be shared for in-place processing */
+	if (buffer->alias_sink) {
+		ret = buffer_unalias(buffer->alias_sink);
+		if (ret < 0)
+			return ret;
+	}
+
+	ret = buffer_unalias(buffer);
+	if (ret < 0)
+		return ret;
+
 	if (size == buffer->stream.size)
 		return 0;
 
@@ -148,19 +164,148 @@ void buffer_free(struct comp_buffer *buffer)
 
 	list_item_del(&buffer->source_list);
 	list_item_del(&buffer->sink_list);
-	rfree(buffer->stream.addr);
+
+	/* the data area belongs to the head of alias chain, it's passed to
+	 * the next buffer of the chain if there's one
+	 */
+	if (buffer->alias_sink)
+		buffer->alias_sink->alias_src = buffer->alias_src;
+	if (buffer->alias_src)
+		buffer->alias_src->alias_sink = buffer->alias_sink;
+	else if (!buffer->alias_sink)
+		rfree(buffer->stream.addr);
+
 	rfree(buffer->lock);
 	rfree(buffer);
 }
 
-void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
+/* point the buffers aliasing this one to its data area */
+static void buffer_alias_sync(struct comp_buffer *buffer)
+{
+	struct comp_buffer *alias;
+
+	for (alias = buffer->alias_sink; alias; alias = alias->alias_sink) {
+		alias->stream.addr = buffer->stream.addr;
+		buffer_init(alias, buffer->stream.size, alias->caps);
+	}
+}
+
+/* Make the buffer use the data area of source buffer for in-place
+ * processing by the component between them. The own data area of the
+ * buffer is released until buffer_unalias().
+ */
+int buffer_alias(struct comp_buffer *buffer, struct comp_buffer *source)
+{
+	if (buffer->alias_src == source)
+		return 0;
+
+	if (source->alias_sink || buffer->inter_core || source->inter_core) {
+		buf_err(buffer, "buffer_alias(): can't alias buffer %u",
+			source->id);
+		return -EINVAL;
+	}
+
+	if (buffer->alias_src) {
+		buffer->alias_src->alias_sink = NULL;
+	} else {
+		buffer->alias_size = buffer->stream.size;
+		rfree(buffer->stream.addr);
+	}
+
+	buffer->alias_src = source;
+	source->alias_sink = buffer;
+
+	buffer->stream.addr = source->stream.addr;
+	buffer_init(buffer, source->stream.size, buffer->caps);
+	buffer_alias_sync(buffer);
+
+	buf_info(buffer, "buffer_alias(), data area of buffer %u",
+		 source->id);
+
+	return 0;
+}
+
+/* give the buffer its own data area back */
+int buffer_unalias(struct comp_buffer *buffer)
+{
+	void *addr;
+
+	if (!buffer->alias_src)
+		return 0;
+
+	addr = rballoc_align(0, buffer->caps, buffer->alias_size,
+			     PLATFORM_DCACHE_ALIGN);
+	if (!addr) {
+		buf_err(buffer, "buffer_unalias(): could not alloc size = %u bytes of type = %u",
+			buffer->alias_size, buffer->caps);
+		return -ENOMEM;
+	}
+
+	buffer->alias_src->alias_sink = NULL;
+	buffer->alias_src = NULL;
+
+	buffer->stream.addr = addr;
+	buffer_init(buffer, buffer->alias_size, buffer->caps);
+	buffer_alias_sync(buffer);
+
+	return 0;
+}
+
+/* The writer of the alias chain head must not overwrite the data still
+ * held by the buffers aliasing it, so the head keeps their total in use.
+ */
+static void buffer_alias_update(struct comp_buffer *buffer)
+{
+	struct comp_buffer *head = buffer;
+	uint32_t held = 0;
+
+	while (head->alias_src)
+		head = head->alias_src;
+
+	for (buffer = head->alias_sink; buffer; buffer = buffer->alias_sink)
+		held += audio_stream_used_bytes(&buffer->stream);
+
+	head->stream.held = held;
+}
+
+/* Lock free buffers write back only the position cache line of the
+ * calling side, the line of the other side may hold an update the other
+ * core made meanwhile.
+ */
+static void buffer_position_writeback(struct comp_buffer *buffer,
+				      bool producer)
+{
+	struct audio_stream *stream = &buffer->stream;
+
+	if (producer)
+		dcache_writeback_region(&stream->w_ptr,
+					offsetof(struct audio_stream, r_ptr) -
+					offsetof(struct audio_stream, w_ptr));
+	else
+		dcache_writeback_region(&stream->r_ptr, sizeof(*stream) -
+					offsetof(struct audio_stream, r_ptr));
+}
+
+/* sends transaction event, called only if someone enabled this type */
+static void buffer_notify_transact(struct comp_buffer *buffer,
+				   enum notify_id type, void *begin,
+				   uint32_t bytes)
 {
-	uint32_t flags = 0;
 	struct buffer_cb_transact cb_data = {
 		.buffer = buffer,
 		.transaction_amount = bytes,
-		.transaction_begin_address = buffer->stream.w_ptr,
+		.transaction_begin_address = begin,
 	};
+
+	notifier_event(buffer, type, NOTIFIER_TARGET_CORE_LOCAL,
+		       &cb_data, sizeof(cb_data));
+}
+
+void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
+{
+	uint32_t flags = 0;
+	bool lock_free;
+	void *begin;
 	char *addr;
 
 	/* return if no bytes */
@@ -173,14 +318,25 @@ void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
 		return;
 	}
 
-	buffer_lock(buffer, &flags);
+	lock_free = buffer_is_lock_free(buffer);
+	if (!lock_free)
+		buffer_lock(buffer, &flags);
+
+	begin = buffer->stream.w_ptr;
 
 	audio_stream_produce(&buffer->stream, bytes);
 
-	notifier_event(buffer, NOTIFIER_ID_BUFFER_PRODUCE,
-		       NOTIFIER_TARGET_CORE_LOCAL, &cb_data, sizeof(cb_data));
+	if (buffer->alias_src || buffer->alias_sink)
+		buffer_alias_update(buffer);
 
-	buffer_unlock(buffer, flags);
+	if (buffer->cb_type & BUFF_CB_TYPE_PRODUCE)
+		buffer_notify_transact(buffer, NOTIFIER_ID_BUFFER_PRODUCE,
+				       begin, bytes);
+
+	if (lock_free)
+		buffer_position_writeback(buffer, true);
+	else
+		buffer_unlock(buffer, flags);
 
 	addr = buffer->stream.addr;
 
@@ -196,11 +352,8 @@ void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
 void comp_update_buffer_consume(struct comp_buffer *buffer, uint32_t bytes)
 {
 	uint32_t flags = 0;
-	struct buffer_cb_transact cb_data = {
-		.buffer = buffer,
-		.transaction_amount = bytes,
-		.transaction_begin_address = buffer->stream.r_ptr,
-	};
+	bool lock_free;
+	void *begin;
 	char *addr;
 
 	/* return if no bytes */
@@ -213,14 +366,25 @@ void comp_update_buffer_consume(struct comp_buffer *buffer, uint32_t bytes)
 		return;
 	}
 
-	buffer_lock(buffer, &flags);
+	lock_free = buffer_is_lock_free(buffer);
+	if (!lock_free)
+		buffer_lock(buffer, &flags);
+
+	begin = buffer->stream.r_ptr;
 
 	audio_stream_consume(&buffer->stream, bytes);
 
-	notifier_event(buffer, NOTIFIER_ID_BUFFER_CONSUME,
-		       NOTIFIER_TARGET_CORE_LOCAL, &cb_data, sizeof(cb_data));
+	if (buffer->alias_src || buffer->alias_sink)
+		buffer_alias_update(buffer);
+
+	if (buffer->cb_type & BUFF_CB_TYPE_CONSUME)
+		buffer_notify_transact(buffer, NOTIFIER_ID_BUFFER_CONSUME,
+				       begin, bytes);
 
-	buffer_unlock(buffer, flags);
+	if (lock_free)
+		buffer_position_writeback(buffer, false);
+	else
+		buffer_unlock(buffer, flags);
 
 	addr = buffer->stream.addr;
 
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+/* component copy profiling, used by testbench and other host builds */
+
+#include <sof/audio/buffer.h>
+#include <sof/audio/comp_profile.h>
+#include <sof/audio/component.h>
+#include <sof/list.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+bool comp_profile_enabled;
+
+static uint64_t comp_profile_time(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* host cycle counter, nanoseconds where there is none */
+static uint64_t comp_profile_cycles(uint64_t time)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();
+#else
+	return time;
+#endif
+}
+
+/* histogram index of value, 8 buckets per power of two */
+static uint32_t comp_profile_bucket(uint64_t value)
+{
+	uint32_t msb;
+	uint32_t index;
+
+	if (value < (1 << COMP_PROFILE_HIST_SHIFT))
+		return value;
+
+	msb = 63 - __builtin_clzll(value);
+	index = ((msb - COMP_PROFILE_HIST_SHIFT + 1) << COMP_PROFILE_HIST_SHIFT) +
+		((value >> (msb - COMP_PROFILE_HIST_SHIFT)) &
+		 ((1 << COMP_PROFILE_HIST_SHIFT) - 1));
+
+	return MIN(index, COMP_PROFILE_HIST_SIZE - 1);
+}
+
+/* smallest value falling into given histogram bucket */
+static uint64_t comp_profile_bucket_value(uint32_t index)
+{
+	uint32_t sub = index & ((1 << COMP_PROFILE_HIST_SHIFT) - 1);
+	uint32_t exp = index >> COMP_PROFILE_HIST_SHIFT;
+
+	if (!exp)
+		return index;
+
+	return (uint64_t)((1 << COMP_PROFILE_HIST_SHIFT) + sub) << (exp - 1);
+}
+
+void comp_profile_stamp_begin(struct comp_dev *dev,
+			      struct comp_profile_stamp *stamp)
+{
+	struct comp_buffer *buffer;
+
+	stamp->sink_avail = 0;
+	stamp->source_avail = 0;
+
+	if (!list_is_empty(&dev->bsink_list)) {
+		buffer = list_first_item(&dev->bsink_list, struct comp_buffer,
+					 source_list);
+		stamp->sink_avail =
+			audio_stream_get_avail_bytes(&buffer->stream);
+	}
+
+	if (!list_is_empty(&dev->bsource_list)) {
+		buffer = list_first_item(&dev->bsource_list,
+					 struct comp_buffer, sink_list);
+		stamp->source_avail =
+			audio_stream_get_avail_bytes(&buffer->stream);
+	}
+
+	stamp->time = comp_profile_time();
+	stamp->cycles = comp_profile_cycles(stamp->time);
+}
+
+/* adds single copy time to the statistics */
+static void comp_profile_add(struct comp_profile *prof, uint64_t time,
+			     uint64_t cycles)
+{
+	if (!prof->count || time < prof->time_min)
+		prof->time_min = time;
+	if (time > prof->time_max)
+		prof->time_max = time;
+
+	prof->count++;
+	prof->time_sum += time;
+	prof->cycles_sum += cycles;
+	prof->hist[comp_profile_bucket(time)]++;
+}
+
+void comp_profile_stamp_end(struct comp_dev *dev,
+			    struct comp_profile_stamp *stamp)
+{
+	struct comp_profile *prof = &dev->profile;
+	struct comp_buffer *buffer;
+	uint64_t time = comp_profile_time();
+	uint64_t cycles = comp_profile_cycles(time);
+	uint32_t avail;
+
+	comp_profile_add(prof, time - stamp->time, cycles - stamp->cycles);
+
+	/* frames produced into the first sink, consumed from the first
+	 * source if there is no sink, e.g. for endpoints
+	 */
+	if (!list_is_empty(&dev->bsink_list)) {
+		buffer = list_first_item(&dev->bsink_list, struct comp_buffer,
+					 source_list);
+		avail = audio_stream_get_avail_bytes(&buffer->stream);
+		if (avail > stamp->sink_avail)
+			prof->frames += (avail - stamp->sink_avail) /
+				audio_stream_frame_bytes(&buffer->stream);
+		prof->rate = buffer->stream.rate;
+	} else if (!list_is_empty(&dev->bsource_list)) {
+		buffer = list_first_item(&dev->bsource_list,
+					 struct comp_buffer, sink_list);
+		avail = audio_stream_get_avail_bytes(&buffer->stream);
+		if (avail < stamp->source_avail)
+			prof->frames += (stamp->source_avail - avail) /
+				audio_stream_frame_bytes(&buffer->stream);
+		prof->rate = buffer->stream.rate;
+	}
+}
+
+/* same arithmetic pauses and resumes: elapsed time <-> moved start */
+void comp_profile_stamp_toggle(struct comp_profile_stamp *stamp)
+{
+	uint64_t time = comp_profile_time();
+
+	stamp->cycles = comp_profile_cycles(time) - stamp->cycles;
+	stamp->time = time - stamp->time;
+}
+
+void comp_profile_stamp_end_paused(struct comp_dev *dev,
+				   struct comp_profile_stamp *stamp,
+				   uint32_t frames, uint32_t rate)
+{
+	struct comp_profile *prof = &dev->profile;
+
+	comp_profile_add(prof, stamp->time, stamp->cycles);
+
+	prof->frames += frames;
+	prof->rate = rate;
+}
+
+uint64_t comp_profile_percentile(const struct comp_profile *prof,
+				 uint32_t pct)
+{
+	uint64_t target = (prof->count * pct + 99) / 100;
+	uint64_t sum = 0;
+	uint64_t low;
+	uint64_t high;
+	int i;
+
+	if (!prof->count)
+		return 0;
+
+	for (i = 0; i < COMP_PROFILE_HIST_SIZE; i++) {
+		sum += prof->hist[i];
+		if (sum >= target && sum)
+			break;
+	}
+
+	/* middle of the bucket, clamped to measured range */
+	low = comp_profile_bucket_value(i);
+	high = i < COMP_PROFILE_HIST_SIZE - 1 ?
+		comp_profile_bucket_value(i + 1) : prof->time_max;
+	low = (low + high) / 2;
+
+	return MIN(MAX(low, prof->time_min), prof->time_max);
+}
+
+double comp_profile_mcps(const struct comp_profile *prof)
+{
+	if (!prof->frames || !prof->rate)
+		return 0;
+
+	return (double)prof->cycles_sum * prof->rate / prof->frames / 1e6;
+}
@@ -664,6 +664,22 @@ void comp_data_blob_handler_free(struct comp_data_blob_handler *blob_handler)
 	rfree(blob_handler);
 }
 
+void comp_data_blob_writeback(struct comp_data_blob_handler *blob_handler)
+{
+	if (!blob_handler)
+		return;
+
+	if (blob_handler->data)
+		dcache_writeback_region(blob_handler->data,
+					blob_handler->data_size);
+
+	if (blob_handler->data_new)
+		dcache_writeback_region(blob_handler->data_new,
+					blob_handler->data_size);
+
+	dcache_writeback_region(blob_handler, sizeof(*blob_handler));
+}
+
 struct comp_dev *comp_make_shared(struct comp_dev *dev)
 {
 	struct list_item *old_bsource_list = &dev->bsource_list;
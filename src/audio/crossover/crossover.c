@@ -14,6 +14,7 @@
 #include <sof/debug/panic.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
+#include <sof/lib/cache.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
 #include <sof/list.h>
@@ -847,10 +848,29 @@ static int crossover_reset(struct comp_dev *dev)
 	return 0;
 }
 
+/**
+ * \brief Writes back Crossover Filter private data and setup blobs before
+ *	  moving to another core.
+ * \param[in,out] dev Crossover Filter base component device.
+ */
+static void crossover_writeback(struct comp_dev *dev)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+
+	if (cd->config)
+		dcache_writeback_region(cd->config, cd->config->size);
+
+	if (cd->config_new)
+		dcache_writeback_region(cd->config_new, cd->config_new->size);
+
+	dcache_writeback_region(cd, sizeof(*cd));
+}
+
 /** \brief Crossover Filter component definition. */
 static const struct comp_driver comp_crossover = {
 	.uid	= SOF_RT_UUID(crossover_uuid),
 	.tctx	= &crossover_tr,
+	.mcps	= 8,
 	.ops	= {
 		.create		= crossover_new,
 		.free		= crossover_free,
@@ -860,6 +880,7 @@ static const struct comp_driver comp_crossover = {
 		.copy		= crossover_copy,
 		.prepare	= crossover_prepare,
 		.reset		= crossover_reset,
+		.writeback	= crossover_writeback,
 	},
 };
 
@@ -21,11 +21,11 @@
  */
 static inline void crossover_generic_lr4_split(struct iir_state_df2t *lp,
 					       struct iir_state_df2t *hp,
-					       int32_t x, int32_t *y1,
-					       int32_t *y2)
+					       const int32_t x[], int32_t y1[],
+					       int32_t y2[], int frames)
 {
-	*y1 = crossover_generic_process_lr4(x, lp);
-	*y2 = crossover_generic_process_lr4(x, hp);
+	crossover_generic_process_lr4(x, y1, lp, frames);
+	crossover_generic_process_lr4(x, y2, hp, frames);
 }
 
 /*
@@ -39,50 +39,58 @@ static inline void crossover_generic_lr4_split(struct iir_state_df2t *lp,
  */
 static inline void crossover_generic_lr4_merge(struct iir_state_df2t *lp,
 					       struct iir_state_df2t *hp,
-					       int32_t x, int32_t *y)
+					       const int32_t x[], int32_t y[],
+					       int frames)
 {
-	int32_t z1, z2;
+	int32_t z[CROSSOVER_BLOCK_FRAMES];
+	int i;
 
-	z1 = crossover_generic_process_lr4(x, lp);
-	z2 = crossover_generic_process_lr4(x, hp);
-	*y = sat_int32(((int64_t)z1) + z2);
+	crossover_generic_process_lr4(x, z, lp, frames);
+	crossover_generic_process_lr4(x, y, hp, frames);
+	for (i = 0; i < frames; i++)
+		y[i] = sat_int32(((int64_t)z[i]) + y[i]);
 }
 
-static void crossover_generic_split_2way(int32_t in,
-					 int32_t out[],
-					 struct crossover_state *state)
+static void crossover_generic_split_2way(const int32_t in[],
+					 int32_t *out[],
+					 struct crossover_state *state,
+					 int frames)
 {
 	crossover_generic_lr4_split(&state->lowpass[0], &state->highpass[0],
-				    in, &out[0], &out[1]);
+				    in, out[0], out[1], frames);
 }
 
-static void crossover_generic_split_3way(int32_t in,
-					 int32_t out[],
-					 struct crossover_state *state)
+static void crossover_generic_split_3way(const int32_t in[],
+					 int32_t *out[],
+					 struct crossover_state *state,
+					 int frames)
 {
-	int32_t z1, z2;
+	int32_t z1[CROSSOVER_BLOCK_FRAMES];
+	int32_t z2[CROSSOVER_BLOCK_FRAMES];
 
 	crossover_generic_lr4_split(&state->lowpass[0], &state->highpass[0],
-				    in, &z1, &z2);
+				    in, z1, z2, frames);
 	/* Realign the phase of z1 */
 	crossover_generic_lr4_merge(&state->lowpass[1], &state->highpass[1],
-				    z1, &out[0]);
+				    z1, out[0], frames);
 	crossover_generic_lr4_split(&state->lowpass[2], &state->highpass[2],
-				    z2, &out[1], &out[2]);
+				    z2, out[1], out[2], frames);
 }
 
-static void crossover_generic_split_4way(int32_t in,
-					 int32_t out[],
-					 struct crossover_state *state)
+static void crossover_generic_split_4way(const int32_t in[],
+					 int32_t *out[],
+					 struct crossover_state *state,
+					 int frames)
 {
-	int32_t z1, z2;
+	int32_t z1[CROSSOVER_BLOCK_FRAMES];
+	int32_t z2[CROSSOVER_BLOCK_FRAMES];
 
 	crossover_generic_lr4_split(&state->lowpass[1], &state->highpass[1],
-				    in, &z1, &z2);
+				    in, z1, z2, frames);
 	crossover_generic_lr4_split(&state->lowpass[0], &state->highpass[0],
-				    z1, &out[0], &out[1]);
+				    z1, out[0], out[1], frames);
 	crossover_generic_lr4_split(&state->lowpass[2], &state->highpass[2],
-				    z2, &out[2], &out[3]);
+				    z2, out[2], out[3], frames);
 }
 
 #if CONFIG_FORMAT_S16LE
@@ -135,6 +143,23 @@ static void crossover_s32_default_pass(const struct comp_dev *dev,
 #endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
 
 #if CONFIG_FORMAT_S16LE
+/* Stores a block of one channel to a connected sink, Q1.31 to Q1.15 */
+static inline void crossover_store_s16(struct comp_buffer *sink,
+				       const int32_t out[], int idx, int nch,
+				       int frames)
+{
+	int16_t *y;
+	int k;
+
+	if (!sink)
+		return;
+
+	for (k = 0; k < frames; k++) {
+		y = audio_stream_read_frag_s16(&sink->stream, idx + k * nch);
+		*y = sat_int16(Q_SHIFT_RND(out[k], 31, 15));
+	}
+}
+
 static void crossover_s16_default(const struct comp_dev *dev,
 				  const struct comp_buffer *source,
 				  struct comp_buffer *sinks[],
@@ -144,36 +169,56 @@ static void crossover_s16_default(const struct comp_dev *dev,
 	struct comp_data *cd = comp_get_drvdata(dev);
 	struct crossover_state *state;
 	const struct audio_stream *source_stream = &source->stream;
-	struct audio_stream *sink_stream;
-	int16_t *x, *y;
-	int ch, i, j;
-	int idx = 0;
+	int32_t in[CROSSOVER_BLOCK_FRAMES];
+	int32_t out[CROSSOVER_4WAY_NUM_SINKS][CROSSOVER_BLOCK_FRAMES];
+	int32_t *outp[CROSSOVER_4WAY_NUM_SINKS];
+	int16_t *x;
+	int ch, i, j, k, n;
+	int idx;
 	int nch = source_stream->channels;
-	int32_t out[num_sinks];
+
+	for (j = 0; j < num_sinks; j++)
+		outp[j] = out[j];
 
 	for (ch = 0; ch < nch; ch++) {
-		idx = ch;
 		state = &cd->state[ch];
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s16(source_stream, idx);
-			cd->crossover_split(*x << 16, out, state);
-
-			for (j = 0; j < num_sinks; j++) {
-				if (!sinks[j])
-					continue;
-				sink_stream = &sinks[j]->stream;
-				y = audio_stream_read_frag_s16(sink_stream,
-							       idx);
-				*y = sat_int16(Q_SHIFT_RND(out[j], 31, 15));
+		for (i = 0; i < frames; i += n) {
+			n = MIN(frames - i, CROSSOVER_BLOCK_FRAMES);
+			idx = i * nch + ch;
+			for (k = 0; k < n; k++) {
+				x = audio_stream_read_frag_s16(source_stream,
+							       idx + k * nch);
+				in[k] = *x << 16;
 			}
 
-			idx += nch;
+			cd->crossover_split(in, outp, state, n);
+
+			for (j = 0; j < num_sinks; j++)
+				crossover_store_s16(sinks[j], out[j], idx, nch,
+						    n);
 		}
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE */
 
 #if CONFIG_FORMAT_S24LE
+/* Stores a block of one channel to a connected sink, Q1.31 to Q1.23 */
+static inline void crossover_store_s24(struct comp_buffer *sink,
+				       const int32_t out[], int idx, int nch,
+				       int frames)
+{
+	int32_t *y;
+	int k;
+
+	if (!sink)
+		return;
+
+	for (k = 0; k < frames; k++) {
+		y = audio_stream_read_frag_s32(&sink->stream, idx + k * nch);
+		*y = sat_int24(Q_SHIFT_RND(out[k], 31, 23));
+	}
+}
+
 static void crossover_s24_default(const struct comp_dev *dev,
 				  const struct comp_buffer *source,
 				  struct comp_buffer *sinks[],
@@ -183,36 +228,56 @@ static void crossover_s24_default(const struct comp_dev *dev,
 	struct comp_data *cd = comp_get_drvdata(dev);
 	struct crossover_state *state;
 	const struct audio_stream *source_stream = &source->stream;
-	struct audio_stream *sink_stream;
-	int32_t *x, *y;
-	int ch, i, j;
-	int idx = 0;
+	int32_t in[CROSSOVER_BLOCK_FRAMES];
+	int32_t out[CROSSOVER_4WAY_NUM_SINKS][CROSSOVER_BLOCK_FRAMES];
+	int32_t *outp[CROSSOVER_4WAY_NUM_SINKS];
+	int32_t *x;
+	int ch, i, j, k, n;
+	int idx;
 	int nch = source_stream->channels;
-	int32_t out[num_sinks];
+
+	for (j = 0; j < num_sinks; j++)
+		outp[j] = out[j];
 
 	for (ch = 0; ch < nch; ch++) {
-		idx = ch;
 		state = &cd->state[ch];
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source_stream, idx);
-			cd->crossover_split(*x << 8, out, state);
-
-			for (j = 0; j < num_sinks; j++) {
-				if (!sinks[j])
-					continue;
-				sink_stream = &sinks[j]->stream;
-				y = audio_stream_read_frag_s32(sink_stream,
-							       idx);
-				*y = sat_int24(Q_SHIFT_RND(out[j], 31, 23));
+		for (i = 0; i < frames; i += n) {
+			n = MIN(frames - i, CROSSOVER_BLOCK_FRAMES);
+			idx = i * nch + ch;
+			for (k = 0; k < n; k++) {
+				x = audio_stream_read_frag_s32(source_stream,
+							       idx + k * nch);
+				in[k] = *x << 8;
 			}
 
-			idx += nch;
+			cd->crossover_split(in, outp, state, n);
+
+			for (j = 0; j < num_sinks; j++)
+				crossover_store_s24(sinks[j], out[j], idx, nch,
+						    n);
 		}
 	}
 }
 #endif /* CONFIG_FORMAT_S24LE */
 
 #if CONFIG_FORMAT_S32LE
+/* Stores a block of one channel to a connected sink */
+static inline void crossover_store_s32(struct comp_buffer *sink,
+				       const int32_t out[], int idx, int nch,
+				       int frames)
+{
+	int32_t *y;
+	int k;
+
+	if (!sink)
+		return;
+
+	for (k = 0; k < frames; k++) {
+		y = audio_stream_read_frag_s32(&sink->stream, idx + k * nch);
+		*y = out[k];
+	}
+}
+
 static void crossover_s32_default(const struct comp_dev *dev,
 				  const struct comp_buffer *source,
 				  struct comp_buffer *sinks[],
@@ -222,30 +287,33 @@ static void crossover_s32_default(const struct comp_dev *dev,
 	struct comp_data *cd = comp_get_drvdata(dev);
 	struct crossover_state *state;
 	const struct audio_stream *source_stream = &source->stream;
-	struct audio_stream *sink_stream;
-	int32_t *x, *y;
-	int ch, i, j;
-	int idx = 0;
+	int32_t in[CROSSOVER_BLOCK_FRAMES];
+	int32_t out[CROSSOVER_4WAY_NUM_SINKS][CROSSOVER_BLOCK_FRAMES];
+	int32_t *outp[CROSSOVER_4WAY_NUM_SINKS];
+	int32_t *x;
+	int ch, i, j, k, n;
+	int idx;
 	int nch = source_stream->channels;
-	int32_t out[num_sinks];
+
+	for (j = 0; j < num_sinks; j++)
+		outp[j] = out[j];
 
 	for (ch = 0; ch < nch; ch++) {
-		idx = ch;
-		state = &cd->state[0];
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source_stream, idx);
-			cd->crossover_split(*x, out, state);
-
-			for (j = 0; j < num_sinks; j++) {
-				if (!sinks[j])
-					continue;
-				sink_stream = &sinks[j]->stream;
-				y = audio_stream_read_frag_s32(sink_stream,
-							       idx);
-				*y = out[j];
+		state = &cd->state[ch];
+		for (i = 0; i < frames; i += n) {
+			n = MIN(frames - i, CROSSOVER_BLOCK_FRAMES);
+			idx = i * nch + ch;
+			for (k = 0; k < n; k++) {
+				x = audio_stream_read_frag_s32(source_stream,
+							       idx + k * nch);
+				in[k] = *x;
 			}
 
-			idx += nch;
+			cd->crossover_split(in, outp, state, n);
+
+			for (j = 0; j < num_sinks; j++)
+				crossover_store_s32(sinks[j], out[j], idx, nch,
+						    n);
 		}
 	}
 }
@@ -13,6 +13,7 @@
 #include <sof/debug/panic.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
+#include <sof/lib/cache.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
 #include <sof/list.h>
@@ -113,6 +114,9 @@ static struct comp_dev *dcblock_new(const struct comp_driver *drv,
 		dcblock_set_passthrough(cd);
 	}
 
+	/* each sample is read before its output is written */
+	dev->inplace = true;
+
 	dev->state = COMP_STATE_READY;
 	return dev;
 }
@@ -317,6 +321,28 @@ static int dcblock_copy(struct comp_dev *dev)
 	return 0;
 }
 
+/**
+ * \brief Processes frames of a fused component chain.
+ * \param[in,out] dev DC Blocking Filter base component device.
+ * \param[in,out] source Source stream.
+ * \param[in,out] sink Sink stream.
+ * \param[in] frames Number of frames to process.
+ * \return Error code.
+ */
+static int dcblock_process_stream(struct comp_dev *dev,
+				  struct audio_stream *source,
+				  struct audio_stream *sink, uint32_t frames)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+
+	cd->dcblock_func(dev, source, sink, frames);
+
+	audio_stream_produce(sink, frames * audio_stream_frame_bytes(sink));
+	audio_stream_consume(source, frames * audio_stream_frame_bytes(source));
+
+	return 0;
+}
+
 /**
  * \brief Prepares DC Blocking Filter component for processing.
  * \param[in,out] dev DC Blocking Filter base component device.
@@ -393,6 +419,17 @@ static int dcblock_reset(struct comp_dev *dev)
 	return 0;
 }
 
+/**
+ * \brief Writes back DC Blocking Filter private data before moving to
+ *	  another core.
+ * \param[in,out] dev DC Blocking Filter base component device.
+ */
+static void dcblock_writeback(struct comp_dev *dev)
+{
+	dcache_writeback_region(comp_get_drvdata(dev),
+				sizeof(struct comp_data));
+}
+
 /** \brief DC Blocking Filter component definition. */
 static const struct comp_driver comp_dcblock = {
 	.type = SOF_COMP_DCBLOCK,
@@ -405,8 +442,10 @@ static const struct comp_driver comp_dcblock = {
 		 .cmd		= dcblock_cmd,
 		 .trigger	= dcblock_trigger,
 		 .copy		= dcblock_copy,
+		 .process	= dcblock_process_stream,
 		 .prepare	= dcblock_prepare,
 		 .reset		= dcblock_reset,
+		 .writeback	= dcblock_writeback,
 	},
 };
 
@@ -38,26 +38,35 @@ static void dcblock_s16_default(const struct comp_dev *dev,
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
 	struct dcblock_state *state;
+	int16_t *x0 = source->r_ptr;
+	int16_t *y0 = sink->w_ptr;
 	int16_t *x;
 	int16_t *y;
 	int32_t R;
 	int32_t tmp;
-	int idx;
+	int nch = source->channels;
+	int samples;
 	int ch;
 	int i;
-	int nch = source->channels;
+	uint32_t n;
 
-	for (ch = 0; ch < nch; ch++) {
-		state = &cd->state[ch];
-		R = cd->R_coeffs[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s16(source, idx);
-			y = audio_stream_read_frag_s16(sink, idx);
-			tmp = dcblock_generic(state, R, *x << 16);
-			*y = sat_int16(Q_SHIFT_RND(tmp, 31, 15));
-			idx += nch;
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		samples = n * nch;
+		for (ch = 0; ch < nch; ch++) {
+			state = &cd->state[ch];
+			R = cd->R_coeffs[ch];
+			x = x0 + ch;
+			y = y0 + ch;
+			for (i = 0; i < samples; i += nch) {
+				tmp = dcblock_generic(state, R, x[i] << 16);
+				y[i] = sat_int16(Q_SHIFT_RND(tmp, 31, 15));
+			}
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x0 + samples);
+		y0 = audio_stream_wrap(sink, y0 + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE */
@@ -70,26 +79,35 @@ static void dcblock_s24_default(const struct comp_dev *dev,
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
 	struct dcblock_state *state;
+	int32_t *x0 = source->r_ptr;
+	int32_t *y0 = sink->w_ptr;
 	int32_t *x;
 	int32_t *y;
 	int32_t R;
 	int32_t tmp;
-	int idx;
+	int nch = source->channels;
+	int samples;
 	int ch;
 	int i;
-	int nch = source->channels;
+	uint32_t n;
 
-	for (ch = 0; ch < nch; ch++) {
-		state = &cd->state[ch];
-		R = cd->R_coeffs[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source, idx);
-			y = audio_stream_read_frag_s32(sink, idx);
-			tmp = dcblock_generic(state, R, *x << 8);
-			*y = sat_int24(Q_SHIFT_RND(tmp, 31, 23));
-			idx += nch;
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		samples = n * nch;
+		for (ch = 0; ch < nch; ch++) {
+			state = &cd->state[ch];
+			R = cd->R_coeffs[ch];
+			x = x0 + ch;
+			y = y0 + ch;
+			for (i = 0; i < samples; i += nch) {
+				tmp = dcblock_generic(state, R, x[i] << 8);
+				y[i] = sat_int24(Q_SHIFT_RND(tmp, 31, 23));
+			}
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x0 + samples);
+		y0 = audio_stream_wrap(sink, y0 + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S24LE */
@@ -102,24 +120,32 @@ static void dcblock_s32_default(const struct comp_dev *dev,
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
 	struct dcblock_state *state;
+	int32_t *x0 = source->r_ptr;
+	int32_t *y0 = sink->w_ptr;
 	int32_t *x;
 	int32_t *y;
 	int32_t R;
-	int idx;
+	int nch = source->channels;
+	int samples;
 	int ch;
 	int i;
-	int nch = source->channels;
+	uint32_t n;
 
-	for (ch = 0; ch < nch; ch++) {
-		state = &cd->state[ch];
-		R = cd->R_coeffs[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source, idx);
-			y = audio_stream_read_frag_s32(sink, idx);
-			*y = dcblock_generic(state, R, *x);
-			idx += nch;
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		samples = n * nch;
+		for (ch = 0; ch < nch; ch++) {
+			state = &cd->state[ch];
+			R = cd->R_coeffs[ch];
+			x = x0 + ch;
+			y = y0 + ch;
+			for (i = 0; i < samples; i += nch)
+				y[i] = dcblock_generic(state, R, x[i]);
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x0 + samples);
+		y0 = audio_stream_wrap(sink, y0 + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S32LE */
@@ -600,7 +600,7 @@ static int test_keyword_copy(struct comp_dev *dev)
 	source = list_first_item(&dev->bsource_list,
 				 struct comp_buffer, sink_list);
 
-	if (!source->stream.avail)
+	if (!audio_stream_used_bytes(&source->stream))
 		return PPL_STATUS_PATH_STOP;
 
 	buffer_lock(source, &flags);
@@ -14,6 +14,7 @@
 #include <sof/debug/panic.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
+#include <sof/lib/cache.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
 #include <sof/list.h>
@@ -380,6 +381,9 @@ static struct comp_dev *eq_fir_new(const struct comp_driver *drv,
 	for (i = 0; i < PLATFORM_MAX_CHANNELS; i++)
 		fir_reset(&cd->fir[i]);
 
+	/* fir_32x16_block() allows sink to alias source */
+	dev->inplace = true;
+
 	dev->state = COMP_STATE_READY;
 	return dev;
 }
@@ -620,10 +624,19 @@ static int eq_fir_reset(struct comp_dev *dev)
 	return 0;
 }
 
+static void eq_fir_writeback(struct comp_dev *dev)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+
+	comp_data_blob_writeback(cd->model_handler);
+	dcache_writeback_region(cd, sizeof(*cd));
+}
+
 static const struct comp_driver comp_eq_fir = {
 	.type = SOF_COMP_EQ_FIR,
 	.uid = SOF_RT_UUID(eq_fir_uuid),
 	.tctx = &eq_fir_tr,
+	.mcps = 12,
 	.ops = {
 		.create = eq_fir_new,
 		.free = eq_fir_free,
@@ -632,6 +645,7 @@ static const struct comp_driver comp_eq_fir = {
 		.copy = eq_fir_copy,
 		.prepare = eq_fir_prepare,
 		.reset = eq_fir_reset,
+		.writeback = eq_fir_writeback,
 	},
 };
 
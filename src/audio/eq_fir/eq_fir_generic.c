@@ -10,34 +10,58 @@
 
 #if FIR_GENERIC
 
+#include <sof/common.h>
 #include <sof/audio/eq_fir/eq_fir.h>
 #include <sof/math/fir_generic.h>
 #include <errno.h>
 #include <stddef.h>
 #include <stdint.h>
 
+/* Number of frames converted to Q1.31 for a block filter call */
+#define EQ_FIR_BLOCK_FRAMES	32
+
 #if CONFIG_FORMAT_S16LE
 void eq_fir_s16(struct fir_state_32x16 fir[], const struct audio_stream *source,
 		struct audio_stream *sink, int frames, int nch)
 {
 	struct fir_state_32x16 *filter;
+	int32_t buf[EQ_FIR_BLOCK_FRAMES];
+	int16_t *x0 = source->r_ptr;
+	int16_t *y0 = sink->w_ptr;
 	int16_t *x;
 	int16_t *y;
-	int32_t z;
-	int idx;
+	int samples;
 	int ch;
 	int i;
+	int j;
+	int m;
+	int n;
+
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		samples = n * nch;
+		for (ch = 0; ch < nch; ch++) {
+			filter = &fir[ch];
+			x = x0 + ch;
+			y = y0 + ch;
+			for (i = 0; i < n; i += m) {
+				m = MIN(n - i, EQ_FIR_BLOCK_FRAMES);
+				for (j = 0; j < m; j++) {
+					buf[j] = *x << 16;
+					x += nch;
+				}
 
-	for (ch = 0; ch < nch; ch++) {
-		filter = &fir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s16(source, idx);
-			y = audio_stream_write_frag_s16(sink, idx);
-			z = fir_32x16(filter, *x << 16);
-			*y = sat_int16(Q_SHIFT_RND(z, 31, 15));
-			idx += nch;
+				fir_32x16_block(filter, buf, buf, m, 1);
+				for (j = 0; j < m; j++) {
+					*y = sat_int16(Q_SHIFT_RND(buf[j], 31, 15));
+					y += nch;
+				}
+			}
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x0 + samples);
+		y0 = audio_stream_wrap(sink, y0 + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE */
@@ -47,23 +71,43 @@ void eq_fir_s24(struct fir_state_32x16 fir[], const struct audio_stream *source,
 		struct audio_stream *sink, int frames, int nch)
 {
 	struct fir_state_32x16 *filter;
+	int32_t buf[EQ_FIR_BLOCK_FRAMES];
+	int32_t *x0 = source->r_ptr;
+	int32_t *y0 = sink->w_ptr;
 	int32_t *x;
 	int32_t *y;
-	int32_t z;
-	int idx;
+	int samples;
 	int ch;
 	int i;
+	int j;
+	int m;
+	int n;
 
-	for (ch = 0; ch < nch; ch++) {
-		filter = &fir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source, idx);
-			y = audio_stream_write_frag_s32(sink, idx);
-			z = fir_32x16(filter, *x << 8);
-			*y = sat_int24(Q_SHIFT_RND(z, 31, 23));
-			idx += nch;
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		samples = n * nch;
+		for (ch = 0; ch < nch; ch++) {
+			filter = &fir[ch];
+			x = x0 + ch;
+			y = y0 + ch;
+			for (i = 0; i < n; i += m) {
+				m = MIN(n - i, EQ_FIR_BLOCK_FRAMES);
+				for (j = 0; j < m; j++) {
+					buf[j] = *x << 8;
+					x += nch;
+				}
+
+				fir_32x16_block(filter, buf, buf, m, 1);
+				for (j = 0; j < m; j++) {
+					*y = sat_int24(Q_SHIFT_RND(buf[j], 31, 23));
+					y += nch;
+				}
+			}
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x0 + samples);
+		y0 = audio_stream_wrap(sink, y0 + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S24LE */
@@ -72,22 +116,23 @@ void eq_fir_s24(struct fir_state_32x16 fir[], const struct audio_stream *source,
 void eq_fir_s32(struct fir_state_32x16 fir[], const struct audio_stream *source,
 		struct audio_stream *sink, int frames, int nch)
 {
-	struct fir_state_32x16 *filter;
-	int32_t *x;
-	int32_t *y;
-	int idx;
+	int32_t *x0 = source->r_ptr;
+	int32_t *y0 = sink->w_ptr;
+	int samples;
 	int ch;
-	int i;
+	int n;
 
-	for (ch = 0; ch < nch; ch++) {
-		filter = &fir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source, idx);
-			y = audio_stream_write_frag_s32(sink, idx);
-			*y = fir_32x16(filter, *x);
-			idx += nch;
-		}
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		samples = n * nch;
+
+		/* The samples are already Q1.31, filter in the buffers */
+		for (ch = 0; ch < nch; ch++)
+			fir_32x16_block(&fir[ch], x0 + ch, y0 + ch, n, nch);
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x0 + samples);
+		y0 = audio_stream_wrap(sink, y0 + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S32LE */
@@ -16,6 +16,7 @@
 #include <sof/debug/panic.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
+#include <sof/lib/cache.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
 #include <sof/list.h>
@@ -53,6 +54,9 @@ struct comp_data {
 	eq_iir_func eq_iir_func;		/**< processing function */
 };
 
+/* Number of frames converted to Q1.31 for a block filter call */
+#define EQ_IIR_BLOCK_FRAMES	16
+
 #if CONFIG_FORMAT_S16LE
 /*
  * EQ IIR algorithm code
@@ -65,25 +69,39 @@ static void eq_iir_s16_default(const struct comp_dev *dev,
 
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	struct iir_state_df2t *filter;
+	int32_t buf[EQ_IIR_BLOCK_FRAMES * PLATFORM_MAX_CHANNELS];
+	int16_t *x0 = source->r_ptr;
+	int16_t *y0 = sink->w_ptr;
 	int16_t *x;
 	int16_t *y;
-	int32_t z;
-	int ch;
-	int i;
-	int idx;
 	int nch = source->channels;
-
-	for (ch = 0; ch < nch; ch++) {
-		filter = &cd->iir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s16(source, idx);
-			y = audio_stream_write_frag_s16(sink, idx);
-			z = iir_df2t(filter, *x << 16);
-			*y = sat_int16(Q_SHIFT_RND(z, 31, 15));
-			idx += nch;
+	int samples;
+	int i;
+	int j;
+	int m;
+	uint32_t n;
+
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		x = x0;
+		y = y0;
+		for (i = 0; i < n; i += m) {
+			m = MIN(n - i, EQ_IIR_BLOCK_FRAMES);
+			samples = m * nch;
+			for (j = 0; j < samples; j++)
+				buf[j] = x[j] << 16;
+
+			iir_df2t_block_nch(cd->iir, buf, buf, m, nch);
+			for (j = 0; j < samples; j++)
+				y[j] = sat_int16(Q_SHIFT_RND(buf[j], 31, 15));
+
+			x += samples;
+			y += samples;
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x);
+		y0 = audio_stream_wrap(sink, y);
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE */
@@ -96,25 +114,39 @@ static void eq_iir_s24_default(const struct comp_dev *dev,
 
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	struct iir_state_df2t *filter;
+	int32_t buf[EQ_IIR_BLOCK_FRAMES * PLATFORM_MAX_CHANNELS];
+	int32_t *x0 = source->r_ptr;
+	int32_t *y0 = sink->w_ptr;
 	int32_t *x;
 	int32_t *y;
-	int32_t z;
-	int idx;
-	int ch;
-	int i;
 	int nch = source->channels;
-
-	for (ch = 0; ch < nch; ch++) {
-		filter = &cd->iir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source, idx);
-			y = audio_stream_write_frag_s32(sink, idx);
-			z = iir_df2t(filter, *x << 8);
-			*y = sat_int24(Q_SHIFT_RND(z, 31, 23));
-			idx += nch;
+	int samples;
+	int i;
+	int j;
+	int m;
+	uint32_t n;
+
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		x = x0;
+		y = y0;
+		for (i = 0; i < n; i += m) {
+			m = MIN(n - i, EQ_IIR_BLOCK_FRAMES);
+			samples = m * nch;
+			for (j = 0; j < samples; j++)
+				buf[j] = x[j] << 8;
+
+			iir_df2t_block_nch(cd->iir, buf, buf, m, nch);
+			for (j = 0; j < samples; j++)
+				y[j] = sat_int24(Q_SHIFT_RND(buf[j], 31, 23));
+
+			x += samples;
+			y += samples;
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x);
+		y0 = audio_stream_wrap(sink, y);
 	}
 }
 #endif /* CONFIG_FORMAT_S24LE */
@@ -127,23 +159,20 @@ static void eq_iir_s32_default(const struct comp_dev *dev,
 
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	struct iir_state_df2t *filter;
-	int32_t *x;
-	int32_t *y;
-	int idx;
-	int ch;
-	int i;
+	int32_t *x0 = source->r_ptr;
+	int32_t *y0 = sink->w_ptr;
 	int nch = source->channels;
+	int samples;
+	uint32_t n;
 
-	for (ch = 0; ch < nch; ch++) {
-		filter = &cd->iir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source, idx);
-			y = audio_stream_write_frag_s32(sink, idx);
-			*y = iir_df2t(filter, *x);
-			idx += nch;
-		}
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		samples = n * nch;
+		iir_df2t_block_nch(cd->iir, x0, y0, n, nch);
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x0 + samples);
+		y0 = audio_stream_wrap(sink, y0 + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S32LE */
@@ -156,25 +185,39 @@ static void eq_iir_s32_16_default(const struct comp_dev *dev,
 
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	struct iir_state_df2t *filter;
+	int32_t buf[EQ_IIR_BLOCK_FRAMES * PLATFORM_MAX_CHANNELS];
+	int32_t *x0 = source->r_ptr;
+	int16_t *y0 = sink->w_ptr;
 	int32_t *x;
 	int16_t *y;
-	int32_t z;
-	int idx;
-	int ch;
-	int i;
 	int nch = source->channels;
-
-	for (ch = 0; ch < nch; ch++) {
-		filter = &cd->iir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source, idx);
-			y = audio_stream_write_frag_s16(sink, idx);
-			z = iir_df2t(filter, *x);
-			*y = sat_int16(Q_SHIFT_RND(z, 31, 15));
-			idx += nch;
+	int samples;
+	int i;
+	int j;
+	int m;
+	uint32_t n;
+
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		x = x0;
+		y = y0;
+		for (i = 0; i < n; i += m) {
+			m = MIN(n - i, EQ_IIR_BLOCK_FRAMES);
+			samples = m * nch;
+			for (j = 0; j < samples; j++)
+				buf[j] = x[j];
+
+			iir_df2t_block_nch(cd->iir, buf, buf, m, nch);
+			for (j = 0; j < samples; j++)
+				y[j] = sat_int16(Q_SHIFT_RND(buf[j], 31, 15));
+
+			x += samples;
+			y += samples;
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x);
+		y0 = audio_stream_wrap(sink, y);
 	}
 }
 #endif /* CONFIG_FORMAT_S32LE && CONFIG_FORMAT_S16LE */
@@ -187,25 +230,39 @@ static void eq_iir_s32_24_default(const struct comp_dev *dev,
 
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	struct iir_state_df2t *filter;
+	int32_t buf[EQ_IIR_BLOCK_FRAMES * PLATFORM_MAX_CHANNELS];
+	int32_t *x0 = source->r_ptr;
+	int32_t *y0 = sink->w_ptr;
 	int32_t *x;
 	int32_t *y;
-	int32_t z;
-	int idx;
-	int ch;
-	int i;
 	int nch = source->channels;
-
-	for (ch = 0; ch < nch; ch++) {
-		filter = &cd->iir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = audio_stream_read_frag_s32(source, idx);
-			y = audio_stream_write_frag_s32(sink, idx);
-			z = iir_df2t(filter, *x);
-			*y = sat_int24(Q_SHIFT_RND(z, 31, 23));
-			idx += nch;
+	int samples;
+	int i;
+	int j;
+	int m;
+	uint32_t n;
+
+	while (frames) {
+		n = audio_stream_span_frames(source, x0, sink, y0, frames);
+		x = x0;
+		y = y0;
+		for (i = 0; i < n; i += m) {
+			m = MIN(n - i, EQ_IIR_BLOCK_FRAMES);
+			samples = m * nch;
+			for (j = 0; j < samples; j++)
+				buf[j] = x[j];
+
+			iir_df2t_block_nch(cd->iir, buf, buf, m, nch);
+			for (j = 0; j < samples; j++)
+				y[j] = sat_int24(Q_SHIFT_RND(buf[j], 31, 23));
+
+			x += samples;
+			y += samples;
 		}
+
+		frames -= n;
+		x0 = audio_stream_wrap(source, x);
+		y0 = audio_stream_wrap(sink, y);
 	}
 }
 #endif /* CONFIG_FORMAT_S32LE && CONFIG_FORMAT_S24LE */
@@ -224,15 +281,22 @@ static void eq_iir_s32_s16_pass(const struct comp_dev *dev,
 				struct audio_stream *sink,
 				uint32_t frames)
 {
-	int32_t *x;
-	int16_t *y;
+	int32_t *x = source->r_ptr;
+	int16_t *y = sink->w_ptr;
+	int nch = source->channels;
+	int samples;
 	int i;
-	int n = frames * source->channels;
+	uint32_t n;
 
-	for (i = 0; i < n; i++) {
-		x = audio_stream_read_frag_s32(source, i);
-		y = audio_stream_write_frag_s16(sink, i);
-		*y = sat_int16(Q_SHIFT_RND(*x, 31, 15));
+	while (frames) {
+		n = audio_stream_span_frames(source, x, sink, y, frames);
+		samples = n * nch;
+		for (i = 0; i < samples; i++)
+			y[i] = sat_int16(Q_SHIFT_RND(x[i], 31, 15));
+
+		frames -= n;
+		x = audio_stream_wrap(source, x + samples);
+		y = audio_stream_wrap(sink, y + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE && CONFIG_FORMAT_S32LE */
@@ -243,15 +307,22 @@ static void eq_iir_s32_s24_pass(const struct comp_dev *dev,
 				struct audio_stream *sink,
 				uint32_t frames)
 {
-	int32_t *x;
-	int32_t *y;
+	int32_t *x = source->r_ptr;
+	int32_t *y = sink->w_ptr;
+	int nch = source->channels;
+	int samples;
 	int i;
-	int n = frames * source->channels;
+	uint32_t n;
 
-	for (i = 0; i < n; i++) {
-		x = audio_stream_read_frag_s32(source, i);
-		y = audio_stream_write_frag_s16(sink, i);
-		*y = sat_int24(Q_SHIFT_RND(*x, 31, 23));
+	while (frames) {
+		n = audio_stream_span_frames(source, x, sink, y, frames);
+		samples = n * nch;
+		for (i = 0; i < samples; i++)
+			y[i] = sat_int24(Q_SHIFT_RND(x[i], 31, 23));
+
+		frames -= n;
+		x = audio_stream_wrap(source, x + samples);
+		y = audio_stream_wrap(sink, y + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S24LE && CONFIG_FORMAT_S32LE */
@@ -552,6 +623,9 @@ static struct comp_dev *eq_iir_new(const struct comp_driver *drv,
 	for (i = 0; i < PLATFORM_MAX_CHANNELS; i++)
 		iir_reset_df2t(&cd->iir[i]);
 
+	/* iir_df2t_block_nch() allows sink to alias source */
+	dev->inplace = true;
+
 	dev->state = COMP_STATE_READY;
 	return dev;
 }
@@ -716,11 +790,28 @@ static void eq_iir_process(struct comp_dev *dev, struct comp_buffer *source,
 	comp_update_buffer_produce(sink, sink_bytes);
 }
 
+/* Check for changed configuration */
+static int eq_iir_check_config(struct comp_dev *dev, int channels)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	int ret;
+
+	if (comp_is_new_data_blob_available(cd->model_handler)) {
+		cd->config = comp_get_data_blob(cd->model_handler, NULL, NULL);
+		ret = eq_iir_setup(cd, channels);
+		if (ret < 0) {
+			comp_err(dev, "eq_iir_check_config(), failed IIR setup");
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
 /* copy and process stream data from source to sink buffers */
 static int eq_iir_copy(struct comp_dev *dev)
 {
 	struct comp_copy_limits cl;
-	struct comp_data *cd = comp_get_drvdata(dev);
 	struct comp_buffer *sourceb;
 	struct comp_buffer *sinkb;
 	int ret;
@@ -730,15 +821,9 @@ static int eq_iir_copy(struct comp_dev *dev)
 	sourceb = list_first_item(&dev->bsource_list, struct comp_buffer,
 				  sink_list);
 
-	/* Check for changed configuration */
-	if (comp_is_new_data_blob_available(cd->model_handler)) {
-		cd->config = comp_get_data_blob(cd->model_handler, NULL, NULL);
-		ret = eq_iir_setup(cd, sourceb->stream.channels);
-		if (ret < 0) {
-			comp_err(dev, "eq_iir_copy(), failed IIR setup");
-			return ret;
-		}
-	}
+	ret = eq_iir_check_config(dev, sourceb->stream.channels);
+	if (ret < 0)
+		return ret;
 
 	sinkb = list_first_item(&dev->bsink_list, struct comp_buffer,
 				source_list);
@@ -753,6 +838,26 @@ static int eq_iir_copy(struct comp_dev *dev)
 	return 0;
 }
 
+/* process stream data of a fused component chain */
+static int eq_iir_process_stream(struct comp_dev *dev,
+				 struct audio_stream *source,
+				 struct audio_stream *sink, uint32_t frames)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	int ret;
+
+	ret = eq_iir_check_config(dev, source->channels);
+	if (ret < 0)
+		return ret;
+
+	cd->eq_iir_func(dev, source, sink, frames);
+
+	audio_stream_produce(sink, frames * audio_stream_frame_bytes(sink));
+	audio_stream_consume(source, frames * audio_stream_frame_bytes(source));
+
+	return 0;
+}
+
 static int eq_iir_prepare(struct comp_dev *dev)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
@@ -849,10 +954,19 @@ static int eq_iir_reset(struct comp_dev *dev)
 	return 0;
 }
 
+static void eq_iir_writeback(struct comp_dev *dev)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+
+	comp_data_blob_writeback(cd->model_handler);
+	dcache_writeback_region(cd, sizeof(*cd));
+}
+
 static const struct comp_driver comp_eq_iir = {
 	.type = SOF_COMP_EQ_IIR,
 	.uid = SOF_RT_UUID(eq_iir_uuid),
 	.tctx = &eq_iir_tr,
+	.mcps = 4,
 	.ops = {
 		.create = eq_iir_new,
 		.free = eq_iir_free,
@@ -860,8 +974,10 @@ static const struct comp_driver comp_eq_iir = {
 		.cmd = eq_iir_cmd,
 		.trigger = eq_iir_trigger,
 		.copy = eq_iir_copy,
+		.process = eq_iir_process_stream,
 		.prepare = eq_iir_prepare,
 		.reset = eq_iir_reset,
+		.writeback = eq_iir_writeback,
 	},
 };
 
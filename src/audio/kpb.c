@@ -91,14 +91,15 @@ static size_t kpb_allocate_history_buffer(struct comp_data *kpb,
 static void kpb_clear_history_buffer(struct history_buffer *buff);
 static void kpb_free_history_buffer(struct history_buffer *buff);
 static inline bool kpb_is_sample_width_supported(uint32_t sampling_width);
+static bool kpb_is_config_supported(struct comp_dev *dev,
+				    const struct sof_kpb_config *config);
+static inline size_t kpb_bytes_per_ms(const struct sof_kpb_config *config);
 static void kpb_copy_samples(struct comp_buffer *sink,
-			     struct comp_buffer *source, size_t size,
-			     size_t sample_width);
+			     struct comp_buffer *source, size_t size);
 static void kpb_drain_samples(void *source, struct audio_stream *sink,
-			      size_t size, size_t sample_width);
+			      size_t size);
 static void kpb_buffer_samples(const struct audio_stream *source,
-			       uint32_t start, void *sink, size_t size,
-			       size_t sample_width);
+			       uint32_t start, void *sink, size_t size);
 static void kpb_reset_history_buffer(struct history_buffer *buff);
 static inline bool validate_host_params(struct comp_dev *dev,
 					size_t host_period_size,
@@ -155,20 +156,12 @@ static struct comp_dev *kpb_new(const struct comp_driver *drv,
 		       bs);
 	assert(!ret);
 
-	if (!kpb_is_sample_width_supported(kpb->config.sampling_width)) {
-		comp_err(dev, "kpb_new(): requested sampling width not supported");
-		rfree(dev);
-		return NULL;
-	}
+	/* topology may leave the history depth to the platform */
+	if (!kpb->config.history_depth)
+		kpb->config.history_depth = KPB_DEFAULT_BUFF_TIME;
 
-	if (kpb->config.channels > KPB_MAX_SUPPORTED_CHANNELS) {
-		comp_err(dev, "kpb_new(): no of channels exceeded the limit");
-		rfree(dev);
-		return NULL;
-	}
-
-	if (kpb->config.sampling_freq != KPB_SAMPLNG_FREQUENCY) {
-		comp_err(dev, "kpb_new(): requested sampling frequency not supported");
+	if (!kpb_is_config_supported(dev, &kpb->config)) {
+		rfree(kpb);
 		rfree(dev);
 		return NULL;
 	}
@@ -228,7 +221,7 @@ static size_t kpb_allocate_history_buffer(struct comp_data *kpb,
 	hb = kpb->hd.c_hb;
 
 	/* Allocate history buffer/s. KPB history buffer has a size of
-	 * KPB_MAX_BUFFER_SIZE, since there is no single memory block
+	 * hb_size_req, since there is no single memory block
 	 * that big, we need to allocate couple smaller blocks which
 	 * linked together will form history buffer.
 	 */
@@ -411,6 +404,12 @@ static int kpb_params(struct comp_dev *dev,
 	kpb->host_buffer_size = params->buffer.size;
 	kpb->host_period_size = params->host_period_bytes;
 	kpb->config.sampling_width = params->sample_container_bytes * 8;
+	kpb->config.channels = params->channels;
+	kpb->config.sampling_freq = params->rate;
+
+	/* history buffer is sized from the negotiated stream */
+	if (!kpb_is_config_supported(dev, &kpb->config))
+		return -EINVAL;
 
 	return 0;
 }
@@ -430,7 +429,8 @@ static int kpb_prepare(struct comp_dev *dev)
 	int i;
 	struct list_item *blist;
 	struct comp_buffer *sink;
-	size_t hb_size_req = KPB_MAX_BUFFER_SIZE(kpb->config.sampling_width);
+	size_t hb_size_req = kpb_bytes_per_ms(&kpb->config) *
+			     kpb->config.history_depth;
 
 	comp_info(dev, "kpb_prepare()");
 
@@ -614,7 +614,6 @@ static int kpb_copy(struct comp_dev *dev)
 	struct comp_buffer *source = NULL;
 	struct comp_buffer *sink = NULL;
 	size_t copy_bytes = 0;
-	size_t sample_width = kpb->config.sampling_width;
 	uint32_t flags = 0;
 	struct draining_data *dd = &kpb->draining_task_data;
 
@@ -675,7 +674,7 @@ static int kpb_copy(struct comp_dev *dev)
 			goto out;
 		}
 
-		kpb_copy_samples(sink, source, copy_bytes, sample_width);
+		kpb_copy_samples(sink, source, copy_bytes);
 
 		/* Buffer source data internally in history buffer for future
 		 * use by clients.
@@ -738,7 +737,7 @@ static int kpb_copy(struct comp_dev *dev)
 			goto out;
 		}
 
-		kpb_copy_samples(sink, source, copy_bytes, sample_width);
+		kpb_copy_samples(sink, source, copy_bytes);
 
 		comp_update_buffer_produce(sink, copy_bytes);
 		comp_update_buffer_consume(source, copy_bytes);
@@ -801,7 +800,6 @@ static int kpb_buffer_data(struct comp_dev *dev,
 	uint64_t timeout = 0;
 	uint64_t current_time;
 	enum kpb_state state_preserved = kpb->state;
-	size_t sample_width = kpb->config.sampling_width;
 	struct timer *timer = timer_get();
 
 	comp_dbg(dev, "kpb_buffer_data()");
@@ -858,7 +856,7 @@ static int kpb_buffer_data(struct comp_dev *dev,
 			 * with next buffer.
 			 */
 			kpb_buffer_samples(&source->stream, offset, buff->w_ptr,
-					   space_avail, sample_width);
+					   space_avail);
 			/* Update write pointer & requested copy size */
 			buff->w_ptr = (char *)buff->w_ptr + space_avail;
 			size_to_copy = size_to_copy - space_avail;
@@ -872,7 +870,7 @@ static int kpb_buffer_data(struct comp_dev *dev,
 			 * copy what was requested.
 			 */
 			kpb_buffer_samples(&source->stream, offset, buff->w_ptr,
-					   size_to_copy, sample_width);
+					   size_to_copy);
 			/* Update write pointer & requested copy size */
 			buff->w_ptr = (char *)buff->w_ptr + size_to_copy;
 			/* Reset requested copy size */
@@ -999,10 +997,8 @@ static void kpb_init_draining(struct comp_dev *dev, struct kpb_client *cli)
 {
 	struct comp_data *kpb = comp_get_drvdata(dev);
 	bool is_sink_ready = (kpb->host_sink->sink->state == COMP_STATE_ACTIVE);
-	size_t sample_width = kpb->config.sampling_width;
-	size_t drain_req = cli->drain_req * kpb->config.channels *
-			       (kpb->config.sampling_freq / 1000) *
-			       (KPB_SAMPLE_CONTAINER_SIZE(sample_width) / 8);
+	size_t bytes_per_ms = kpb_bytes_per_ms(&kpb->config);
+	size_t drain_req = cli->drain_req * bytes_per_ms;
 	struct history_buffer *buff = kpb->hd.c_hb;
 	struct history_buffer *first_buff = buff;
 	size_t buffered = 0;
@@ -1011,9 +1007,6 @@ static void kpb_init_draining(struct comp_dev *dev, struct kpb_client *cli)
 	size_t drain_interval;
 	size_t host_period_size = kpb->host_period_size;
 	size_t ticks_per_ms = clock_ms_to_ticks(PLATFORM_DEFAULT_CLOCK, 1);
-	size_t bytes_per_ms = KPB_SAMPLES_PER_MS *
-			      (KPB_SAMPLE_CONTAINER_SIZE(sample_width) / 8) *
-			      kpb->config.channels;
 	size_t period_bytes_limit;
 	uint32_t flags;
 
@@ -1022,13 +1015,14 @@ static void kpb_init_draining(struct comp_dev *dev, struct kpb_client *cli)
 
 	if (kpb->state != KPB_STATE_RUN) {
 		comp_err(dev, "kpb_init_draining(): wrong KPB state");
-	} else if (cli->id > KPB_MAX_NO_OF_CLIENTS) {
+	} else if (cli->id >= KPB_MAX_NO_OF_CLIENTS) {
 		comp_err(dev, "kpb_init_draining(): wrong client id");
 	/* TODO: check also if client is registered */
 	} else if (!is_sink_ready) {
 		comp_err(dev, "kpb_init_draining(): sink not ready for draining");
 	} else if (kpb->hd.buffered < drain_req ||
-		   cli->drain_req > KPB_MAX_DRAINING_REQ) {
+		   cli->drain_req >
+		   KPB_MAX_DRAINING_REQ(kpb->config.history_depth)) {
 		comp_cl_err(&comp_kpb, "kpb_init_draining(): not enough data in history buffer");
 	} else {
 		/* Draining accepted, find proper buffer to start reading
@@ -1124,7 +1118,8 @@ static void kpb_init_draining(struct comp_dev *dev, struct kpb_client *cli)
 		kpb->draining_task_data.sink = kpb->host_sink;
 		kpb->draining_task_data.hb = buff;
 		kpb->draining_task_data.drain_req = drain_req;
-		kpb->draining_task_data.sample_width = sample_width;
+		kpb->draining_task_data.sample_width =
+			kpb->config.sampling_width;
 		kpb->draining_task_data.drain_interval = drain_interval;
 		kpb->draining_task_data.pb_limit = period_bytes_limit;
 		kpb->draining_task_data.dev = dev;
@@ -1156,7 +1151,6 @@ static enum task_state kpb_draining_task(void *arg)
 	struct comp_buffer *sink = draining_data->sink;
 	struct history_buffer *buff = draining_data->hb;
 	size_t drain_req = draining_data->drain_req;
-	size_t sample_width = draining_data->sample_width;
 	size_t size_to_read;
 	size_t size_to_copy;
 	bool move_buffer = false;
@@ -1222,8 +1216,7 @@ static enum task_state kpb_draining_task(void *arg)
 			}
 		}
 
-		kpb_drain_samples(buff->r_ptr, &sink->stream, size_to_copy,
-				  sample_width);
+		kpb_drain_samples(buff->r_ptr, &sink->stream, size_to_copy);
 
 		buff->r_ptr = (char *)buff->r_ptr + (uint32_t)size_to_copy;
 		drain_req -= size_to_copy;
@@ -1302,55 +1295,20 @@ out:
 /**
  * \brief Drain data samples safe, according to configuration.
  *
- * \param[in] dev - kpb component device pointer
- * \param[in] sink - pointer to sink buffer.
- * \param[in] source - pointer to source buffer.
+ * \param[in] source - pointer to history buffer data.
+ * \param[in] sink - pointer to sink stream.
  * \param[in] size - requested copy size in bytes.
  *
  * \return none.
  */
 static void kpb_drain_samples(void *source, struct audio_stream *sink,
-			      size_t size, size_t sample_width)
+			      size_t size)
 {
-#if CONFIG_FORMAT_S16LE || CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-	void *dst;
-	void *src = source;
-#endif
-	size_t i;
-	size_t j = 0;
-	size_t channel;
-	size_t frames = KPB_BYTES_TO_FRAMES(size, sample_width);
-
-	switch (sample_width) {
-#if CONFIG_FORMAT_S16LE
-	case 16:
-		for (i = 0; i < frames; i++) {
-			for (channel = 0; channel < KPB_NUM_OF_CHANNELS; channel++) {
-				dst = audio_stream_write_frag_s16(sink, j);
-				*((int16_t *)dst) = *((int16_t *)src);
-				src = ((int16_t *)src) + 1;
-				j++;
-			}
-		}
-		break;
-#endif /* CONFIG_FORMAT_S16LE */
-#if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-	case 24:
-	case 32:
-		for (i = 0; i < frames; i++) {
-			for (channel = 0; channel < KPB_NUM_OF_CHANNELS; channel++) {
-				dst = audio_stream_write_frag_s32(sink, j);
-				*((int32_t *)dst) = *((int32_t *)src);
-				src = ((int32_t *)src) + 1;
-				j++;
-			}
-		}
-		break;
-#endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
-	default:
-		comp_cl_err(&comp_kpb, "KPB: An attempt to copy not supported format!");
-		return;
-	}
+	/* history buffer data is copied to the sink in chunks until
+	 * the sink wraps
+	 */
+	audio_stream_copy_from_linear(source, 0, sink, 0,
+				      size / audio_stream_sample_bytes(sink));
 }
 
 /**
@@ -1359,43 +1317,14 @@ static void kpb_drain_samples(void *source, struct audio_stream *sink,
  * \param[in] start Start offset of source buffer in bytes.
  * \param[in,out] sink Pointer to sink buffer.
  * \param[in] size Requested copy size in bytes.
- * \param[in] sample_width Sample size.
  */
 static void kpb_buffer_samples(const struct audio_stream *source,
-			       uint32_t start, void *sink, size_t size,
-			       size_t sample_width)
+			       uint32_t start, void *sink, size_t size)
 {
-	void *src;
-	void *dst = sink;
-	size_t i;
-	size_t j = start /
-		(sample_width == 16 ? sizeof(int16_t) : sizeof(int32_t));
-	size_t channel;
-	size_t frames = KPB_BYTES_TO_FRAMES(size, sample_width);
-
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < KPB_NUM_OF_CHANNELS; channel++) {
-			switch (sample_width) {
-			case 16:
-				src = audio_stream_read_frag_s16(source, j);
-				*((int16_t *)dst) = *((int16_t *)src);
-				dst = ((int16_t *)dst) + 1;
-				break;
-#if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-			case 24:
-			case 32:
-				src = audio_stream_read_frag_s32(source, j);
-				*((int32_t *)dst) = *((int32_t *)src);
-				dst = ((int32_t *)dst) + 1;
-				break;
-#endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE*/
-			default:
-				comp_cl_err(&comp_kpb, "KPB: An attempt to copy not supported format!");
-				return;
-			}
-			j++;
-		}
-	}
+	uint32_t sample_bytes = audio_stream_sample_bytes(source);
+
+	audio_stream_copy_to_linear(source, start / sample_bytes, sink, 0,
+				    size / sample_bytes);
 }
 
 /**
@@ -1448,10 +1377,60 @@ static inline bool kpb_is_sample_width_supported(uint32_t sampling_width)
 	return ret;
 }
 
+/**
+ * \brief Check that KPB can buffer a stream of given configuration.
+ * \param[in] dev - component device pointer.
+ * \param[in] config - stream format and history depth.
+ *
+ * \return: true if supported, false otherwise.
+ */
+static bool kpb_is_config_supported(struct comp_dev *dev,
+				    const struct sof_kpb_config *config)
+{
+	if (!kpb_is_sample_width_supported(config->sampling_width)) {
+		comp_err(dev, "kpb_is_config_supported(): sampling width %u not supported",
+			 config->sampling_width);
+		return false;
+	}
+
+	if (!config->channels ||
+	    config->channels > KPB_MAX_SUPPORTED_CHANNELS) {
+		comp_err(dev, "kpb_is_config_supported(): no of channels %u exceeded the limit",
+			 config->channels);
+		return false;
+	}
+
+	/* History is accounted in whole milliseconds of the stream */
+	if (!config->sampling_freq || config->sampling_freq % 1000) {
+		comp_err(dev, "kpb_is_config_supported(): sampling frequency %u not supported",
+			 config->sampling_freq);
+		return false;
+	}
+
+	if (config->history_depth <= HOST_WAKEUP_TIME) {
+		comp_err(dev, "kpb_is_config_supported(): history depth %u [ms] shorter than host wakeup time",
+			 config->history_depth);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Amount of history data gathered each millisecond.
+ * \param[in] config - KPB configuration.
+ *
+ * \return: number of bytes.
+ */
+static inline size_t kpb_bytes_per_ms(const struct sof_kpb_config *config)
+{
+	return (config->sampling_freq / 1000) * config->channels *
+	       (KPB_SAMPLE_CONTAINER_SIZE(config->sampling_width) / 8);
+}
+
 /**
  * \brief Copy data samples safe, according to configuration.
  *
- * \param[in] dev - kpb component device pointer
  * \param[in] sink - pointer to sink buffer.
  * \param[in] source - pointer to source buffer.
  * \param[in] size - requested copy size in bytes.
@@ -1459,48 +1438,15 @@ static inline bool kpb_is_sample_width_supported(uint32_t sampling_width)
  * \return none.
  */
 static void kpb_copy_samples(struct comp_buffer *sink,
-			     struct comp_buffer *source, size_t size,
-			     size_t sample_width)
+			     struct comp_buffer *source, size_t size)
 {
-#if CONFIG_FORMAT_S16LE || CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-	void *dst;
-	void *src;
-#endif
-	size_t i;
-	size_t j = 0;
-	size_t channel;
-	size_t frames = KPB_BYTES_TO_FRAMES(size, sample_width);
 	struct audio_stream *istream = &source->stream;
 	struct audio_stream *ostream = &sink->stream;
 
 	buffer_invalidate(source, size);
 
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < KPB_NUM_OF_CHANNELS; channel++) {
-			switch (sample_width) {
-#if CONFIG_FORMAT_S16LE
-			case 16:
-				dst = audio_stream_write_frag_s16(ostream, j);
-				src = audio_stream_read_frag_s16(istream, j);
-				*((int16_t *)dst) = *((int16_t *)src);
-				break;
-#endif /* CONFIG_FORMAT_S16LE */
-#if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
-			case 24:
-				/* FALLTHROUGH */
-			case 32:
-				dst = audio_stream_write_frag_s32(ostream, j);
-				src = audio_stream_read_frag_s32(istream, j);
-				*((int32_t *)dst) = *((int32_t *)src);
-				break;
-#endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE*/
-			default:
-				comp_cl_err(&comp_kpb, "KPB: An attempt to copy not supported format!");
-				return;
-			}
-			j++;
-		}
-	}
+	audio_stream_copy(istream, 0, ostream, 0,
+			  size / audio_stream_sample_bytes(istream));
 
 	buffer_writeback(sink, size);
 }
@@ -1547,10 +1493,7 @@ static inline bool validate_host_params(struct comp_dev *dev,
 	 * is very likely after wake up from power state like d0ix.
 	 */
 	struct comp_data *kpb = comp_get_drvdata(dev);
-	size_t sample_width = kpb->config.sampling_width;
-	size_t bytes_per_ms = KPB_SAMPLES_PER_MS *
-			      (KPB_SAMPLE_CONTAINER_SIZE(sample_width) / 8) *
-			      kpb->config.channels;
+	size_t bytes_per_ms = kpb_bytes_per_ms(&kpb->config);
 	size_t pipeline_period_size = (dev->pipeline->ipc_pipe.period / 1000)
 					* bytes_per_ms;
 
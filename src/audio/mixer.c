@@ -49,31 +49,39 @@ static void mix_n_s16(struct comp_dev *dev, struct audio_stream *sink,
 		      const struct audio_stream **sources, uint32_t num_sources,
 		      uint32_t frames)
 {
-	int16_t *src;
-	int16_t *dest;
+	int16_t *src[PLATFORM_MAX_STREAMS];
+	int16_t *dest = sink->w_ptr;
 	int32_t val;
+	int samples;
 	int i;
 	int j;
-	int channel;
-	uint32_t frag = 0;
+	uint32_t n;
 
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < sink->channels; channel++) {
-			val = 0;
+	for (j = 0; j < num_sources; j++)
+		src[j] = sources[j]->r_ptr;
 
-			for (j = 0; j < num_sources; j++) {
-				src = audio_stream_read_frag_s16(sources[j],
-								 frag);
-				val += *src;
-			}
+	while (frames) {
+		n = audio_stream_frames_without_wrap(sink, dest);
+		n = MIN(n, frames);
+		for (j = 0; j < num_sources; j++)
+			n = MIN(n, audio_stream_frames_without_wrap(sources[j],
+								    src[j]));
 
-			dest = audio_stream_write_frag_s16(sink, frag);
+		samples = n * sink->channels;
+		for (i = 0; i < samples; i++) {
+			val = 0;
 
-			/* Saturate to 16 bits */
-			*dest = sat_int16(val);
+			for (j = 0; j < num_sources; j++)
+				val += src[j][i];
 
-			frag++;
+			/* Saturate to 16 bits */
+			dest[i] = sat_int16(val);
 		}
+
+		frames -= n;
+		dest = audio_stream_wrap(sink, dest + samples);
+		for (j = 0; j < num_sources; j++)
+			src[j] = audio_stream_wrap(sources[j], src[j] + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE */
@@ -84,31 +92,39 @@ static void mix_n_s32(struct comp_dev *dev, struct audio_stream *sink,
 		      const struct audio_stream **sources, uint32_t num_sources,
 		      uint32_t frames)
 {
-	int32_t *src;
-	int32_t *dest;
+	int32_t *src[PLATFORM_MAX_STREAMS];
+	int32_t *dest = sink->w_ptr;
 	int64_t val;
+	int samples;
 	int i;
 	int j;
-	int channel;
-	uint32_t frag = 0;
+	uint32_t n;
 
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < sink->channels; channel++) {
-			val = 0;
+	for (j = 0; j < num_sources; j++)
+		src[j] = sources[j]->r_ptr;
 
-			for (j = 0; j < num_sources; j++) {
-				src = audio_stream_read_frag_s32(sources[j],
-								 frag);
-				val += *src;
-			}
+	while (frames) {
+		n = audio_stream_frames_without_wrap(sink, dest);
+		n = MIN(n, frames);
+		for (j = 0; j < num_sources; j++)
+			n = MIN(n, audio_stream_frames_without_wrap(sources[j],
+								    src[j]));
 
-			dest = audio_stream_write_frag_s32(sink, frag);
+		samples = n * sink->channels;
+		for (i = 0; i < samples; i++) {
+			val = 0;
 
-			/* Saturate to 32 bits */
-			*dest = sat_int32(val);
+			for (j = 0; j < num_sources; j++)
+				val += src[j][i];
 
-			frag++;
+			/* Saturate to 32 bits */
+			dest[i] = sat_int32(val);
 		}
+
+		frames -= n;
+		dest = audio_stream_wrap(sink, dest + samples);
+		for (j = 0; j < num_sources; j++)
+			src[j] = audio_stream_wrap(sources[j], src[j] + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE */
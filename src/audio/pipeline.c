@@ -6,6 +6,7 @@
 //         Keyon Jie <yang.jie@linux.intel.com>
 
 #include <sof/audio/buffer.h>
+#include <sof/audio/comp_profile.h>
 #include <sof/audio/component_ext.h>
 #include <sof/audio/pipeline.h>
 #include <sof/debug/panic.h>
@@ -64,6 +65,8 @@ void pipeline_posn_init(struct sof *sof)
 
 static enum task_state pipeline_task(void *arg);
 static void pipeline_schedule_cancel(struct pipeline *p);
+static int pipeline_copy_list_build(struct pipeline *p);
+static void pipeline_copy_list_free(struct pipeline *p);
 
 /* create new pipeline - returns pipeline id or negative error */
 struct pipeline *pipeline_new(struct sof_ipc_pipe_new *pipe_desc,
@@ -230,6 +233,9 @@ int pipeline_complete(struct pipeline *p, struct comp_dev *source,
 		.comp_func = pipeline_comp_complete,
 		.comp_data = &data,
 	};
+#if CONFIG_PIPELINE_PARTITION
+	int ret;
+#endif
 
 #if !UNIT_TEST && !CONFIG_LIBRARY
 	int freq = clock_get_freq(cpu_get_id());
@@ -253,6 +259,12 @@ int pipeline_complete(struct pipeline *p, struct comp_dev *source,
 	 */
 	walk_ctx.comp_func(source, NULL, &walk_ctx, PPL_DIR_DOWNSTREAM);
 
+#if CONFIG_PIPELINE_PARTITION
+	ret = pipeline_partition(p, source, sink);
+	if (ret < 0)
+		return ret;
+#endif
+
 	p->source_comp = source;
 	p->sink_comp = sink;
 	p->status = COMP_STATE_READY;
@@ -318,6 +330,8 @@ int pipeline_free(struct pipeline *p)
 				   PPL_DIR_DOWNSTREAM);
 	}
 
+	pipeline_copy_list_free(p);
+
 	/* remove from any scheduling */
 	if (p->pipe_task) {
 		schedule_task_free(p->pipe_task);
@@ -604,6 +618,74 @@ static int pipeline_comp_task_init(struct pipeline *p)
 	return 0;
 }
 
+/* Checks whether the copy schedule replaces buffer by a tile of a fused
+ * run, such buffers are bypassed whenever the run is copied in tiles.
+ */
+static bool pipeline_is_fused_link(struct pipeline *p,
+				   struct comp_buffer *buffer)
+{
+	uint32_t i;
+
+	for (i = 0; i < p->copy_count; i++)
+		if (p->copy_list[i].tile &&
+		    buffer->source == p->copy_list[i].comp)
+			return true;
+
+	return false;
+}
+
+/* Let the sink buffer of an in-place capable component share the data area
+ * of its source buffer. The component needs a single source and a single
+ * sink buffer of its pipeline with the same frame format, otherwise the
+ * sink buffer gets its own data area back. Fused runs keep the data
+ * between their components in tiles instead, so their buffers are never
+ * aliased.
+ */
+static int pipeline_comp_inplace(struct comp_dev *current)
+{
+	struct comp_buffer *source;
+	struct comp_buffer *sink;
+	uint32_t sink_size;
+	bool inplace;
+
+	/* data areas can't change under running components */
+	if (current->state != COMP_STATE_READY &&
+	    current->state != COMP_STATE_PREPARE)
+		return 0;
+
+	if (list_is_empty(&current->bsource_list) ||
+	    list_is_empty(&current->bsink_list))
+		return 0;
+
+	source = list_first_item(&current->bsource_list, struct comp_buffer,
+				 sink_list);
+	sink = list_first_item(&current->bsink_list, struct comp_buffer,
+			       source_list);
+	sink_size = sink->alias_src ? sink->alias_size : sink->stream.size;
+
+	inplace = current->inplace &&
+		list_item_is_last(&source->sink_list, &current->bsource_list) &&
+		list_item_is_last(&sink->source_list, &current->bsink_list) &&
+		source->pipeline_id == dev_comp_pipe_id(current) &&
+		sink->pipeline_id == dev_comp_pipe_id(current) &&
+		!source->inter_core && !sink->inter_core &&
+		!source->stream.underrun_permitted &&
+		!source->stream.overrun_permitted &&
+		!sink->stream.underrun_permitted &&
+		!sink->stream.overrun_permitted &&
+		(source->caps & sink->caps) == sink->caps &&
+		source->stream.frame_fmt == sink->stream.frame_fmt &&
+		source->stream.channels == sink->stream.channels &&
+		source->stream.size >= sink_size &&
+		!pipeline_is_fused_link(current->pipeline, source) &&
+		!pipeline_is_fused_link(current->pipeline, sink);
+
+	if (inplace)
+		return buffer_alias(sink, source);
+
+	return buffer_unalias(sink);
+}
+
 static int pipeline_comp_prepare(struct comp_dev *current,
 				 struct comp_buffer *calling_buf,
 				 struct pipeline_walk_context *ctx, int dir)
@@ -641,6 +723,16 @@ static int pipeline_comp_prepare(struct comp_dev *current,
 	if (err < 0)
 		return err;
 
+	if (!current->pipeline->copy_list) {
+		err = pipeline_copy_list_build(current->pipeline);
+		if (err < 0)
+			return err;
+	}
+
+	err = pipeline_comp_inplace(current);
+	if (err < 0)
+		return err;
+
 	err = comp_prepare(current);
 	if (err < 0 || err == PPL_STATUS_PATH_STOP)
 		return err;
@@ -926,6 +1018,13 @@ static int pipeline_comp_reset(struct comp_dev *current,
 	if (err < 0 || err == PPL_STATUS_PATH_STOP)
 		return err;
 
+	/* direction may change with next params, so rebuild the copy list
+	 * of every pipeline reached at its next prepare, unless it still
+	 * runs through a shared component
+	 */
+	if (current->pipeline->status != COMP_STATE_ACTIVE)
+		pipeline_copy_list_free(current->pipeline);
+
 	return pipeline_for_each_comp(current, ctx, dir);
 }
 
@@ -951,54 +1050,179 @@ int pipeline_reset(struct pipeline *p, struct comp_dev *host)
 	return ret;
 }
 
-static int pipeline_comp_copy(struct comp_dev *current,
-			      struct comp_buffer *calling_buf,
-			      struct pipeline_walk_context *ctx, int dir)
+/* copy schedule data used by pipeline_comp_copy_list() */
+struct pipeline_copy_data {
+	struct comp_dev *start;
+	struct pipeline_copy_entry *list;	/* NULL when only counting */
+	uint32_t count;
+};
+
+/* Records components in the order pipeline_copy() has to copy them, which
+ * is the order the former recursive copy walk used: downstream components
+ * are copied before and upstream ones after their neighbours.
+ */
+static int pipeline_comp_copy_list(struct comp_dev *current,
+				   struct comp_buffer *calling_buf,
+				   struct pipeline_walk_context *ctx, int dir)
 {
-	struct pipeline_data *ppl_data = ctx->comp_data;
-	int is_single_ppl = comp_is_single_pipeline(current, ppl_data->start);
+	struct pipeline_copy_data *cp_data = ctx->comp_data;
+	uint32_t first = cp_data->count;
+	uint32_t index = first;
 	int err;
 
-	pipe_dbg(current->pipeline, "pipeline_comp_copy(), current->comp.id = %u, dir = %u",
-		 dev_comp_id(current), dir);
-
-	if (!is_single_ppl) {
-		pipe_dbg(current->pipeline, "pipeline_comp_copy(), current is from another pipeline and can't be scheduled together");
+	if (!comp_is_single_pipeline(current, cp_data->start))
 		return 0;
+
+	if (dir == PPL_DIR_DOWNSTREAM)
+		cp_data->count++;
+
+	err = pipeline_for_each_comp(current, ctx, dir);
+	if (err < 0)
+		return err;
+
+	if (dir == PPL_DIR_UPSTREAM)
+		index = cp_data->count++;
+
+	if (cp_data->list) {
+		cp_data->list[index].comp = current;
+		cp_data->list[index].buffer = calling_buf;
+		cp_data->list[index].subtree = cp_data->count - first - 1;
 	}
 
-	if (!comp_is_active(current)) {
-		pipe_dbg(current->pipeline, "pipeline_comp_copy(), current is not active");
-		return 0;
+	return 0;
+}
+
+static void pipeline_copy_list_free(struct pipeline *p)
+{
+	uint32_t i;
+
+	for (i = 0; i < p->copy_count; i++) {
+		if (!p->copy_list[i].tile)
+			continue;
+
+		rfree(p->copy_list[i].tile->addr);
+		rfree(p->copy_list[i].tile);
 	}
 
-	/* copy to downstream immediately */
-	if (dir == PPL_DIR_DOWNSTREAM) {
-		err = comp_copy(current);
-		if (err < 0 || err == PPL_STATUS_PATH_STOP)
-			return err;
+	rfree(p->copy_list);
+	p->copy_list = NULL;
+	p->copy_count = 0;
+}
+
+/* Returns the buffer between two components that can be copied together
+ * in tiles, NULL if they can't. Both need the process operation, a single
+ * source and a single sink buffer of their pipeline, and the sink of comp
+ * has to be the source of next.
+ */
+static struct comp_buffer *pipeline_fuse_link(struct comp_dev *comp,
+					      struct comp_dev *next)
+{
+	struct comp_dev *dev[2] = { comp, next };
+	struct comp_buffer *source;
+	struct comp_buffer *sink;
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		if (!dev[i]->drv->ops.process || dev[i]->is_shared ||
+		    list_is_empty(&dev[i]->bsource_list) ||
+		    list_is_empty(&dev[i]->bsink_list))
+			return NULL;
+
+		source = list_first_item(&dev[i]->bsource_list,
+					 struct comp_buffer, sink_list);
+		sink = list_first_item(&dev[i]->bsink_list,
+				       struct comp_buffer, source_list);
+
+		if (!list_item_is_last(&source->sink_list,
+				       &dev[i]->bsource_list) ||
+		    !list_item_is_last(&sink->source_list,
+				       &dev[i]->bsink_list) ||
+		    source->pipeline_id != dev_comp_pipe_id(dev[i]) ||
+		    sink->pipeline_id != dev_comp_pipe_id(dev[i]) ||
+		    source->inter_core || sink->inter_core)
+			return NULL;
 	}
 
-	err = pipeline_for_each_comp(current, ctx, dir);
-	if (err < 0 || err == PPL_STATUS_PATH_STOP)
-		return err;
+	sink = list_first_item(&comp->bsink_list, struct comp_buffer,
+			       source_list);
 
-	if (dir == PPL_DIR_UPSTREAM)
-		err = comp_copy(current);
+	return sink->sink == next ? sink : NULL;
+}
 
-	return err;
+/* Gives the entry a tile stream replacing the buffer between the entry and
+ * the next one, its format is taken from the buffer at each fused copy.
+ */
+static int pipeline_fuse_tile(struct pipeline *p,
+			      struct pipeline_copy_entry *entry,
+			      struct comp_buffer *buffer)
+{
+	uint32_t size = PPL_FUSE_TILE_SIZE;
+	void *addr;
+
+	entry->tile = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM,
+			      sizeof(*entry->tile));
+	if (!entry->tile)
+		return -ENOMEM;
+
+	addr = rballoc_align(0, buffer->caps, size, PLATFORM_DCACHE_ALIGN);
+	if (!addr) {
+		pipe_err(p, "pipeline_fuse_tile(): could not alloc size = %u bytes",
+			 size);
+		rfree(entry->tile);
+		entry->tile = NULL;
+		return -ENOMEM;
+	}
+
+	audio_stream_init(entry->tile, addr, size);
+
+	return 0;
 }
 
-/* Copy data across all pipeline components.
- * For capture pipelines it always starts from source component
- * and continues downstream and for playback pipelines it first
- * copies sink component itself and then goes upstream.
+/* Finds runs of components in the copy schedule that can be copied
+ * together in tiles. The schedule is in data flow order in both
+ * directions, so a run is a series of adjacent entries.
  */
-static int pipeline_copy(struct pipeline *p)
+static int pipeline_copy_list_fuse(struct pipeline *p)
 {
-	struct pipeline_data data;
+	struct pipeline_copy_entry *first = NULL;
+	struct pipeline_copy_entry *entry;
+	struct comp_buffer *buffer;
+	uint32_t i;
+	int ret;
+
+	for (i = 0; i + 1 < p->copy_count; i++) {
+		entry = &p->copy_list[i];
+		buffer = pipeline_fuse_link(entry->comp,
+					    p->copy_list[i + 1].comp);
+		if (!buffer) {
+			first = NULL;
+			continue;
+		}
+
+		ret = pipeline_fuse_tile(p, entry, buffer);
+		if (ret < 0)
+			return ret;
+
+		if (!first)
+			first = entry;
+		first->fused++;
+
+		pipe_dbg(p, "pipeline_copy_list_fuse(), comp.id = %u fused with comp.id = %u",
+			 dev_comp_id(first->comp),
+			 dev_comp_id(p->copy_list[i + 1].comp));
+	}
+
+	return 0;
+}
+
+/* Builds flat copy schedule of pipeline, graph is walked twice: first to
+ * count components and then to fill the allocated schedule.
+ */
+static int pipeline_copy_list_build(struct pipeline *p)
+{
+	struct pipeline_copy_data data;
 	struct pipeline_walk_context walk_ctx = {
-		.comp_func = pipeline_comp_copy,
+		.comp_func = pipeline_comp_copy_list,
 		.comp_data = &data,
 		.skip_incomplete = true,
 	};
@@ -1015,16 +1239,238 @@ static int pipeline_copy(struct pipeline *p)
 	}
 
 	data.start = start;
-	data.p = p;
+	data.list = NULL;
+	data.count = 0;
+
+	walk_ctx.comp_func(start, NULL, &walk_ctx, dir);
 
-	ret = walk_ctx.comp_func(start, NULL, &walk_ctx, dir);
+	data.list = rzalloc(SOF_MEM_ZONE_RUNTIME, 0, SOF_MEM_CAPS_RAM,
+			    sizeof(*data.list) * data.count);
+	if (!data.list) {
+		pipe_err(p, "pipeline_copy_list_build(): Out of Memory, count = %u",
+			 data.count);
+		return -ENOMEM;
+	}
+
+	data.count = 0;
+	walk_ctx.comp_func(start, NULL, &walk_ctx, dir);
+
+	p->copy_list = data.list;
+	p->copy_count = data.count;
+	p->copy_dir = dir;
+
+	pipe_dbg(p, "pipeline_copy_list_build(), count = %u, dir = %u",
+		 p->copy_count, p->copy_dir);
+
+	ret = pipeline_copy_list_fuse(p);
 	if (ret < 0)
-		pipe_err(p, "pipeline_copy(): ret = %d, start->comp.id = %u, dir = %u",
-			 ret, dev_comp_id(start), dir);
+		pipeline_copy_list_free(p);
 
 	return ret;
 }
 
+/* Checks the fused entries can be copied together in this period, all of
+ * them have to be active on this core and have nothing left in the buffers
+ * between them from separate copies. The buffers between them are bypassed,
+ * so those with listeners (e.g. probes) need separate copies.
+ */
+static bool pipeline_fused_ready(struct pipeline_copy_entry *first)
+{
+	struct comp_buffer *buffer;
+	uint32_t i;
+
+	for (i = 0; i <= first->fused; i++) {
+		if (!comp_is_active(first[i].comp) ||
+		    !cpu_is_me(first[i].comp->comp.core))
+			return false;
+
+		if (i == first->fused)
+			break;
+
+		buffer = list_first_item(&first[i].comp->bsink_list,
+					 struct comp_buffer, source_list);
+		if (buffer->cb_type ||
+		    audio_stream_get_avail_bytes(&buffer->stream))
+			return false;
+	}
+
+	return true;
+}
+
+/* Sets tile of the entry empty, with the current format of the buffer it
+ * replaces.
+ */
+static void pipeline_fused_tile_reset(struct pipeline_copy_entry *entry)
+{
+	struct audio_stream *tile = entry->tile;
+	struct comp_buffer *buffer;
+
+	buffer = list_first_item(&entry->comp->bsink_list, struct comp_buffer,
+				 source_list);
+
+	tile->frame_fmt = buffer->stream.frame_fmt;
+	tile->rate = buffer->stream.rate;
+	tile->channels = buffer->stream.channels;
+
+	audio_stream_init(tile, tile->addr,
+			  PPL_FUSE_FRAMES * audio_stream_frame_bytes(tile));
+}
+
+/* Copies the fused entries in tiles of PPL_FUSE_FRAMES frames, the data
+ * between the components stays in the small tiles instead of going through
+ * the period sized buffers. The buffers at the ends of the run are updated
+ * once for the whole period. Performance counters and profile of each
+ * component run only while it processes its part of a tile.
+ */
+static int pipeline_fused_copy(struct pipeline *p,
+			       struct pipeline_copy_entry *first)
+{
+	struct pipeline_copy_entry *last = first + first->fused;
+	struct pipeline_copy_entry *entry;
+	struct comp_copy_limits cl;
+	struct comp_buffer *source;
+	struct comp_buffer *sink;
+	struct audio_stream source_stream;
+	struct audio_stream sink_stream;
+	struct audio_stream *in;
+	struct audio_stream *out;
+	uint32_t frames;
+	uint32_t n;
+	int ret;
+
+	source = list_first_item(&first->comp->bsource_list,
+				 struct comp_buffer, sink_list);
+	sink = list_first_item(&last->comp->bsink_list, struct comp_buffer,
+			       source_list);
+
+	comp_get_copy_limits_with_lock(source, sink, &cl);
+	if (!cl.frames)
+		return 0;
+
+	buffer_invalidate(source, cl.source_bytes);
+
+	/* positions of the end buffers advance in the local copies */
+	source_stream = source->stream;
+	sink_stream = sink->stream;
+
+	for (entry = first; entry <= last; entry++) {
+		perf_cnt_init(&entry->comp->pcd);
+		perf_cnt_pause(&entry->comp->pcd);
+		comp_profile_begin(entry->comp, &entry->stamp);
+		comp_profile_pause(&entry->stamp);
+
+		if (entry != last)
+			pipeline_fused_tile_reset(entry);
+	}
+
+	for (frames = cl.frames; frames; frames -= n) {
+		n = MIN(frames, PPL_FUSE_FRAMES);
+		in = &source_stream;
+
+		for (entry = first; entry <= last; entry++) {
+			out = entry == last ? &sink_stream : entry->tile;
+
+			perf_cnt_resume(&entry->comp->pcd);
+			comp_profile_resume(&entry->stamp);
+			ret = comp_process(entry->comp, in, out, n);
+			comp_profile_pause(&entry->stamp);
+			perf_cnt_pause(&entry->comp->pcd);
+			if (ret < 0) {
+				pipe_err(p, "pipeline_fused_copy(): ret = %d, comp->comp.id = %u",
+					 ret, dev_comp_id(entry->comp));
+				return ret;
+			}
+
+			in = out;
+		}
+	}
+
+	for (entry = first; entry <= last; entry++) {
+		out = entry == last ? &sink_stream : entry->tile;
+
+		perf_cnt_resume(&entry->comp->pcd);
+		perf_cnt_stamp(&entry->comp->pcd, comp_perf_info, entry->comp);
+		comp_profile_end_paused(entry->comp, &entry->stamp, cl.frames,
+					out->rate);
+	}
+
+	buffer_writeback(sink, cl.sink_bytes);
+
+	comp_update_buffer_produce(sink, cl.sink_bytes);
+	comp_update_buffer_consume(source, cl.source_bytes);
+
+	return 0;
+}
+
+/* Copy data across all pipeline components.
+ * For capture pipelines it always starts from source component
+ * and continues downstream and for playback pipelines it first
+ * copies sink component itself and then goes upstream.
+ *
+ * Inactive components skip all the entries reached only through them,
+ * same as PPL_STATUS_PATH_STOP returned by downstream copy.
+ */
+static int pipeline_copy(struct pipeline *p)
+{
+	struct pipeline_copy_entry *entry;
+	struct comp_profile_stamp stamp;
+	uint32_t i;
+	uint32_t j;
+	int ret;
+
+	if (p->copy_dir == PPL_DIR_UPSTREAM) {
+		/* upstream entries precede the one they are reached through,
+		 * so resolve inactive branches walking from the end
+		 */
+		i = p->copy_count;
+		while (i > 0) {
+			entry = &p->copy_list[--i];
+			entry->run = comp_is_active(entry->comp);
+			if (entry->run)
+				continue;
+
+			for (j = 0; j < entry->subtree; j++)
+				p->copy_list[--i].run = false;
+		}
+	}
+
+	for (i = 0; i < p->copy_count; i++) {
+		entry = &p->copy_list[i];
+
+		if (p->copy_dir == PPL_DIR_UPSTREAM) {
+			if (!entry->run)
+				continue;
+		} else if (!comp_is_active(entry->comp)) {
+			i += entry->subtree;
+			continue;
+		}
+
+		if (entry->fused && pipeline_fused_ready(entry)) {
+			ret = pipeline_fused_copy(p, entry);
+			if (ret < 0)
+				return ret;
+
+			i += entry->fused;
+			continue;
+		}
+
+		comp_profile_begin(entry->comp, &stamp);
+		ret = comp_copy(entry->comp);
+		comp_profile_end(entry->comp, &stamp);
+		if (ret < 0) {
+			pipe_err(p, "pipeline_copy(): ret = %d, comp->comp.id = %u, dir = %u",
+				 ret, dev_comp_id(entry->comp), p->copy_dir);
+			return ret;
+		}
+
+		if (ret == PPL_STATUS_PATH_STOP &&
+		    p->copy_dir == PPL_DIR_DOWNSTREAM)
+			i += entry->subtree;
+	}
+
+	return 0;
+}
+
 /* Walk the graph to active components in any pipeline to find
  * the first active DAI and return it's timestamp.
  */
@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+/* Pipeline partitioning. A linear pipeline is split into contiguous
+ * segments of processing components, each segment running on its own
+ * core in the LL task of a shared component. Source and sink endpoints
+ * stay on the pipeline core, buffers at the cut points become inter core.
+ */
+
+#include <sof/audio/buffer.h>
+#include <sof/audio/component_ext.h>
+#include <sof/audio/pipeline.h>
+#include <sof/bit.h>
+#include <sof/drivers/ipc.h>
+#include <sof/lib/cache.h>
+#include <sof/lib/cpu.h>
+#include <sof/list.h>
+#include <sof/math/numbers.h>
+#include <ipc/topology.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* longest chain considered, longer pipelines keep the topology placement */
+#define PPL_PART_MAX_COMPS	16
+
+/* load assumed for components whose driver gives no estimate */
+#define PPL_PART_MCPS_DEFAULT	1
+
+/* estimate for 48 kHz stereo, partitioning runs before stream params */
+static uint32_t pipeline_partition_load(struct comp_dev *dev)
+{
+	return dev->drv->mcps ? dev->drv->mcps : PPL_PART_MCPS_DEFAULT;
+}
+
+/* least loaded core of the mask, PLATFORM_CORE_COUNT if mask is empty */
+static uint32_t pipeline_partition_idlest(const uint32_t *core_load,
+					  uint32_t core_mask)
+{
+	uint32_t idlest = PLATFORM_CORE_COUNT;
+	uint32_t i;
+
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++)
+		if ((core_mask & BIT(i)) && (idlest == PLATFORM_CORE_COUNT ||
+					     core_load[i] < core_load[idlest]))
+			idlest = i;
+
+	return idlest;
+}
+
+void pipeline_partition_plan(const uint32_t *load, uint32_t count,
+			     uint32_t *core_load, uint32_t core_mask,
+			     uint32_t core, uint32_t *comp_core)
+{
+	uint32_t start = core;
+	uint32_t used = BIT(core);
+	uint32_t total = 0;
+	uint32_t cores = 0;
+	uint32_t target;
+	uint32_t next;
+	uint32_t i;
+
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
+		if (core_mask & BIT(i)) {
+			total += core_load[i];
+			cores++;
+		}
+	}
+
+	for (i = 0; i < count; i++)
+		total += load[i];
+
+	target = cores ? ceil_divide(total, cores) : total;
+
+	/* fill the current core up to the even share, then continue on
+	 * the least loaded core not visited yet. The chain ends on the
+	 * start core anyway, so it may return there for its last segment.
+	 */
+	for (i = 0; i < count; i++) {
+		if (core_load[core] + load[i] > target) {
+			next = pipeline_partition_idlest(core_load,
+							 (core_mask & ~used) |
+							 (core != start ?
+							  BIT(start) : 0));
+			if (next < PLATFORM_CORE_COUNT &&
+			    core_load[next] < core_load[core]) {
+				core = next;
+				used |= next == start ? core_mask : BIT(next);
+			}
+		}
+
+		comp_core[i] = core;
+		core_load[core] += load[i];
+	}
+}
+
+/* only buffer of a list holding exactly one, NULL otherwise */
+static struct comp_buffer *pipeline_partition_single(struct list_item *list,
+						     int dir)
+{
+	if (list_is_empty(list) || list->next->next != list)
+		return NULL;
+
+	return dir == PPL_DIR_DOWNSTREAM ?
+		list_first_item(list, struct comp_buffer, source_list) :
+		list_first_item(list, struct comp_buffer, sink_list);
+}
+
+/* collects the components from source to sink if they form a chain the
+ * topology left entirely on the pipeline core, returns the count or 0
+ */
+static uint32_t pipeline_partition_chain(struct pipeline *p,
+					 struct comp_dev *source,
+					 struct comp_dev *sink,
+					 struct comp_dev **chain)
+{
+	struct comp_buffer *buffer;
+	struct comp_dev *dev = source;
+	uint32_t count = 0;
+
+	for (;;) {
+		if (count == PPL_PART_MAX_COMPS || dev->is_shared ||
+		    dev->comp.core != p->ipc_pipe.core)
+			return 0;
+
+		chain[count++] = dev;
+		if (dev == sink)
+			return count;
+
+		buffer = pipeline_partition_single(&dev->bsink_list,
+						   PPL_DIR_DOWNSTREAM);
+		if (!buffer || !comp_is_single_pipeline(buffer->sink, source) ||
+		    !pipeline_partition_single(&buffer->sink->bsource_list,
+					       PPL_DIR_UPSTREAM))
+			return 0;
+
+		dev = buffer->sink;
+	}
+}
+
+/* adds load of the components other completed pipelines run to cores */
+static void pipeline_partition_core_load(struct pipeline *p,
+					 uint32_t *core_load)
+{
+	struct ipc *ipc = ipc_get();
+	struct ipc_comp_dev *icd;
+	struct list_item *clist;
+
+	list_for_item(clist, &ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type == COMP_TYPE_COMPONENT &&
+		    icd->core < PLATFORM_CORE_COUNT &&
+		    icd->cd->pipeline && icd->cd->pipeline != p)
+			core_load[icd->core] += pipeline_partition_load(icd->cd);
+	}
+}
+
+/* moves component to another core, its buffers now connect two cores */
+static int pipeline_partition_move(struct comp_dev *dev, uint32_t core)
+{
+	struct ipc_comp_dev *icd = ipc_get_comp_by_id(ipc_get(),
+						      dev_comp_id(dev));
+	struct comp_buffer *buffer;
+	struct list_item *clist;
+
+	if (!icd)
+		return -EINVAL;
+
+	/* the target core reads the private data from memory */
+	comp_writeback_drvdata(dev);
+
+	dev->comp.core = core;
+
+	dev = comp_make_shared(dev);
+	if (!dev)
+		return -ENOMEM;
+
+	/* buffers may still refer to the local address */
+	list_for_item(clist, &dev->bsource_list) {
+		buffer = container_of(clist, struct comp_buffer, sink_list);
+		buffer->sink = dev;
+		buffer->inter_core = true;
+		dcache_writeback_invalidate_region(buffer, sizeof(*buffer));
+	}
+
+	list_for_item(clist, &dev->bsink_list) {
+		buffer = container_of(clist, struct comp_buffer, source_list);
+		buffer->source = dev;
+		buffer->inter_core = true;
+		dcache_writeback_invalidate_region(buffer, sizeof(*buffer));
+	}
+
+	icd->cd = dev;
+	icd->core = core;
+
+	platform_shared_commit(icd, sizeof(*icd));
+
+	return 0;
+}
+
+bool pipeline_partition_core_busy(uint32_t core)
+{
+	struct ipc *ipc = ipc_get();
+	struct ipc_comp_dev *icd;
+	struct list_item *clist;
+
+	list_for_item(clist, &ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type == COMP_TYPE_COMPONENT && icd->core == core &&
+		    icd->cd->pipeline &&
+		    icd->cd->pipeline->ipc_pipe.core != core)
+			return true;
+	}
+
+	return false;
+}
+
+int pipeline_partition(struct pipeline *p, struct comp_dev *source,
+		       struct comp_dev *sink)
+{
+	struct comp_dev *chain[PPL_PART_MAX_COMPS];
+	uint32_t core_load[PLATFORM_CORE_COUNT] = { 0 };
+	uint32_t load[PPL_PART_MAX_COMPS];
+	uint32_t comp_core[PPL_PART_MAX_COMPS];
+	uint32_t core_mask = cpu_enabled_cores();
+	uint32_t core = p->ipc_pipe.core;
+	uint32_t count;
+	uint32_t i;
+	int ret;
+
+	if (!(core_mask & ~BIT(core)))
+		return 0;
+
+	/* endpoints stay, only the processing in between is spread */
+	count = pipeline_partition_chain(p, source, sink, chain);
+	if (count < 3)
+		return 0;
+
+	/* drivers not writing back their private data stay where they are */
+	for (i = 1; i < count - 1; i++)
+		if (!chain[i]->drv->ops.writeback)
+			return 0;
+
+	pipeline_partition_core_load(p, core_load);
+	core_load[core] += pipeline_partition_load(source) +
+		pipeline_partition_load(sink);
+
+	for (i = 1; i < count - 1; i++)
+		load[i - 1] = pipeline_partition_load(chain[i]);
+
+	pipeline_partition_plan(load, count - 2, core_load, core_mask, core,
+				comp_core);
+
+	for (i = 1; i < count - 1; i++) {
+		if (comp_core[i - 1] == core)
+			continue;
+
+		pipe_info(p, "pipeline_partition(): comp %u to core %u",
+			  dev_comp_id(chain[i]), comp_core[i - 1]);
+
+		ret = pipeline_partition_move(chain[i], comp_core[i - 1]);
+		if (ret < 0) {
+			pipe_err(p, "pipeline_partition(): moving comp %u failed",
+				 dev_comp_id(chain[i]));
+			return ret;
+		}
+	}
+
+	return 0;
+}
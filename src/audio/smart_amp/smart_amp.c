@@ -601,7 +601,8 @@ static int smart_amp_copy(struct comp_dev *dev)
 	buffer_lock(sad->feedback_buf, &feedback_flags);
 	if (sad->feedback_buf->source->state == dev->state) {
 		/* feedback */
-		avail_feedback_frames = sad->feedback_buf->stream.avail /
+		avail_feedback_frames =
+			audio_stream_used_bytes(&sad->feedback_buf->stream) /
 			audio_stream_frame_bytes(&sad->feedback_buf->stream);
 
 		avail_frames = MIN(avail_passthrough_frames,
@@ -12,14 +12,17 @@
 #include <sof/audio/pipeline.h>
 #include <sof/audio/src/src.h>
 #include <sof/audio/src/src_config.h>
+#include <sof/audio/src/src_design.h>
 #include <sof/debug/panic.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
+#include <sof/lib/cache.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
 #include <sof/list.h>
 #include <sof/math/numbers.h>
 #include <sof/platform.h>
+#include <sof/spinlock.h>
 #include <sof/string.h>
 #include <sof/ut.h>
 #include <sof/trace/trace.h>
@@ -57,6 +60,27 @@ DECLARE_SOF_RT_UUID("src", src_uuid, 0xc1c5326d, 0x8390, 0x46b4,
 
 DECLARE_TR_CTX(src_tr, SOF_UUID(src_uuid), LOG_LEVEL_INFO);
 
+/* Stage with the coefficients of a symmetric filter expanded in full or
+ * designed at run time, shared by all SRC instances using the same
+ * conversion.
+ */
+struct src_stage_ref {
+	const struct src_stage *table;	/* stage in the conversion tables */
+	int fs_in;			/* rates of a designed conversion */
+	int fs_out;
+	int index;			/* stage of a designed conversion */
+	struct src_stage stage;		/* copy with expanded coefficients */
+	int count;			/* number of users */
+	struct list_item list;
+};
+
+struct src_stage_cache {
+	spinlock_t lock;		/* protects refs */
+	struct list_item refs;		/* list of struct src_stage_ref */
+};
+
+static SHARED_DATA struct src_stage_cache src_stage_cache;
+
 /* src component private data */
 struct comp_data {
 	struct polyphase_src src;
@@ -106,42 +130,15 @@ static int src_find_fs(int fs_list[], int list_length, int fs)
 	return -EINVAL;
 }
 
-/* Calculates buffers to allocate for a SRC mode */
-int src_buffer_lengths(struct src_param *a, int fs_in, int fs_out, int nch,
-		       int source_frames)
+/* Calculates buffers to allocate for the stages of a SRC mode */
+static int src_stage_buffer_lengths(struct src_param *a,
+				    struct src_stage *stage1,
+				    struct src_stage *stage2,
+				    int source_frames)
 {
-	struct src_stage *stage1;
-	struct src_stage *stage2;
+	int nch = a->nch;
 	int r1;
 
-	if (nch > PLATFORM_MAX_CHANNELS) {
-		/* TODO: should be device, not class */
-		comp_cl_err(&comp_src, "src_buffer_lengths(): nch = %u > PLATFORM_MAX_CHANNELS",
-			    nch);
-		return -EINVAL;
-	}
-
-	a->nch = nch;
-	a->idx_in = src_find_fs(src_in_fs, NUM_IN_FS, fs_in);
-	a->idx_out = src_find_fs(src_out_fs, NUM_OUT_FS, fs_out);
-
-	/* Check that both in and out rates are supported */
-	if (a->idx_in < 0 || a->idx_out < 0) {
-		comp_cl_err(&comp_src, "src_buffer_lengths(): rates not supported, fs_in: %u, fs_out: %u",
-			    fs_in, fs_out);
-		return -EINVAL;
-	}
-
-	stage1 = src_table1[a->idx_out][a->idx_in];
-	stage2 = src_table2[a->idx_out][a->idx_in];
-
-	/* Check from stage1 parameter for a deleted in/out rate combination.*/
-	if (stage1->filter_length < 1) {
-		comp_cl_err(&comp_src, "src_buffer_lengths(): Non-supported combination sfs_in = %d, fs_out = %d",
-			    fs_in, fs_out);
-		return -EINVAL;
-	}
-
 	a->fir_s1 = nch * src_fir_delay_length(stage1);
 	a->out_s1 = nch * src_out_delay_length(stage1);
 
@@ -181,12 +178,329 @@ int src_buffer_lengths(struct src_param *a, int fs_in, int fs_out, int nch,
 	return 0;
 }
 
+#if CONFIG_COMP_SRC_DESIGN
+/* Sets stage of a designed filter, coefficients may be left out when only
+ * the dimensions are needed. Designed filters are stored in full.
+ */
+static void src_stage_from_design(struct src_stage *stage,
+				  const struct src_design_stage *d,
+				  const void *coefs, int shift, int cached)
+{
+	struct src_stage design = {
+		.idm = d->idm,
+		.odm = d->odm,
+		.num_of_subfilters = d->l,
+		.subfilter_length = d->subfilter_length,
+		.filter_length = d->filter_length,
+		.blk_in = d->m,
+		.blk_out = d->l,
+		.halfband = 0,
+		.shift = shift,
+		.coefs = coefs,
+		.symmetric = 0,
+		.cached = cached,
+	};
+
+	memcpy_s(stage, sizeof(*stage), &design, sizeof(design));
+}
+
+/* Calculates buffers for a conversion missing from the tables */
+static int src_design_buffer_lengths(struct src_param *a, int source_frames)
+{
+	struct src_design_stage d1;
+	struct src_design_stage d2;
+	struct src_stage stage1;
+	struct src_stage stage2;
+	int ret;
+
+	ret = src_design(a->fs_in, a->fs_out, &d1, &d2);
+	if (ret < 0) {
+		comp_cl_err(&comp_src, "src_design_buffer_lengths(): no design for fs_in: %u, fs_out: %u",
+			    a->fs_in, a->fs_out);
+		return ret;
+	}
+
+	comp_cl_info(&comp_src, "src_design_buffer_lengths(): stage1 %u/%u, %u taps",
+		     d1.l, d1.m, d1.filter_length);
+	comp_cl_info(&comp_src, "src_design_buffer_lengths(): stage2 %u/%u, %u taps",
+		     d2.l, d2.m, d2.filter_length);
+
+	src_stage_from_design(&stage1, &d1, NULL, 0, 0);
+	src_stage_from_design(&stage2, &d2, NULL, 0, 0);
+
+	/* Delay lines have the limits of the compiled in coefficient set */
+	if (src_fir_delay_length(&stage1) > MAX_FIR_DELAY_SIZE ||
+	    src_out_delay_length(&stage1) > MAX_OUT_DELAY_SIZE ||
+	    src_fir_delay_length(&stage2) > MAX_FIR_DELAY_SIZE ||
+	    src_out_delay_length(&stage2) > MAX_OUT_DELAY_SIZE) {
+		comp_cl_err(&comp_src, "src_design_buffer_lengths(): delay lines exceed limits, fs_in: %u, fs_out: %u",
+			    a->fs_in, a->fs_out);
+		return -EINVAL;
+	}
+
+	return src_stage_buffer_lengths(a, &stage1, &stage2, source_frames);
+}
+#else
+static int src_design_buffer_lengths(struct src_param *a, int source_frames)
+{
+	comp_cl_err(&comp_src, "src_buffer_lengths(): rates not supported, fs_in: %u, fs_out: %u",
+		    a->fs_in, a->fs_out);
+	return -EINVAL;
+}
+#endif
+
+/* Calculates buffers to allocate for a SRC mode */
+int src_buffer_lengths(struct src_param *a, int fs_in, int fs_out, int nch,
+		       int source_frames)
+{
+	struct src_stage *stage1;
+	struct src_stage *stage2;
+
+	if (nch > PLATFORM_MAX_CHANNELS) {
+		/* TODO: should be device, not class */
+		comp_cl_err(&comp_src, "src_buffer_lengths(): nch = %u > PLATFORM_MAX_CHANNELS",
+			    nch);
+		return -EINVAL;
+	}
+
+	a->nch = nch;
+	a->fs_in = fs_in;
+	a->fs_out = fs_out;
+	a->idx_in = src_find_fs(src_in_fs, NUM_IN_FS, fs_in);
+	a->idx_out = src_find_fs(src_out_fs, NUM_OUT_FS, fs_out);
+
+	/* Rates missing from the tables are designed if enabled */
+	if (a->idx_in < 0 || a->idx_out < 0)
+		return src_design_buffer_lengths(a, source_frames);
+
+	stage1 = src_table1[a->idx_out][a->idx_in];
+	stage2 = src_table2[a->idx_out][a->idx_in];
+
+	/* Check from stage1 parameter for a deleted in/out rate combination.*/
+	if (stage1->filter_length < 1) {
+		comp_cl_info(&comp_src, "src_buffer_lengths(): Non-supported combination sfs_in = %d, fs_out = %d",
+			     fs_in, fs_out);
+		a->idx_in = -EINVAL;
+		a->idx_out = -EINVAL;
+		return src_design_buffer_lengths(a, source_frames);
+	}
+
+	return src_stage_buffer_lengths(a, stage1, stage2, source_frames);
+}
+
 static void src_state_reset(struct src_state *state)
 {
 	state->fir_delay_size = 0;
 	state->out_delay_size = 0;
 }
 
+/* Fills the second half of the filter by mirroring the first one */
+static void src_stage_expand(void *coefs, const struct src_stage *table)
+{
+#if SRC_SHORT
+	const int16_t *half = table->coefs;
+	int16_t *c = coefs;
+#else
+	const int32_t *half = table->coefs;
+	int32_t *c = coefs;
+#endif
+	int n = table->filter_length;
+	int i;
+
+	for (i = 0; i < (n + 1) >> 1; i++) {
+		c[i] = half[i];
+		c[n - 1 - i] = half[i];
+	}
+}
+
+/* Size of the coefficients of a filter */
+static size_t src_coefs_size(int filter_length)
+{
+	return filter_length * (SRC_SHORT ? sizeof(int16_t) : sizeof(int32_t));
+}
+
+/* Returns cached stage with one more user, NULL if it is not cached. The
+ * table is NULL for designed stages and the rates zero for table stages.
+ */
+static struct src_stage *src_stage_find(struct src_stage_cache *cache,
+					const struct src_stage *table,
+					int fs_in, int fs_out, int index)
+{
+	struct src_stage_ref *ref;
+	struct list_item *rlist;
+
+	list_for_item(rlist, &cache->refs) {
+		ref = container_of(rlist, struct src_stage_ref, list);
+		if (ref->table == table && ref->fs_in == fs_in &&
+		    ref->fs_out == fs_out && ref->index == index) {
+			ref->count++;
+			return &ref->stage;
+		}
+	}
+
+	return NULL;
+}
+
+/* Adds a stage with one user to the cache, the caller fills in the stage
+ * and its coefficients
+ */
+static struct src_stage_ref *src_stage_ref_new(struct src_stage_cache *cache,
+					       int filter_length, void **coefs)
+{
+	struct src_stage_ref *ref;
+
+	ref = rzalloc(SOF_MEM_ZONE_RUNTIME, SOF_MEM_FLAG_SHARED,
+		      SOF_MEM_CAPS_RAM, sizeof(*ref));
+	if (!ref)
+		return NULL;
+
+	*coefs = rballoc_align(0, SOF_MEM_CAPS_RAM,
+			       src_coefs_size(filter_length),
+			       PLATFORM_DCACHE_ALIGN);
+	if (!*coefs) {
+		rfree(ref);
+		return NULL;
+	}
+
+	ref->count = 1;
+	list_item_append(&ref->list, &cache->refs);
+
+	return ref;
+}
+
+/* Returns the stage to process with, tables keep only half of symmetric
+ * filters so they are expanded to the heap while some instance uses them.
+ */
+static struct src_stage *src_stage_get(struct src_stage *table)
+{
+	struct src_stage_cache *cache =
+		platform_shared_get(&src_stage_cache, sizeof(src_stage_cache));
+	struct src_stage_ref *ref;
+	struct src_stage *stage;
+	struct src_stage expanded = {
+		.idm = table->idm,
+		.odm = table->odm,
+		.num_of_subfilters = table->num_of_subfilters,
+		.subfilter_length = table->subfilter_length,
+		.filter_length = table->filter_length,
+		.blk_in = table->blk_in,
+		.blk_out = table->blk_out,
+		.halfband = table->halfband,
+		.shift = table->shift,
+		.symmetric = 0,
+		.cached = 1,
+	};
+	void *coefs;
+
+	if (!table->symmetric)
+		return table;
+
+	spin_lock(&cache->lock);
+
+	stage = src_stage_find(cache, table, 0, 0, 0);
+	if (stage)
+		goto out;
+
+	ref = src_stage_ref_new(cache, table->filter_length, &coefs);
+	if (!ref)
+		goto out;
+
+	src_stage_expand(coefs, table);
+	dcache_writeback_region(coefs, src_coefs_size(table->filter_length));
+
+	expanded.coefs = coefs;
+	memcpy_s(&ref->stage, sizeof(ref->stage), &expanded, sizeof(expanded));
+	ref->table = table;
+	stage = &ref->stage;
+
+out:
+	platform_shared_commit(cache, sizeof(*cache));
+
+	spin_unlock(&cache->lock);
+
+	return stage;
+}
+
+#if CONFIG_COMP_SRC_DESIGN
+/* 1:1 stage of a designed single stage or equal rates conversion */
+static struct src_stage src_design_one = {
+	.num_of_subfilters = 1,
+	.subfilter_length = 1,
+	.filter_length = 1,
+	.blk_in = 1,
+	.blk_out = 1,
+};
+
+/* Returns designed stage, the filter is computed once for all instances
+ * converting between the same rates
+ */
+static struct src_stage *src_stage_get_design(const struct src_design_stage *d,
+					      int fs_in, int fs_out, int index)
+{
+	struct src_stage_cache *cache;
+	struct src_stage_ref *ref;
+	struct src_stage *stage;
+	void *coefs;
+	int shift;
+
+	if (d->filter_length == 1)
+		return &src_design_one;
+
+	cache = platform_shared_get(&src_stage_cache, sizeof(src_stage_cache));
+
+	spin_lock(&cache->lock);
+
+	stage = src_stage_find(cache, NULL, fs_in, fs_out, index);
+	if (stage)
+		goto out;
+
+	ref = src_stage_ref_new(cache, d->filter_length, &coefs);
+	if (!ref)
+		goto out;
+
+	shift = src_design_coefs(d, coefs);
+	dcache_writeback_region(coefs, src_coefs_size(d->filter_length));
+
+	src_stage_from_design(&ref->stage, d, coefs, shift, 1);
+	ref->fs_in = fs_in;
+	ref->fs_out = fs_out;
+	ref->index = index;
+	stage = &ref->stage;
+
+out:
+	platform_shared_commit(cache, sizeof(*cache));
+
+	spin_unlock(&cache->lock);
+
+	return stage;
+}
+#endif
+
+/* Releases a stage from src_stage_get() */
+static void src_stage_put(struct src_stage *stage)
+{
+	struct src_stage_cache *cache;
+	struct src_stage_ref *ref;
+
+	if (!stage || !stage->cached)
+		return;
+
+	cache = platform_shared_get(&src_stage_cache, sizeof(src_stage_cache));
+	ref = container_of(stage, struct src_stage_ref, stage);
+
+	spin_lock(&cache->lock);
+
+	if (!--ref->count) {
+		list_item_del(&ref->list);
+		rfree((void *)ref->stage.coefs);
+		rfree(ref);
+	}
+
+	platform_shared_commit(cache, sizeof(*cache));
+
+	spin_unlock(&cache->lock);
+}
+
 static int init_stages(struct src_stage *stage1, struct src_stage *stage2,
 		       struct polyphase_src *src, struct src_param *p,
 		       int n, int32_t *delay_lines_start)
@@ -255,6 +569,9 @@ static int init_stages(struct src_stage *stage1, struct src_stage *stage2,
 
 void src_polyphase_reset(struct polyphase_src *src)
 {
+	src_stage_put(src->stage1);
+	src_stage_put(src->stage2);
+
 	src->number_of_stages = 0;
 	src->stage1 = NULL;
 	src->stage2 = NULL;
@@ -262,6 +579,51 @@ void src_polyphase_reset(struct polyphase_src *src)
 	src_state_reset(&src->state2);
 }
 
+#if CONFIG_COMP_SRC_DESIGN
+/* Initializes SRC for a conversion designed at run time */
+static int src_polyphase_init_design(struct polyphase_src *src,
+				     struct src_param *p,
+				     int32_t *delay_lines_start)
+{
+	struct src_design_stage d1;
+	struct src_design_stage d2;
+	struct src_stage *stage1;
+	struct src_stage *stage2;
+	int ret;
+
+	/* Release stages of a previous configuration */
+	src_polyphase_reset(src);
+
+	ret = src_design(p->fs_in, p->fs_out, &d1, &d2);
+	if (ret < 0)
+		return ret;
+
+	stage1 = src_stage_get_design(&d1, p->fs_in, p->fs_out, 1);
+	stage2 = src_stage_get_design(&d2, p->fs_in, p->fs_out, 2);
+	if (!stage1 || !stage2) {
+		src_stage_put(stage1);
+		src_stage_put(stage2);
+		return -ENOMEM;
+	}
+
+	ret = init_stages(stage1, stage2, src, p, 2, delay_lines_start);
+	if (ret < 0)
+		return -EINVAL;
+
+	if (p->fs_in == p->fs_out)
+		return 0;
+
+	return stage2->filter_length == 1 ? 1 : 2;
+}
+#else
+static int src_polyphase_init_design(struct polyphase_src *src,
+				     struct src_param *p,
+				     int32_t *delay_lines_start)
+{
+	return -EINVAL;
+}
+#endif
+
 int src_polyphase_init(struct polyphase_src *src, struct src_param *p,
 		       int32_t *delay_lines_start)
 {
@@ -271,11 +633,20 @@ int src_polyphase_init(struct polyphase_src *src, struct src_param *p,
 	int ret;
 
 	if (p->idx_in < 0 || p->idx_out < 0)
-		return -EINVAL;
+		return src_polyphase_init_design(src, p, delay_lines_start);
+
+	/* Release stages of a previous configuration */
+	src_polyphase_reset(src);
 
 	/* Get setup for 2 stage conversion */
-	stage1 = src_table1[p->idx_out][p->idx_in];
-	stage2 = src_table2[p->idx_out][p->idx_in];
+	stage1 = src_stage_get(src_table1[p->idx_out][p->idx_in]);
+	stage2 = src_stage_get(src_table2[p->idx_out][p->idx_in]);
+	if (!stage1 || !stage2) {
+		src_stage_put(stage1);
+		src_stage_put(stage2);
+		return -ENOMEM;
+	}
+
 	ret = init_stages(stage1, stage2, src, p, 2, delay_lines_start);
 	if (ret < 0)
 		return -EINVAL;
@@ -504,6 +875,8 @@ static void src_free(struct comp_dev *dev)
 	if (cd->delay_lines)
 		rfree(cd->delay_lines);
 
+	src_polyphase_reset(&cd->src);
+
 	rfree(cd);
 	rfree(dev);
 }
@@ -905,10 +1278,17 @@ static int src_reset(struct comp_dev *dev)
 	return 0;
 }
 
+static void src_writeback(struct comp_dev *dev)
+{
+	dcache_writeback_region(comp_get_drvdata(dev),
+				sizeof(struct comp_data));
+}
+
 static const struct comp_driver comp_src = {
 	.type = SOF_COMP_SRC,
 	.uid = SOF_RT_UUID(src_uuid),
 	.tctx = &src_tr,
+	.mcps = 20,
 	.ops = {
 		.create = src_new,
 		.free = src_free,
@@ -918,6 +1298,7 @@ static const struct comp_driver comp_src = {
 		.copy = src_copy,
 		.prepare = src_prepare,
 		.reset = src_reset,
+		.writeback = src_writeback,
 	},
 };
 
@@ -927,6 +1308,13 @@ static SHARED_DATA struct comp_driver_info comp_src_info = {
 
 UT_STATIC void sys_comp_src_init(void)
 {
+	struct src_stage_cache *cache =
+		platform_shared_get(&src_stage_cache, sizeof(src_stage_cache));
+
+	spinlock_init(&cache->lock);
+	list_init(&cache->refs);
+	platform_shared_commit(cache, sizeof(*cache));
+
 	comp_register(platform_shared_get(&comp_src_info,
 					  sizeof(comp_src_info)));
 }
@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+/* Run time design of the two stage polyphase SRC. This is a fixed point
+ * version of tools/tune/src/src_factor2_lm.m, src_find_l0m0.m and the
+ * Kaiser window path of src_get.m the coefficient tables are made with.
+ * Instead of growing the filter until the stopband is verified, the order
+ * is taken directly from the Kaiser estimate for 70 dB attenuation.
+ */
+
+#include <sof/audio/src/src.h>
+#include <sof/audio/src/src_config.h>
+#include <sof/audio/src/src_design.h>
+#include <sof/math/numbers.h>
+#include <sof/math/trig.h>
+#include <errno.h>
+#include <stdint.h>
+
+/* Kaiser window beta^2 / 4 as Q12.20, beta = 0.1102 * (70 - 8.7) */
+#define SRC_DESIGN_BETA2_DIV4_Q20	11962558
+
+/* Kaiser order (70 - 7.95) / (2.285 * 2 * pi * df / fs) as a fraction */
+#define SRC_DESIGN_ORDER_NUM		62050
+#define SRC_DESIGN_ORDER_DEN		14357
+
+/* The conversion attenuates 1 dB, split evenly to two stages */
+#define SRC_DESIGN_GAIN_1S_Q30		956973408
+#define SRC_DESIGN_GAIN_2S_Q30		1013677647
+
+/* Largest coefficient 32767/32768 as Q1.31 */
+#define SRC_DESIGN_COEF_MAX		2147418112
+
+/* Subfilter lengths are multiples of four for the filter cores */
+#define SRC_DESIGN_LENGTH_MULT		4
+
+/* Limit for the coefficient scaling shift */
+#define SRC_DESIGN_SHIFT_MAX		24
+
+/* Passband edge, 20 kHz at 44.1 kHz and at most 24 kHz above 80 kHz */
+static int src_design_pb(int fs)
+{
+	return fs > 80000 ? 24000 : (int)((int64_t)fs * 200 / 441);
+}
+
+/* Returns factor of c nearest to its square root */
+static int src_design_factor(int c)
+{
+	int x = 1;
+	int d;
+
+	while ((x + 1) * (x + 1) <= c)
+		x++;
+
+	/* Round the square root to nearest */
+	if (c - x * x > x)
+		x++;
+
+	/* Between x / 2 and 2 * x, the smaller one wins a tie */
+	for (d = 0; d <= x; d++) {
+		if (x - d > 0 && x - d >= x / 2 && c % (x - d) == 0)
+			return x - d;
+
+		if (c % (x + d) == 0)
+			return x + d;
+	}
+
+	return 1;
+}
+
+/* Finds smallest l0 and m0 for -l0 * l + m0 * m == 1 */
+static int src_design_l0m0(int l, int m, int *l0, int *m0)
+{
+	int i;
+
+	if (m == 1) {
+		*l0 = 0;
+		*m0 = 1;
+		return 0;
+	}
+
+	if (l == 1) {
+		*l0 = 1;
+		*m0 = 0;
+		return 0;
+	}
+
+	for (i = 1; i <= 4 * l; i++) {
+		if ((1 + i * l) % m == 0) {
+			*l0 = i;
+			*m0 = (1 + i * l) / m;
+			return 0;
+		}
+	}
+
+	return -EINVAL;
+}
+
+/* Sizes the filter of a stage with input rate fs */
+static int src_design_size_stage(struct src_design_stage *s, int fs, int l,
+				 int m, int f_pb, int32_t gain)
+{
+	int increment = l * SRC_DESIGN_LENGTH_MULT;
+	int64_t order;
+	int ret;
+
+	s->l = l;
+	s->m = m;
+	s->gain = gain;
+
+	if (l == 1 && m == 1) {
+		s->idm = 0;
+		s->odm = 0;
+		s->subfilter_length = 1;
+		s->filter_length = 1;
+		s->fs = fs;
+		s->f_pb = 0;
+		s->f_sb = 0;
+		return 0;
+	}
+
+	if (increment > SRC_DESIGN_MAX_LENGTH)
+		return -EINVAL;
+
+	ret = src_design_l0m0(l, m, &s->idm, &s->odm);
+	if (ret < 0)
+		return ret;
+
+	s->fs = l * fs;
+	s->f_pb = f_pb;
+	s->f_sb = MIN(fs, (int)((int64_t)fs * l / m)) / 2;
+	if (s->f_sb <= s->f_pb)
+		return -EINVAL;
+
+	order = ((int64_t)SRC_DESIGN_ORDER_NUM * s->fs +
+		 (int64_t)SRC_DESIGN_ORDER_DEN * (s->f_sb - s->f_pb) - 1) /
+		((int64_t)SRC_DESIGN_ORDER_DEN * (s->f_sb - s->f_pb));
+	if (order >= SRC_DESIGN_MAX_LENGTH)
+		return -EINVAL;
+
+	s->filter_length = ceil_divide(order + 1, increment) * increment;
+	if (s->filter_length > SRC_DESIGN_MAX_LENGTH)
+		return -EINVAL;
+
+	s->subfilter_length = s->filter_length / l;
+
+	return 0;
+}
+
+int src_design(int fs_in, int fs_out, struct src_design_stage *stage1,
+	       struct src_design_stage *stage2)
+{
+	int fs_min = MIN(fs_in, fs_out);
+	int f_pb = src_design_pb(fs_min);
+	int32_t gain = SRC_DESIGN_GAIN_2S_Q30;
+	int best = -1;
+	int fs_mid;
+	int fl[4];
+	int fm[4];
+	int l1;
+	int m1;
+	int l;
+	int m;
+	int k;
+	int i;
+	int ret;
+
+	if (fs_in <= 0 || fs_out <= 0)
+		return -EINVAL;
+
+	k = gcd(fs_in, fs_out);
+	l = fs_out / k;
+	m = fs_in / k;
+
+	/* Candidate first stages l01/m01, l01/m02, l02/m01 and l02/m02 */
+	fl[0] = src_design_factor(l);
+	fl[1] = fl[0];
+	fl[2] = l / fl[0];
+	fl[3] = fl[2];
+	fm[0] = src_design_factor(m);
+	fm[1] = m / fm[0];
+	fm[2] = fm[0];
+	fm[3] = fm[1];
+
+	/* Don't go below the lower rate between the stages, but as near */
+	for (i = 0; i < 4; i++) {
+		if ((int64_t)fs_in * fl[i] < (int64_t)fs_min * fm[i])
+			continue;
+
+		if (best < 0 ||
+		    (int64_t)fl[i] * fm[best] < (int64_t)fl[best] * fm[i])
+			best = i;
+	}
+
+	if (best < 0)
+		return -EINVAL;
+
+	l1 = fl[best];
+	m1 = fm[best];
+	if (l1 == 1 && m1 == 1) {
+		l1 = l;
+		m1 = m;
+	}
+
+	if (l1 == l && m1 == m)
+		gain = SRC_DESIGN_GAIN_1S_Q30;
+
+	ret = src_design_size_stage(stage1, fs_in, l1, m1, f_pb, gain);
+	if (ret < 0)
+		return ret;
+
+	/* second stage runs at the rate between the stages */
+	fs_mid = (int)(((int64_t)fs_in * l1 + m1 / 2) / m1);
+
+	return src_design_size_stage(stage2, fs_mid, l / l1, m / m1, f_pb,
+				     gain);
+}
+
+/* Modified Bessel function I0(x) for y = (x / 2)^2 as Q12.20, the
+ * result is Q32.32
+ */
+static int64_t src_design_i0(int64_t y)
+{
+	int64_t sum = (int64_t)1 << 32;
+	int64_t term = sum;
+	int k;
+
+	for (k = 1; term > 0; k++) {
+		term = ((term * y) >> 20) / (k * k);
+		sum += term;
+	}
+
+	return sum;
+}
+
+/* Kaiser windowed sinc at u / 2 samples from the filter centre, u is odd.
+ * The result is Q1.31 relative to the sinc envelope at the centre.
+ */
+static int32_t src_design_tap(const struct src_design_stage *s, int u,
+			      int64_t i0_beta)
+{
+	int64_t n1 = s->filter_length - 1;
+	int64_t fs4 = 4 * (int64_t)s->fs;
+	int64_t phase;
+	int64_t frac;
+	int32_t win;
+	int32_t w;
+
+	/* sin(pi * fc * u / fs) with cutoff fc in the transition centre */
+	phase = ((int64_t)(s->f_pb + s->f_sb) * u) % fs4;
+	w = (int32_t)(phase * PI_MUL2_Q4_28 / fs4);
+
+	/* I0(beta * sqrt(1 - (u / n1)^2)) / I0(beta) as Q2.30 */
+	frac = ((n1 * n1 - (int64_t)u * u) << 30) / (n1 * n1);
+	win = (int32_t)((src_design_i0((SRC_DESIGN_BETA2_DIV4_Q20 * frac) >>
+				       30) << 22) / (i0_beta >> 8));
+
+	/* Q1.31 x Q2.30 -> Q3.61 */
+	return (int32_t)(((int64_t)sin_fixed(w) * win / u) >> 30);
+}
+
+int src_design_coefs(const struct src_design_stage *s, void *coefs)
+{
+#if SRC_SHORT
+	int16_t *c = coefs;
+#else
+	int32_t *c = coefs;
+#endif
+	int64_t i0_beta = src_design_i0(SRC_DESIGN_BETA2_DIV4_Q20);
+	int64_t hmax = 0;
+	int64_t sum = 0;
+	int64_t den;
+	int64_t y;
+	int32_t h;
+	int shift;
+	int n;
+	int i;
+
+	/* Symmetric even length filter, taps are computed for the first
+	 * half twice, to get the DC gain and then the scaled values.
+	 */
+	for (n = 0; n < s->filter_length >> 1; n++) {
+		h = src_design_tap(s, s->filter_length - 1 - 2 * n, i0_beta);
+		sum += h;
+		hmax = MAX(hmax, ABS(h));
+	}
+
+	/* Scale to DC gain of l x gain, with the largest power of two that
+	 * keeps coefficients below one
+	 */
+	sum *= 2;
+	hmax *= s->l * (int64_t)s->gain;
+	for (shift = -1; shift < SRC_DESIGN_SHIFT_MAX; shift++) {
+		if (hmax / (sum >> (shift + 2)) > SRC_DESIGN_COEF_MAX)
+			break;
+	}
+
+	den = sum >> (shift + 1);
+
+	/* Tap n goes to subfilter n % l, the reordered filter is symmetric
+	 * as well
+	 */
+	for (n = 0; n < s->filter_length >> 1; n++) {
+		h = src_design_tap(s, s->filter_length - 1 - 2 * n, i0_beta);
+		y = (int64_t)h * s->l * s->gain / den;
+		i = (n % s->l) * s->subfilter_length + n / s->l;
+#if SRC_SHORT
+		c[i] = (int16_t)((y + (1 << 15)) >> 16);
+#else
+		c[i] = (int32_t)y;
+#endif
+		c[s->filter_length - 1 - i] = c[i];
+	}
+
+	return shift;
+}
@@ -14,6 +14,7 @@
 
 #include <sof/audio/format.h>
 #include <sof/audio/src/src.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -222,6 +223,36 @@ static inline void fir_filter_generic(int32_t *rp, const void *cp, int32_t *wp0,
 
 #endif /* 32bit coefficients version */
 
+/* The AVX2 filter core of library build is used when the CPU supports it
+ * and the number of channels fits its vector layout.
+ */
+static inline bool src_use_avx2(int nch)
+{
+#if SOF_X86_SIMD
+	return (nch == 1 || nch == 2 || nch == 4 || nch == 8) &&
+		x86_has_avx2();
+#else
+	return false;
+#endif
+}
+
+static inline void fir_filter(int32_t *rp, const void *cp, int32_t *wp0,
+			      int32_t *fir_start, int32_t *fir_end,
+			      const int fir_delay_length,
+			      const int taps_x_nch, const int shift,
+			      const int nch, const bool avx2)
+{
+#if SOF_X86_SIMD
+	if (avx2) {
+		src_fir_filter_avx2(rp, cp, wp0, fir_start, fir_end,
+				    taps_x_nch, shift, nch);
+		return;
+	}
+#endif
+	fir_filter_generic(rp, cp, wp0, fir_start, fir_end, fir_delay_length,
+			   taps_x_nch, shift, nch);
+}
+
 #if CONFIG_FORMAT_S24LE || CONFIG_FORMAT_S32LE
 void src_polyphase_stage_cir(struct src_stage_prm *s)
 {
@@ -251,6 +282,7 @@ void src_polyphase_stage_cir(struct src_stage_prm *s)
 	const int nch_x_idm = nch * cfg->idm;
 	const size_t fir_size = fir->fir_delay_size * sizeof(int32_t);
 	const int taps_x_nch = cfg->subfilter_length * nch;
+	const bool avx2 = src_use_avx2(nch);
 	int32_t *x_rptr = (int32_t *)s->x_rptr;
 	int32_t *y_wptr = (int32_t *)s->y_wptr;
 	int32_t *x_end_addr = (int32_t *)s->x_end_addr;
@@ -289,9 +321,8 @@ void src_polyphase_stage_cir(struct src_stage_prm *s)
 		src_inc_wrap(&rp, fir_end, fir_size);
 		wp = fir->out_rp;
 		for (i = 0; i < cfg->num_of_subfilters; i++) {
-			fir_filter_generic(rp, cp, wp,
-					   fir_delay, fir_end, fir_length,
-					   taps_x_nch, cfg->shift, nch);
+			fir_filter(rp, cp, wp, fir_delay, fir_end, fir_length,
+				   taps_x_nch, cfg->shift, nch, avx2);
 			wp += nch_x_odm;
 			cp = (char *)cp + subfilter_size;
 			src_inc_wrap(&wp, out_delay_end, out_size);
@@ -352,6 +383,7 @@ void src_polyphase_stage_cir_s16(struct src_stage_prm *s)
 	const int nch_x_idm = nch * cfg->idm;
 	const size_t fir_size = fir->fir_delay_size * sizeof(int32_t);
 	const int taps_x_nch = cfg->subfilter_length * nch;
+	const bool avx2 = src_use_avx2(nch);
 	int16_t *x_rptr = (int16_t *)s->x_rptr;
 	int16_t *y_wptr = (int16_t *)s->y_wptr;
 	int16_t *x_end_addr = (int16_t *)s->x_end_addr;
@@ -390,9 +422,8 @@ void src_polyphase_stage_cir_s16(struct src_stage_prm *s)
 		src_inc_wrap(&rp, fir_end, fir_size);
 		wp = fir->out_rp;
 		for (i = 0; i < cfg->num_of_subfilters; i++) {
-			fir_filter_generic(rp, cp, wp,
-					   fir_delay, fir_end, fir_length,
-					   taps_x_nch, cfg->shift, nch);
+			fir_filter(rp, cp, wp, fir_delay, fir_end, fir_length,
+				   taps_x_nch, cfg->shift, nch, avx2);
 			wp += nch_x_odm;
 			cp = (char *)cp + subfilter_size;
 			src_inc_wrap(&wp, out_delay_end, out_size);
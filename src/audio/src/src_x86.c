@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+/* x86 AVX2 filter core for the host library, the stage functions of the
+ * generic version select it at run time.
+ */
+
+#include <sof/audio/src/src_config.h>
+#include <sof/math/x86_simd.h>
+
+#if SRC_GENERIC && SOF_X86_SIMD
+
+#include <sof/audio/format.h>
+#include <sof/audio/src/src.h>
+#include <immintrin.h>
+#include <stdint.h>
+
+#if SRC_SHORT /* 16 bit coefficients version */
+
+#define SRC_AVX2_QSHIFT	15 /* Q2.46 -> Q2.31 */
+
+static inline int32_t src_avx2_coef(const void *cp, int k)
+{
+	return ((const int16_t *)cp)[k];
+}
+
+static inline X86_TARGET_AVX2 __m128i src_avx2_coef4(const void *cp, int k)
+{
+	return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)
+						  ((const int16_t *)cp + k)));
+}
+
+#else /* 32bit coefficients version */
+
+#define SRC_AVX2_QSHIFT	23 /* Qx.54 -> Qx.31 */
+
+static inline int32_t src_avx2_coef(const void *cp, int k)
+{
+	return ((const int32_t *)cp)[k] >> 8;
+}
+
+static inline X86_TARGET_AVX2 __m128i src_avx2_coef4(const void *cp, int k)
+{
+	return _mm_srai_epi32(_mm_loadu_si128((const __m128i *)
+					      ((const int32_t *)cp + k)), 8);
+}
+
+#endif /* 32bit coefficients version */
+
+static inline X86_TARGET_AVX2 __m256i src_avx2_mac(__m256i acc, __m256i c,
+						   const int32_t *data)
+{
+	__m256i d = _mm256_cvtepi32_epi64
+		(_mm_loadu_si128((const __m128i *)data));
+
+	return _mm256_add_epi64(acc, _mm256_mul_epi32(c, d));
+}
+
+/* Filter a run of elems contiguous delay line words that start from
+ * a frame boundary with coefficients from index k. Four words are
+ * processed at a time to the 64 bit lanes of acc[], the words that do
+ * not fill a vector are added to y[].
+ */
+static X86_TARGET_AVX2 void src_avx2_run(const int32_t *data, const void *cp,
+					 int k, int elems, int nch,
+					 __m256i acc[], int64_t y[])
+{
+	__m256i c;
+	int64_t c0;
+	int64_t c1;
+	int e = 0;
+
+	switch (nch) {
+	case 1:
+		for (; e + 4 <= elems; e += 4) {
+			c = _mm256_cvtepi32_epi64(src_avx2_coef4(cp, k + e));
+			acc[0] = src_avx2_mac(acc[0], c, data + e);
+		}
+		break;
+	case 2:
+		for (; e + 4 <= elems; e += 4) {
+			c0 = src_avx2_coef(cp, k + (e >> 1));
+			c1 = src_avx2_coef(cp, k + (e >> 1) + 1);
+			c = _mm256_set_epi64x(c1, c1, c0, c0);
+			acc[0] = src_avx2_mac(acc[0], c, data + e);
+		}
+		break;
+	case 4:
+		for (; e < elems; e += 4) {
+			c = _mm256_set1_epi64x(src_avx2_coef(cp, k + (e >> 2)));
+			acc[0] = src_avx2_mac(acc[0], c, data + e);
+		}
+		break;
+	default:
+		for (; e < elems; e += 8) {
+			c = _mm256_set1_epi64x(src_avx2_coef(cp, k + (e >> 3)));
+			acc[0] = src_avx2_mac(acc[0], c, data + e);
+			acc[1] = src_avx2_mac(acc[1], c, data + e + 4);
+		}
+		break;
+	}
+
+	/* Channels are in reverse order in the delay line */
+	for (; e < elems; e++)
+		y[nch - 1 - e % nch] +=
+			(int64_t)src_avx2_coef(cp, k + e / nch) * data[e];
+}
+
+X86_TARGET_AVX2 void src_fir_filter_avx2(int32_t *rp, const void *cp,
+					 int32_t *wp, int32_t *fir_start,
+					 int32_t *fir_end, const int taps_x_nch,
+					 const int shift, const int nch)
+{
+	__m256i acc[2];
+	int64_t a[2][4];
+	int64_t y[8];
+	const int qshift = SRC_AVX2_QSHIFT + shift;
+	int32_t *data = rp - (nch - 1); /* Frame start */
+	int frames = fir_end - data; /* Words until wrap */
+	int n1 = (taps_x_nch < frames) ? taps_x_nch : frames;
+	int n2 = taps_x_nch - n1;
+	int j;
+	int m;
+
+	/* Initialize to half LSB for rounding */
+	for (j = 0; j < nch; j++)
+		y[j] = (int64_t)1 << (qshift - 1);
+
+	acc[0] = _mm256_setzero_si256();
+	acc[1] = _mm256_setzero_si256();
+	src_avx2_run(data, cp, 0, n1, nch, acc, y);
+	if (n2)
+		src_avx2_run(fir_start, cp, n1 / nch, n2, nch, acc, y);
+
+	_mm256_storeu_si256((__m256i *)a[0], acc[0]);
+	_mm256_storeu_si256((__m256i *)a[1], acc[1]);
+	for (m = 0; m < 4; m++) {
+		y[nch - 1 - m % nch] += a[0][m];
+		if (nch == 8)
+			y[3 - m] += a[1][m];
+	}
+
+	for (j = 0; j < nch; j++)
+		wp[j] = sat_int32(y[j] >> qshift);
+}
+
+#endif
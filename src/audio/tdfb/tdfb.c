@@ -13,6 +13,7 @@
 #include <sof/debug/panic.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
+#include <sof/lib/cache.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
 #include <sof/list.h>
@@ -522,9 +523,18 @@ static int tdfb_trigger(struct comp_dev *dev, int cmd)
 	return ret;
 }
 
+static void tdfb_writeback(struct comp_dev *dev)
+{
+	struct tdfb_comp_data *cd = comp_get_drvdata(dev);
+
+	comp_data_blob_writeback(cd->model_handler);
+	dcache_writeback_region(cd, sizeof(*cd));
+}
+
 static const struct comp_driver comp_tdfb = {
 	.uid = SOF_RT_UUID(tdfb_uuid),
 	.tctx	= &tdfb_tr,
+	.mcps	= 25,
 	.ops = {
 		.create = tdfb_new,
 		.free = tdfb_free,
@@ -533,6 +543,7 @@ static const struct comp_driver comp_tdfb = {
 		.prepare = tdfb_prepare,
 		.reset = tdfb_reset,
 		.trigger = tdfb_trigger,
+		.writeback = tdfb_writeback,
 	},
 };
 
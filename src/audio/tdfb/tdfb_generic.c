@@ -57,8 +57,9 @@ void tdfb_fir_s16(struct tdfb_comp_data *cd,
 			 * two samples per call. The output is stored as Q5.27
 			 * to fit max. 16 filters sum to a channel.
 			 */
-			y0 = fir_32x16(filter, cd->in[is]) >> 4;
-			y1 = fir_32x16(filter, cd->in[is2]) >> 4;
+			fir_32x16_2x(filter, cd->in[is], cd->in[is2], &y0, &y1);
+			y0 >>= 4;
+			y1 >>= 4;
 			for (k = 0; k < out_nch; k++) {
 				if (om & 1) {
 					cd->out[k] += y0;
@@ -120,8 +121,9 @@ void tdfb_fir_s24(struct tdfb_comp_data *cd,
 			 * two samples per call. The output is stored as Q5.27
 			 * to fit max. 16 filters sum to a channel.
 			 */
-			y0 = fir_32x16(filter, cd->in[is]) >> 4;
-			y1 = fir_32x16(filter, cd->in[is2]) >> 4;
+			fir_32x16_2x(filter, cd->in[is], cd->in[is2], &y0, &y1);
+			y0 >>= 4;
+			y1 >>= 4;
 			for (k = 0; k < out_nch; k++) {
 				if (om & 1) {
 					cd->out[k] += y0;
@@ -183,8 +185,9 @@ void tdfb_fir_s32(struct tdfb_comp_data *cd,
 			 * two samples per call. The output is stored as Q5.27
 			 * to fit max. 16 filters sum to a channel.
 			 */
-			y0 = fir_32x16(filter, cd->in[is]) >> 4;
-			y1 = fir_32x16(filter, cd->in[is2]) >> 4;
+			fir_32x16_2x(filter, cd->in[is], cd->in[is2], &y0, &y1);
+			y0 >>= 4;
+			y1 >>= 4;
 			for (k = 0; k < out_nch; k++) {
 				if (om & 1) {
 					cd->out[k] += y0;
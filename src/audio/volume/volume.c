@@ -22,6 +22,7 @@
 #include <sof/debug/panic.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
+#include <sof/lib/cache.h>
 #include <sof/lib/cpu.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
@@ -378,6 +379,9 @@ static struct comp_dev *volume_new(const struct comp_driver *drv,
 		  vol->initial_ramp, vol->ramp,
 		  vol->min_value, vol->max_value);
 
+	/* samples can be scaled in place, see pipeline_comp_inplace() */
+	dev->inplace = true;
+
 	dev->state = COMP_STATE_READY;
 	return dev;
 }
@@ -697,6 +701,50 @@ static int volume_trigger(struct comp_dev *dev, int cmd)
 	return comp_set_state(dev, cmd);
 }
 
+/**
+ * \brief Gets the number of frames to process before the next volume update.
+ * \param[in,out] dev Volume base component device.
+ * \param[in] source Source stream.
+ * \param[in] frames Number of frames available for processing.
+ * \param[in,out] prev_sum Previous sum of channel samples.
+ * \return Number of frames.
+ */
+static uint32_t volume_chunk_frames(struct comp_dev *dev,
+				    const struct audio_stream *source,
+				    uint32_t frames, int64_t *prev_sum)
+{
+	struct sof_ipc_comp_volume *pga =
+		COMP_GET_IPC(dev, sof_ipc_comp_volume);
+	struct comp_data *cd = comp_get_drvdata(dev);
+
+	/* without ramping process all at once */
+	if (cd->ramp_finished || cd->vol_ramp_frames > frames)
+		return frames;
+
+	/* with ZC ramping look for next ZC offset */
+	if (pga->ramp == SOF_VOLUME_LINEAR_ZC)
+		return cd->zc_get(source, cd->vol_ramp_frames, prev_sum);
+
+	/* without ZC process max ramp chunk */
+	return cd->vol_ramp_frames;
+}
+
+/**
+ * \brief Updates the volume ramp after processing frames.
+ * \param[in,out] dev Volume base component device.
+ * \param[in] frames Number of processed frames.
+ */
+static void volume_chunk_done(struct comp_dev *dev, uint32_t frames)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+
+	if (cd->vol_ramp_active)
+		cd->vol_ramp_elapsed_frames += frames;
+
+	if (!cd->ramp_finished)
+		volume_ramp(dev);
+}
+
 /**
  * \brief Copies and processes stream data.
  * \param[in,out] dev Volume base component device.
@@ -704,8 +752,6 @@ static int volume_trigger(struct comp_dev *dev, int cmd)
  */
 static int volume_copy(struct comp_dev *dev)
 {
-	struct sof_ipc_comp_volume *pga =
-		COMP_GET_IPC(dev, sof_ipc_comp_volume);
 	struct comp_copy_limits c;
 	struct comp_data *cd = comp_get_drvdata(dev);
 	struct comp_buffer *source;
@@ -729,17 +775,8 @@ static int volume_copy(struct comp_dev *dev)
 		 c.source_bytes, c.sink_bytes);
 
 	while (c.frames) {
-		if (cd->ramp_finished || cd->vol_ramp_frames > c.frames) {
-			/* without ramping process all at once */
-			frames = c.frames;
-		} else if (pga->ramp == SOF_VOLUME_LINEAR_ZC) {
-			/* with ZC ramping look for next ZC offset */
-			frames = cd->zc_get(&source->stream,
-					    cd->vol_ramp_frames, &prev_sum);
-		} else {
-			/* without ZC process max ramp chunk */
-			frames = cd->vol_ramp_frames;
-		}
+		frames = volume_chunk_frames(dev, &source->stream, c.frames,
+					     &prev_sum);
 
 		source_bytes = frames * c.source_frame_bytes;
 		sink_bytes = frames * c.sink_frame_bytes;
@@ -753,11 +790,7 @@ static int volume_copy(struct comp_dev *dev)
 		comp_update_buffer_produce(sink, sink_bytes);
 		comp_update_buffer_consume(source, source_bytes);
 
-		if (cd->vol_ramp_active)
-			cd->vol_ramp_elapsed_frames += frames;
-
-		if (!cd->ramp_finished)
-			volume_ramp(dev);
+		volume_chunk_done(dev, frames);
 
 		c.frames -= frames;
 	}
@@ -765,6 +798,42 @@ static int volume_copy(struct comp_dev *dev)
 	return 0;
 }
 
+/**
+ * \brief Processes frames of a fused component chain.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] source Source stream.
+ * \param[in,out] sink Sink stream.
+ * \param[in] frames Number of frames to process.
+ * \return Error code.
+ *
+ * Same as volume_copy() without the buffer bookkeeping. While ramping the
+ * volume is updated at least once per call.
+ */
+static int volume_process(struct comp_dev *dev, struct audio_stream *source,
+			  struct audio_stream *sink, uint32_t frames)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	uint32_t source_frame_bytes = audio_stream_frame_bytes(source);
+	uint32_t sink_frame_bytes = audio_stream_frame_bytes(sink);
+	uint32_t n;
+	int64_t prev_sum = 0;
+
+	while (frames) {
+		n = volume_chunk_frames(dev, source, frames, &prev_sum);
+
+		cd->scale_vol(dev, sink, source, n);
+
+		audio_stream_produce(sink, n * sink_frame_bytes);
+		audio_stream_consume(source, n * source_frame_bytes);
+
+		volume_chunk_done(dev, n);
+
+		frames -= n;
+	}
+
+	return 0;
+}
+
 /**
  * \brief Retrieves volume zero crossing function.
  * \param[in,out] dev Volume base component device.
@@ -909,6 +978,16 @@ static int volume_reset(struct comp_dev *dev)
 	return 0;
 }
 
+/**
+ * \brief Writes back volume private data before moving to another core.
+ * \param[in,out] dev Volume base component device.
+ */
+static void volume_writeback(struct comp_dev *dev)
+{
+	dcache_writeback_region(comp_get_drvdata(dev),
+				sizeof(struct comp_data));
+}
+
 /** \brief Volume component definition. */
 static const struct comp_driver comp_volume = {
 	.type	= SOF_COMP_VOLUME,
@@ -920,8 +999,10 @@ static const struct comp_driver comp_volume = {
 		.cmd		= volume_cmd,
 		.trigger	= volume_trigger,
 		.copy		= volume_copy,
+		.process	= volume_process,
 		.prepare	= volume_prepare,
 		.reset		= volume_reset,
+		.writeback	= volume_writeback,
 	},
 };
 
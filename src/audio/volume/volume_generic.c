@@ -55,22 +55,32 @@ static void vol_s24_to_s24(struct comp_dev *dev, struct audio_stream *sink,
 			   const struct audio_stream *source, uint32_t frames)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
+	int32_t *x = source->r_ptr;
+	int32_t *y = sink->w_ptr;
 	int32_t *src;
 	int32_t *dest;
-	int32_t i;
-	uint32_t channel;
-	uint32_t buff_frag = 0;
+	int32_t vol;
+	int nch = sink->channels;
+	int samples;
+	int channel;
+	int i;
+	uint32_t n;
 
 	/* Samples are Q1.23 --> Q1.23 and volume is Q8.16 */
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < sink->channels; channel++) {
-			src = audio_stream_read_frag_s32(source, buff_frag);
-			dest = audio_stream_write_frag_s32(sink, buff_frag);
-
-			*dest = vol_mult_s24_to_s24(*src, cd->volume[channel]);
-
-			buff_frag++;
+	while (frames) {
+		n = audio_stream_span_frames(source, x, sink, y, frames);
+		samples = n * nch;
+		for (channel = 0; channel < nch; channel++) {
+			vol = cd->volume[channel];
+			src = x + channel;
+			dest = y + channel;
+			for (i = 0; i < samples; i += nch)
+				dest[i] = vol_mult_s24_to_s24(src[i], vol);
 		}
+
+		frames -= n;
+		x = audio_stream_wrap(source, x + samples);
+		y = audio_stream_wrap(sink, y + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S24LE */
@@ -90,24 +100,34 @@ static void vol_s32_to_s32(struct comp_dev *dev, struct audio_stream *sink,
 			   const struct audio_stream *source, uint32_t frames)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
+	int32_t *x = source->r_ptr;
+	int32_t *y = sink->w_ptr;
 	int32_t *src;
 	int32_t *dest;
-	int32_t i;
-	uint32_t channel;
-	uint32_t buff_frag = 0;
+	int32_t vol;
+	int nch = sink->channels;
+	int samples;
+	int channel;
+	int i;
+	uint32_t n;
 
 	/* Samples are Q1.31 --> Q1.31 and volume is Q8.16 */
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < sink->channels; channel++) {
-			src = audio_stream_read_frag_s32(source, buff_frag);
-			dest = audio_stream_write_frag_s32(sink, buff_frag);
-
-			*dest = q_multsr_sat_32x32
-				(*src, cd->volume[channel],
-				 Q_SHIFT_BITS_64(31, 16, 31));
-
-			buff_frag++;
+	while (frames) {
+		n = audio_stream_span_frames(source, x, sink, y, frames);
+		samples = n * nch;
+		for (channel = 0; channel < nch; channel++) {
+			vol = cd->volume[channel];
+			src = x + channel;
+			dest = y + channel;
+			for (i = 0; i < samples; i += nch)
+				dest[i] = q_multsr_sat_32x32
+					(src[i], vol,
+					 Q_SHIFT_BITS_64(31, 16, 31));
 		}
+
+		frames -= n;
+		x = audio_stream_wrap(source, x + samples);
+		y = audio_stream_wrap(sink, y + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S32LE */
@@ -127,24 +147,34 @@ static void vol_s16_to_s16(struct comp_dev *dev, struct audio_stream *sink,
 			   const struct audio_stream *source, uint32_t frames)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
+	int16_t *x = source->r_ptr;
+	int16_t *y = sink->w_ptr;
 	int16_t *src;
 	int16_t *dest;
-	int32_t i;
-	uint32_t channel;
-	uint32_t buff_frag = 0;
+	int32_t vol;
+	int nch = sink->channels;
+	int samples;
+	int channel;
+	int i;
+	uint32_t n;
 
 	/* Samples are Q1.15 --> Q1.15 and volume is Q8.16 */
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < sink->channels; channel++) {
-			src = audio_stream_read_frag_s16(source, buff_frag);
-			dest = audio_stream_write_frag_s16(sink, buff_frag);
-
-			*dest = q_multsr_sat_32x32_16
-				(*src, cd->volume[channel],
-				 Q_SHIFT_BITS_32(15, 16, 15));
-
-			buff_frag++;
+	while (frames) {
+		n = audio_stream_span_frames(source, x, sink, y, frames);
+		samples = n * nch;
+		for (channel = 0; channel < nch; channel++) {
+			vol = cd->volume[channel];
+			src = x + channel;
+			dest = y + channel;
+			for (i = 0; i < samples; i += nch)
+				dest[i] = q_multsr_sat_32x32_16
+					(src[i], vol,
+					 Q_SHIFT_BITS_32(15, 16, 15));
 		}
+
+		frames -= n;
+		x = audio_stream_wrap(source, x + samples);
+		y = audio_stream_wrap(sink, y + samples);
 	}
 }
 #endif /* CONFIG_FORMAT_S16LE */
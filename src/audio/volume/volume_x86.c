@@ -0,0 +1,300 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+/**
+ * \file audio/volume_x86.c
+ * \brief Volume x86 AVX2 processing implementation for the host library
+ */
+
+#include <sof/audio/volume.h>
+#include <sof/math/x86_simd.h>
+
+#if SOF_X86_SIMD
+
+#include <sof/audio/buffer.h>
+#include <sof/audio/component.h>
+#include <sof/audio/format.h>
+#include <sof/common.h>
+#include <ipc/stream.h>
+#include <immintrin.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** \brief Number of samples in one AVX2 vector. */
+#define VOL_AVX2_LANES	8
+
+/** \brief Length of the repeating per-sample gain pattern. */
+#define VOL_AVX2_GAINS	(VOL_AVX2_LANES * SOF_IPC_MAX_CHANNELS)
+
+/**
+ * \brief Expands the channel gains to a per-sample gain pattern.
+ * \param[in] cd Volume component private data.
+ * \param[out] gain Gain pattern of nch vectors.
+ * \param[in] nch Number of channels.
+ *
+ * The pattern period of nch vectors is a multiple of both the vector
+ * length and the frame length, so a span that starts from a frame
+ * boundary can step through the pattern one vector at a time.
+ */
+static void vol_avx2_gains(const struct comp_data *cd, int32_t *gain, int nch)
+{
+	int i;
+
+	for (i = 0; i < VOL_AVX2_LANES * nch; i++)
+		gain[i] = cd->volume[i % nch];
+}
+
+/**
+ * \brief Multiplies eight samples with gains and rounds the products.
+ * \param[in] x Q1.31 aligned input samples.
+ * \param[in] g Q8.16 gains.
+ * \param[out] even Rounded products of the even lanes.
+ * \param[out] odd Rounded products of the odd lanes.
+ *
+ * Returns x * g + 2^15 in 64 bits, so the 16 bit right shift of the
+ * results matches q_multsr_sat_32x32() with 16 shift bits.
+ */
+static inline X86_TARGET_AVX2 void vol_avx2_mult(__m256i x, __m256i g,
+						 __m256i *even, __m256i *odd)
+{
+	const __m256i rnd = _mm256_set1_epi64x(1 << 15);
+
+	*even = _mm256_add_epi64(_mm256_mul_epi32(x, g), rnd);
+	*odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(x, 32),
+						 _mm256_srli_epi64(g, 32)),
+				rnd);
+}
+
+/**
+ * \brief Packs the rounded products back to eight 32 bit samples.
+ * \param[in] even Rounded products of the even lanes.
+ * \param[in] odd Rounded products of the odd lanes.
+ * \return Low 32 bits of the products shifted right by 16.
+ */
+static inline X86_TARGET_AVX2 __m256i vol_avx2_pack(__m256i even, __m256i odd)
+{
+	return _mm256_blend_epi32(_mm256_srli_epi64(even, 16),
+				  _mm256_slli_epi64(odd, 16), 0xaa);
+}
+
+#if CONFIG_FORMAT_S24LE
+/**
+ * \brief AVX2 volume processing from 24/32 bit to 24/32 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static X86_TARGET_AVX2 void vol_s24_to_s24_avx2(struct comp_dev *dev,
+						struct audio_stream *sink,
+						const struct audio_stream *source,
+						uint32_t frames)
+{
+	const __m256i max = _mm256_set1_epi32(INT24_MAXVALUE);
+	const __m256i min = _mm256_set1_epi32(INT24_MINVALUE);
+	struct comp_data *cd = comp_get_drvdata(dev);
+	int32_t gain[VOL_AVX2_GAINS];
+	int32_t *x = source->r_ptr;
+	int32_t *y = sink->w_ptr;
+	__m256i even;
+	__m256i odd;
+	__m256i v;
+	int nch = sink->channels;
+	int period = VOL_AVX2_LANES * nch;
+	int samples;
+	int g;
+	int i;
+	uint32_t n;
+
+	vol_avx2_gains(cd, gain, nch);
+
+	/* Samples are Q1.23 --> Q1.23 and volume is Q8.16 */
+	while (frames) {
+		n = audio_stream_span_frames(source, x, sink, y, frames);
+		samples = n * nch;
+		g = 0;
+		for (i = 0; i + VOL_AVX2_LANES <= samples;
+		     i += VOL_AVX2_LANES) {
+			v = _mm256_loadu_si256((const __m256i *)(x + i));
+			v = _mm256_srai_epi32(_mm256_slli_epi32(v, 8), 8);
+			vol_avx2_mult(v, _mm256_loadu_si256((__m256i *)
+							    (gain + g)),
+				      &even, &odd);
+			v = vol_avx2_pack(even, odd);
+			v = _mm256_max_epi32(_mm256_min_epi32(v, max), min);
+			_mm256_storeu_si256((__m256i *)(y + i), v);
+
+			g += VOL_AVX2_LANES;
+			if (g == period)
+				g = 0;
+		}
+
+		for (; i < samples; i++, g++)
+			y[i] = q_multsr_sat_32x32_24(sign_extend_s24(x[i]),
+						     gain[g],
+						     Q_SHIFT_BITS_64(23, 16,
+								     23));
+
+		frames -= n;
+		x = audio_stream_wrap(source, x + samples);
+		y = audio_stream_wrap(sink, y + samples);
+	}
+}
+#endif /* CONFIG_FORMAT_S24LE */
+
+#if CONFIG_FORMAT_S32LE
+/**
+ * \brief Saturates the rounded products to the 32 bit output range.
+ * \param[in] q Rounded products.
+ * \return Products clamped so the 16 bit right shift fits 32 bits.
+ */
+static inline X86_TARGET_AVX2 __m256i vol_avx2_sat32(__m256i q)
+{
+	const __m256i max = _mm256_set1_epi64x((int64_t)INT32_MAX << 16);
+	const __m256i min = _mm256_set1_epi64x((int64_t)INT32_MIN * 65536);
+
+	q = _mm256_blendv_epi8(q, max, _mm256_cmpgt_epi64(q, max));
+	return _mm256_blendv_epi8(q, min, _mm256_cmpgt_epi64(min, q));
+}
+
+/**
+ * \brief AVX2 volume processing from 32 bit to 32 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static X86_TARGET_AVX2 void vol_s32_to_s32_avx2(struct comp_dev *dev,
+						struct audio_stream *sink,
+						const struct audio_stream *source,
+						uint32_t frames)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	int32_t gain[VOL_AVX2_GAINS];
+	int32_t *x = source->r_ptr;
+	int32_t *y = sink->w_ptr;
+	__m256i even;
+	__m256i odd;
+	__m256i v;
+	int nch = sink->channels;
+	int period = VOL_AVX2_LANES * nch;
+	int samples;
+	int g;
+	int i;
+	uint32_t n;
+
+	vol_avx2_gains(cd, gain, nch);
+
+	/* Samples are Q1.31 --> Q1.31 and volume is Q8.16 */
+	while (frames) {
+		n = audio_stream_span_frames(source, x, sink, y, frames);
+		samples = n * nch;
+		g = 0;
+		for (i = 0; i + VOL_AVX2_LANES <= samples;
+		     i += VOL_AVX2_LANES) {
+			v = _mm256_loadu_si256((const __m256i *)(x + i));
+			vol_avx2_mult(v, _mm256_loadu_si256((__m256i *)
+							    (gain + g)),
+				      &even, &odd);
+			v = vol_avx2_pack(vol_avx2_sat32(even),
+					  vol_avx2_sat32(odd));
+			_mm256_storeu_si256((__m256i *)(y + i), v);
+
+			g += VOL_AVX2_LANES;
+			if (g == period)
+				g = 0;
+		}
+
+		for (; i < samples; i++, g++)
+			y[i] = q_multsr_sat_32x32(x[i], gain[g],
+						  Q_SHIFT_BITS_64(31, 16, 31));
+
+		frames -= n;
+		x = audio_stream_wrap(source, x + samples);
+		y = audio_stream_wrap(sink, y + samples);
+	}
+}
+#endif /* CONFIG_FORMAT_S32LE */
+
+#if CONFIG_FORMAT_S16LE
+/**
+ * \brief AVX2 volume processing from 16 bit to 16 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static X86_TARGET_AVX2 void vol_s16_to_s16_avx2(struct comp_dev *dev,
+						struct audio_stream *sink,
+						const struct audio_stream *source,
+						uint32_t frames)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	int32_t gain[VOL_AVX2_GAINS];
+	int16_t *x = source->r_ptr;
+	int16_t *y = sink->w_ptr;
+	__m256i even;
+	__m256i odd;
+	__m256i v;
+	int nch = sink->channels;
+	int period = VOL_AVX2_LANES * nch;
+	int samples;
+	int g;
+	int i;
+	uint32_t n;
+
+	vol_avx2_gains(cd, gain, nch);
+
+	/* Samples are Q1.15 --> Q1.15 and volume is Q8.16 */
+	while (frames) {
+		n = audio_stream_span_frames(source, x, sink, y, frames);
+		samples = n * nch;
+		g = 0;
+		for (i = 0; i + VOL_AVX2_LANES <= samples;
+		     i += VOL_AVX2_LANES) {
+			v = _mm256_cvtepi16_epi32
+				(_mm_loadu_si128((const __m128i *)(x + i)));
+			vol_avx2_mult(v, _mm256_loadu_si256((__m256i *)
+							    (gain + g)),
+				      &even, &odd);
+			v = vol_avx2_pack(even, odd);
+
+			/* saturating pack, lanes 0..3 and 4..7 to low half */
+			v = _mm256_permute4x64_epi64(_mm256_packs_epi32(v, v),
+						     0x08);
+			_mm_storeu_si128((__m128i *)(y + i),
+					 _mm256_castsi256_si128(v));
+
+			g += VOL_AVX2_LANES;
+			if (g == period)
+				g = 0;
+		}
+
+		for (; i < samples; i++, g++)
+			y[i] = q_multsr_sat_32x32_16(x[i], gain[g],
+						     Q_SHIFT_BITS_32(15, 16,
+								     15));
+
+		frames -= n;
+		x = audio_stream_wrap(source, x + samples);
+		y = audio_stream_wrap(sink, y + samples);
+	}
+}
+#endif /* CONFIG_FORMAT_S16LE */
+
+const struct comp_func_map func_map_avx2[] = {
+#if CONFIG_FORMAT_S16LE
+	{ SOF_IPC_FRAME_S16_LE, vol_s16_to_s16_avx2 },
+#endif /* CONFIG_FORMAT_S16LE */
+#if CONFIG_FORMAT_S24LE
+	{ SOF_IPC_FRAME_S24_4LE, vol_s24_to_s24_avx2 },
+#endif /* CONFIG_FORMAT_S24LE */
+#if CONFIG_FORMAT_S32LE
+	{ SOF_IPC_FRAME_S32_LE, vol_s32_to_s32_avx2 },
+#endif /* CONFIG_FORMAT_S32LE */
+};
+
+const size_t func_count_avx2 = ARRAY_SIZE(func_map_avx2);
+
+#endif /* SOF_X86_SIMD */
@@ -41,6 +41,7 @@
 #ifndef IAS_SRC_FARROW_H
 #define IAS_SRC_FARROW_H
 
+#include <sof/audio/asrc/asrc_config.h>
 #include <sof/audio/component.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -53,6 +54,17 @@
 #define ASRC_MAX_FILTER_LENGTH	128
 #define ASRC_MAX_BUFFER_LENGTH	256
 
+/*
+ * @brief Distance between the first samples of two channels in the ring
+ * buffer. The generic filter applies each tap to all channels of a frame
+ * with consecutive loads, HiFi3 loads consecutive taps of one channel.
+ */
+#if ASRC_GENERIC == 1
+#define ASRC_RING_CH_STEP(src_obj)	1
+#else
+#define ASRC_RING_CH_STEP(src_obj)	((src_obj)->buffer_length)
+#endif
+
 /*
  * @brief Define whether the input and output buffers shall be
  * interleaved or not.
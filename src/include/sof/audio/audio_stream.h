@@ -15,10 +15,12 @@
 #define __SOF_AUDIO_AUDIO_STREAM_H__
 
 #include <sof/audio/format.h>
+#include <sof/compiler_attributes.h>
 #include <sof/debug/panic.h>
 #include <sof/math/numbers.h>
 #include <sof/lib/alloc.h>
 #include <sof/lib/cache.h>
+#include <sof/lib/memory.h>
 #include <ipc/stream.h>
 
 #include <stdbool.h>
@@ -45,10 +47,7 @@
 struct audio_stream {
 	/* runtime data */
 	uint32_t size;	/**< Runtime buffer size in bytes (period multiple) */
-	uint32_t avail;	/**< Available bytes for reading */
-	uint32_t free;	/**< Free bytes for writing */
-	void *w_ptr;	/**< Buffer write pointer */
-	void *r_ptr;	/**< Buffer read position */
+	uint32_t held;	/**< Read bytes still in use, not free for writing */
 	void *addr;	/**< Buffer base address */
 	void *end_addr;	/**< Buffer end address */
 
@@ -59,6 +58,20 @@ struct audio_stream {
 
 	bool overrun_permitted; /**< indicates whether overrun is permitted */
 	bool underrun_permitted; /**< indicates whether underrun is permitted */
+
+	/* Write and read positions are in separate cache lines, so a stream
+	 * shared by two cores can be updated without locking while each core
+	 * writes only one of them. Available and free bytes are derived from
+	 * the produced and consumed counters.
+	 */
+
+	/** Buffer write pointer */
+	__aligned(PLATFORM_DCACHE_ALIGN) void *w_ptr;
+	uint32_t produced;	/**< Bytes written since reset */
+
+	/** Buffer read position */
+	__aligned(PLATFORM_DCACHE_ALIGN) void *r_ptr;
+	uint32_t consumed;	/**< Bytes read since reset */
 };
 
 /**
@@ -228,6 +241,30 @@ static inline void *audio_stream_wrap(const struct audio_stream *buffer,
 	return ptr;
 }
 
+/**
+ * Retrieves number of bytes written to the stream and not read yet.
+ * @param stream Stream pointer
+ * @return amount of data in bytes, regardless of underrun_permitted
+ */
+static inline uint32_t
+audio_stream_used_bytes(const struct audio_stream *stream)
+{
+	return stream->produced - stream->consumed;
+}
+
+/**
+ * Retrieves number of bytes that can be written without overwriting data.
+ * @param stream Stream pointer
+ * @return amount of space in bytes, regardless of overrun_permitted
+ */
+static inline uint32_t
+audio_stream_unused_bytes(const struct audio_stream *stream)
+{
+	uint32_t used = audio_stream_used_bytes(stream) + stream->held;
+
+	return used < stream->size ? stream->size - used : 0;
+}
+
 /**
  * Calculates available data in bytes, handling underrun_permitted behaviour
  * @param stream Stream pointer
@@ -242,10 +279,12 @@ audio_stream_get_avail_bytes(const struct audio_stream *stream)
 	 * regular pace, but buffer will never be seen as completely empty by
 	 * clients, and in turn will not cause underrun/XRUN.
 	 */
+	uint32_t avail = audio_stream_used_bytes(stream);
+
 	if (stream->underrun_permitted)
-		return stream->avail != 0 ? stream->avail : stream->size;
+		return avail != 0 ? avail : stream->size;
 
-	return stream->avail;
+	return avail;
 }
 
 /**
@@ -286,10 +325,12 @@ audio_stream_get_free_bytes(const struct audio_stream *stream)
 	 * processed at regular pace, but buffer will never be seen as
 	 * completely full by clients, and in turn will not cause overrun/XRUN.
 	 */
+	uint32_t free = audio_stream_unused_bytes(stream);
+
 	if (stream->overrun_permitted)
-		return stream->free != 0 ? stream->free : stream->size;
+		return free != 0 ? free : stream->size;
 
-	return stream->free;
+	return free;
 }
 
 /**
@@ -389,24 +430,20 @@ audio_stream_avail_frames(const struct audio_stream *source,
 static inline void audio_stream_produce(struct audio_stream *buffer,
 					uint32_t bytes)
 {
+	bool overwrite = bytes > audio_stream_get_free_bytes(buffer);
+
 	buffer->w_ptr = audio_stream_wrap(buffer,
 					  (char *)buffer->w_ptr + bytes);
+	buffer->produced += bytes;
 
 	/* "overwrite" old data in circular wrap case */
-	if (bytes > audio_stream_get_free_bytes(buffer))
+	if (overwrite) {
 		buffer->r_ptr = buffer->w_ptr;
-
-	/* calculate available bytes */
-	if (buffer->r_ptr < buffer->w_ptr)
-		buffer->avail = (char *)buffer->w_ptr - (char *)buffer->r_ptr;
-	else if (buffer->r_ptr == buffer->w_ptr)
-		buffer->avail = buffer->size; /* full */
-	else
-		buffer->avail = buffer->size -
-			((char *)buffer->r_ptr - (char *)buffer->w_ptr);
-
-	/* calculate free bytes */
-	buffer->free = buffer->size - buffer->avail;
+		buffer->consumed = buffer->produced - buffer->size;
+	} else if (audio_stream_used_bytes(buffer) > buffer->size) {
+		/* overrun permitted, unread data is lost by whole laps */
+		buffer->consumed += buffer->size;
+	}
 }
 
 /**
@@ -419,18 +456,11 @@ static inline void audio_stream_consume(struct audio_stream *buffer,
 {
 	buffer->r_ptr = audio_stream_wrap(buffer,
 					  (char *)buffer->r_ptr + bytes);
+	buffer->consumed += bytes;
 
-	/* calculate available bytes */
-	if (buffer->r_ptr < buffer->w_ptr)
-		buffer->avail = (char *)buffer->w_ptr - (char *)buffer->r_ptr;
-	else if (buffer->r_ptr == buffer->w_ptr)
-		buffer->avail = 0; /* empty */
-	else
-		buffer->avail = buffer->size -
-			((char *)buffer->r_ptr - (char *)buffer->w_ptr);
-
-	/* calculate free bytes */
-	buffer->free = buffer->size - buffer->avail;
+	/* underrun permitted, stale data is read again by whole laps */
+	if (audio_stream_used_bytes(buffer) > buffer->size)
+		buffer->consumed -= buffer->size;
 }
 
 /**
@@ -443,11 +473,10 @@ static inline void audio_stream_reset(struct audio_stream *buffer)
 	buffer->w_ptr = buffer->addr;
 	buffer->r_ptr = buffer->addr;
 
-	/* free space is buffer size */
-	buffer->free = buffer->size;
-
-	/* there are no avail samples at reset */
-	buffer->avail = 0;
+	/* there are no avail samples at reset, free space is buffer size */
+	buffer->produced = 0;
+	buffer->consumed = 0;
+	buffer->held = 0;
 }
 
 /**
@@ -543,6 +572,33 @@ audio_stream_frames_without_wrap(const struct audio_stream *source,
 	return bytes / frame_bytes;
 }
 
+/**
+ * @brief Calculates the largest span of frames that can be processed
+ *	  linearly, i.e. without wrap of either source or sink buffer.
+ * @param source Source stream.
+ * @param src_ptr Position in source to start reading from.
+ * @param sink Sink stream.
+ * @param snk_ptr Position in sink to start writing to.
+ * @param frames Number of frames left to process.
+ * @return Number of frames in the span, not bigger than frames.
+ *
+ * Processing loops can address up to returned number of frames with plain
+ * pointer arithmetic and then continue from pointers wrapped with
+ * audio_stream_wrap(). Both buffers must hold whole number of frames.
+ */
+static inline uint32_t
+audio_stream_span_frames(const struct audio_stream *source,
+			 const void *src_ptr,
+			 const struct audio_stream *sink,
+			 const void *snk_ptr, uint32_t frames)
+{
+	uint32_t n = audio_stream_frames_without_wrap(source, src_ptr);
+
+	n = MIN(n, audio_stream_frames_without_wrap(sink, snk_ptr));
+
+	return MIN(n, frames);
+}
+
 /**
  * Copies data from source buffer to sink buffer.
  * @param source Source buffer.
@@ -568,6 +624,10 @@ static inline int audio_stream_copy(const struct audio_stream *source,
 	uint32_t bytes_copied;
 	int ret;
 
+	/* nothing to move when the sink shares the source data area */
+	if (src == snk)
+		return samples;
+
 	while (bytes) {
 		bytes_src = audio_stream_bytes_without_wrap(source, src);
 		bytes_snk = audio_stream_bytes_without_wrap(sink, snk);
@@ -587,6 +647,78 @@ static inline int audio_stream_copy(const struct audio_stream *source,
 	return samples;
 }
 
+/**
+ * Copies data from linear source buffer to circular sink buffer.
+ * @param linear_source Source buffer.
+ * @param ioffset Offset (in samples) in source buffer to start reading from.
+ * @param sink Sink buffer.
+ * @param ooffset Offset (in samples) in sink buffer to start writing to.
+ * @param samples Number of samples to copy.
+ */
+static inline void audio_stream_copy_from_linear(const void *linear_source,
+						 uint32_t ioffset,
+						 struct audio_stream *sink,
+						 uint32_t ooffset,
+						 uint32_t samples)
+{
+	int ssize = audio_stream_sample_bytes(sink); /* src fmt == sink fmt */
+	const char *src = (const char *)linear_source + ioffset * ssize;
+	void *snk = audio_stream_wrap(sink,
+				      (char *)sink->w_ptr + ooffset * ssize);
+	uint32_t bytes = samples * ssize;
+	uint32_t bytes_snk;
+	uint32_t bytes_copied;
+	int ret;
+
+	while (bytes) {
+		bytes_snk = audio_stream_bytes_without_wrap(sink, snk);
+		bytes_copied = MIN(bytes, bytes_snk);
+
+		ret = memcpy_s(snk, bytes_snk, src, bytes_copied);
+		assert(!ret);
+
+		bytes -= bytes_copied;
+		src += bytes_copied;
+		snk = audio_stream_wrap(sink, (char *)snk + bytes_copied);
+	}
+}
+
+/**
+ * Copies data from circular source buffer to linear sink buffer.
+ * @param source Source buffer.
+ * @param ioffset Offset (in samples) in source buffer to start reading from.
+ * @param linear_sink Sink buffer.
+ * @param ooffset Offset (in samples) in sink buffer to start writing to.
+ * @param samples Number of samples to copy.
+ */
+static inline void audio_stream_copy_to_linear(const struct audio_stream *source,
+					       uint32_t ioffset,
+					       void *linear_sink,
+					       uint32_t ooffset,
+					       uint32_t samples)
+{
+	int ssize = audio_stream_sample_bytes(source); /* src fmt == sink fmt */
+	void *src = audio_stream_wrap(source,
+				      (char *)source->r_ptr + ioffset * ssize);
+	char *snk = (char *)linear_sink + ooffset * ssize;
+	uint32_t bytes = samples * ssize;
+	uint32_t bytes_src;
+	uint32_t bytes_copied;
+	int ret;
+
+	while (bytes) {
+		bytes_src = audio_stream_bytes_without_wrap(source, src);
+		bytes_copied = MIN(bytes, bytes_src);
+
+		ret = memcpy_s(snk, bytes, src, bytes_copied);
+		assert(!ret);
+
+		bytes -= bytes_copied;
+		snk += bytes_copied;
+		src = audio_stream_wrap(source, (char *)src + bytes_copied);
+	}
+}
+
 /** @}*/
 
 #endif /* __SOF_AUDIO_AUDIO_STREAM_H__ */
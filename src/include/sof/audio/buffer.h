@@ -112,6 +112,13 @@ struct comp_buffer {
 
 	bool hw_params_configured; /**< indicates whether hw params were set */
 	bool walking;	/**< indicates if the buffer is being walking */
+
+	uint32_t cb_type;	/**< BUFF_CB_TYPE_ events with listeners */
+
+	/* in-place processing, see buffer_alias() */
+	struct comp_buffer *alias_src;	/**< buffer owning our data area */
+	struct comp_buffer *alias_sink;	/**< buffer using our data area */
+	uint32_t alias_size;	/**< own data area size while aliased */
 };
 
 struct buffer_cb_transact {
@@ -159,6 +166,10 @@ struct comp_buffer *buffer_new(struct sof_ipc_buffer *desc);
 int buffer_set_size(struct comp_buffer *buffer, uint32_t size);
 void buffer_free(struct comp_buffer *buffer);
 
+/* in-place processing, buffer shares the data area of source buffer */
+int buffer_alias(struct comp_buffer *buffer, struct comp_buffer *source);
+int buffer_unalias(struct comp_buffer *buffer);
+
 /* called by a component after producing data into this buffer */
 void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes);
 
@@ -181,10 +192,25 @@ static inline void buffer_writeback(struct comp_buffer *buffer, uint32_t bytes)
 	audio_stream_writeback(&buffer->stream, bytes);
 }
 
+/**
+ * Checks if the inter core buffer can be updated without locking.
+ * The source writes only the write position and the sink only the read
+ * position, unless the source may overrun the sink or the data area is
+ * shared with an alias.
+ * @param buffer Buffer instance.
+ * @return True if produce and consume don't need the buffer lock.
+ */
+static inline bool buffer_is_lock_free(struct comp_buffer *buffer)
+{
+	return buffer->inter_core && !buffer->stream.overrun_permitted &&
+		!buffer->alias_src && !buffer->alias_sink;
+}
+
 /**
  * Locks buffer instance for buffers connecting components
  * running on different cores. Buffer parameters will be invalidated
- * to make sure the latest data can be retrieved.
+ * to make sure the latest data can be retrieved. Lock free buffers
+ * are only invalidated.
  * @param buffer Buffer instance.
  * @param flags IRQ flags.
  */
@@ -193,7 +219,8 @@ static inline void buffer_lock(struct comp_buffer *buffer, uint32_t *flags)
 	if (!buffer->inter_core)
 		return;
 
-	spin_lock_irq(buffer->lock, *flags);
+	if (!buffer_is_lock_free(buffer))
+		spin_lock_irq(buffer->lock, *flags);
 
 	/* invalidate in case something has changed during our wait */
 	dcache_invalidate_region(buffer, sizeof(*buffer));
@@ -212,13 +239,46 @@ static inline void buffer_unlock(struct comp_buffer *buffer, uint32_t flags)
 	if (!buffer->inter_core)
 		return;
 
-	/* save lock pointer to avoid memory access after cache flushing */
+	/* save lock state to avoid memory access after cache flushing */
 	spinlock_t *lock = buffer->lock;
+	bool lock_free = buffer_is_lock_free(buffer);
 
 	/* wtb and inv to avoid buffer locking in read only situations */
 	dcache_writeback_invalidate_region(buffer, sizeof(*buffer));
 
-	spin_unlock_irq(lock, flags);
+	if (!lock_free)
+		spin_unlock_irq(lock, flags);
+}
+
+/**
+ * Enables produce and/or consume notifications for the buffer.
+ * Listeners registering to NOTIFIER_ID_BUFFER_PRODUCE or
+ * NOTIFIER_ID_BUFFER_CONSUME with the buffer as caller have to enable
+ * the corresponding type, otherwise the event is not sent at all.
+ * @param buffer Buffer instance.
+ * @param type BUFF_CB_TYPE_ mask of events to enable.
+ */
+static inline void buffer_cb_enable(struct comp_buffer *buffer, uint32_t type)
+{
+	uint32_t flags = 0;
+
+	buffer_lock(buffer, &flags);
+	buffer->cb_type |= type;
+	buffer_unlock(buffer, flags);
+}
+
+/**
+ * Disables produce and/or consume notifications for the buffer.
+ * @param buffer Buffer instance.
+ * @param type BUFF_CB_TYPE_ mask of events to disable.
+ */
+static inline void buffer_cb_disable(struct comp_buffer *buffer, uint32_t type)
+{
+	uint32_t flags = 0;
+
+	buffer_lock(buffer, &flags);
+	buffer->cb_type &= ~type;
+	buffer_unlock(buffer, flags);
 }
 
 static inline void buffer_zero(struct comp_buffer *buffer)
@@ -7,7 +7,7 @@
 #include <sof/audio/src/src.h>
 #include <stdint.h>
 
-const int32_t src_int32_1_2_2268_5000_fir[40] = {
+const int32_t src_int32_1_2_2268_5000_fir[20] = {
 	-102613,
 	1042618,
 	2316615,
@@ -27,30 +27,10 @@ const int32_t src_int32_1_2_2268_5000_fir[40] = {
 	-248872541,
 	142700044,
 	836704356,
-	1388371390,
-	1388371390,
-	836704356,
-	142700044,
-	-248872541,
-	-222245839,
-	-3886862,
-	125072127,
-	82651321,
-	-20409074,
-	-60977315,
-	-26683813,
-	17203849,
-	24571100,
-	5741987,
-	-8429876,
-	-7113516,
-	-298661,
-	2316615,
-	1042618,
-	-102613
+	1388371390
 
 };
 
 struct src_stage src_int32_1_2_2268_5000 = {
 	1, 0, 1, 40, 40, 2, 1, 0, 1,
-	src_int32_1_2_2268_5000_fir};
+	src_int32_1_2_2268_5000_fir, 1};
@@ -7,7 +7,7 @@
 #include <sof/audio/src/src.h>
 #include <stdint.h>
 
-const int32_t src_int32_1_2_4535_5000_fir[200] = {
+const int32_t src_int32_1_2_4535_5000_fir[100] = {
 	-79638,
 	47425,
 	131437,
@@ -107,110 +107,10 @@ const int32_t src_int32_1_2_4535_5000_fir[200] = {
 	-301107631,
 	-272718756,
 	635613098,
-	1656246671,
-	1656246671,
-	635613098,
-	-272718756,
-	-301107631,
-	115329198,
-	204829979,
-	-53041763,
-	-155939188,
-	19366367,
-	124413719,
-	1514842,
-	-101210403,
-	-15302727,
-	82723156,
-	24573012,
-	-67270800,
-	-30682186,
-	53990922,
-	34435821,
-	-42412651,
-	-36364131,
-	32266598,
-	36848896,
-	-23391031,
-	-36186538,
-	15681812,
-	34621026,
-	-9064151,
-	-32361428,
-	3476141,
-	29591262,
-	1140891,
-	-26473294,
-	-4847853,
-	23151819,
-	7710649,
-	-19753572,
-	-9801137,
-	16387985,
-	11196859,
-	-13147220,
-	-11979944,
-	10106244,
-	12235493,
-	-7323107,
-	-12049661,
-	4839520,
-	11507628,
-	-2681745,
-	-10691608,
-	861823,
-	9679008,
-	620933,
-	-8540840,
-	-1778195,
-	7340428,
-	2630727,
-	-6132477,
-	-3206397,
-	4962504,
-	3538178,
-	-3866638,
-	-3662209,
-	2871767,
-	3615984,
-	-1995992,
-	-3436724,
-	1249353,
-	3159975,
-	-634761,
-	-2818473,
-	149078,
-	2441271,
-	215706,
-	-2053159,
-	-471281,
-	1674345,
-	631836,
-	-1320385,
-	-712961,
-	1002338,
-	730662,
-	-727097,
-	-700515,
-	497862,
-	636988,
-	-314714,
-	-552929,
-	175240,
-	459231,
-	-75182,
-	-364652,
-	9054,
-	275788,
-	29280,
-	-197166,
-	-46101,
-	131437,
-	47425,
-	-79638
+	1656246671
 
 };
 
 struct src_stage src_int32_1_2_4535_5000 = {
 	1, 0, 1, 200, 200, 2, 1, 0, 1,
-	src_int32_1_2_4535_5000_fir};
+	src_int32_1_2_4535_5000_fir, 1};
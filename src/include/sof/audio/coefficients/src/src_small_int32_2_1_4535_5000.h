@@ -7,7 +7,7 @@
 #include <sof/audio/src/src.h>
 #include <stdint.h>
 
-const int32_t src_int32_2_1_4535_5000_fir[200] = {
+const int32_t src_int32_2_1_4535_5000_fir[100] = {
 	-79638,
 	131437,
 	-197166,
@@ -107,110 +107,10 @@ const int32_t src_int32_2_1_4535_5000_fir[200] = {
 	9054,
 	29280,
 	-46101,
-	47425,
-	47425,
-	-46101,
-	29280,
-	9054,
-	-75182,
-	175240,
-	-314714,
-	497862,
-	-727097,
-	1002338,
-	-1320385,
-	1674345,
-	-2053159,
-	2441271,
-	-2818473,
-	3159975,
-	-3436724,
-	3615984,
-	-3662209,
-	3538178,
-	-3206397,
-	2630727,
-	-1778195,
-	620933,
-	861823,
-	-2681745,
-	4839520,
-	-7323107,
-	10106244,
-	-13147220,
-	16387985,
-	-19753572,
-	23151819,
-	-26473294,
-	29591262,
-	-32361428,
-	34621026,
-	-36186538,
-	36848896,
-	-36364131,
-	34435821,
-	-30682186,
-	24573012,
-	-15302727,
-	1514842,
-	19366367,
-	-53041763,
-	115329198,
-	-272718756,
-	1656246671,
-	635613098,
-	-301107631,
-	204829979,
-	-155939188,
-	124413719,
-	-101210403,
-	82723156,
-	-67270800,
-	53990922,
-	-42412651,
-	32266598,
-	-23391031,
-	15681812,
-	-9064151,
-	3476141,
-	1140891,
-	-4847853,
-	7710649,
-	-9801137,
-	11196859,
-	-11979944,
-	12235493,
-	-12049661,
-	11507628,
-	-10691608,
-	9679008,
-	-8540840,
-	7340428,
-	-6132477,
-	4962504,
-	-3866638,
-	2871767,
-	-1995992,
-	1249353,
-	-634761,
-	149078,
-	215706,
-	-471281,
-	631836,
-	-712961,
-	730662,
-	-700515,
-	636988,
-	-552929,
-	459231,
-	-364652,
-	275788,
-	-197166,
-	131437,
-	-79638
+	47425
 
 };
 
 struct src_stage src_int32_2_1_4535_5000 = {
 	0, 1, 2, 100, 200, 1, 2, 0, 0,
-	src_int32_2_1_4535_5000_fir};
+	src_int32_2_1_4535_5000_fir, 1};
@@ -7,7 +7,7 @@
 #include <sof/audio/src/src.h>
 #include <stdint.h>
 
-const int32_t src_int32_3_2_4535_5000_fir[276] = {
+const int32_t src_int32_3_2_4535_5000_fir[138] = {
 	-92545,
 	140559,
 	-191923,
@@ -145,148 +145,10 @@ const int32_t src_int32_3_2_4535_5000_fir[276] = {
 	-146278769,
 	223461540,
 	-393862475,
-	1214351617,
-	1214351617,
-	-393862475,
-	223461540,
-	-146278769,
-	100559342,
-	-69544115,
-	46841927,
-	-29502077,
-	15975785,
-	-5364913,
-	-2899622,
-	9210750,
-	-13863515,
-	17097059,
-	-19117642,
-	20111130,
-	-20249392,
-	19693117,
-	-18592506,
-	17086793,
-	-15303188,
-	13355664,
-	-11343859,
-	9352271,
-	-7449859,
-	5690103,
-	-4111517,
-	2738604,
-	-1583179,
-	645988,
-	81459,
-	-614950,
-	975605,
-	-1187981,
-	1278324,
-	-1273011,
-	1197260,
-	-1074098,
-	923632,
-	-762591,
-	604136,
-	-457891,
-	330182,
-	-224401,
-	141487,
-	-80455,
-	25474,
-	-8119,
-	-31750,
-	101443,
-	-208233,
-	358723,
-	-558113,
-	809377,
-	-1112411,
-	1463188,
-	-1852975,
-	2267686,
-	-2687418,
-	3086244,
-	-3432310,
-	3688274,
-	-3812130,
-	3758420,
-	-3479822,
-	2929094,
-	-2061324,
-	836405,
-	778345,
-	-2805512,
-	5254995,
-	-8121575,
-	11382768,
-	-14997036,
-	18902408,
-	-23015520,
-	27231019,
-	-31421182,
-	35435453,
-	-39099402,
-	42212222,
-	-44541243,
-	45810673,
-	-45679141,
-	43694778,
-	-39202118,
-	31135622,
-	-17509776,
-	-6063930,
-	51975026,
-	-175012245,
-	1745131644,
-	443704770,
-	-239067307,
-	174452167,
-	-139836570,
-	116367438,
-	-98222819,
-	83078597,
-	-69873625,
-	58089770,
-	-47468754,
-	37883927,
-	-29275749,
-	21616687,
-	-14891080,
-	9083324,
-	-4171063,
-	121606,
-	3109467,
-	-5578150,
-	7350785,
-	-8502087,
-	9112707,
-	-9266554,
-	9048086,
-	-8539714,
-	7819459,
-	-6958968,
-	6021946,
-	-5063054,
-	4127275,
-	-3249742,
-	2455986,
-	-1762541,
-	1177853,
-	-703402,
-	334966,
-	-63945,
-	-121331,
-	234365,
-	-289386,
-	300406,
-	-280468,
-	241092,
-	-191923,
-	140559,
-	-92545
+	1214351617
 
 };
 
 struct src_stage src_int32_3_2_4535_5000 = {
 	1, 2, 3, 92, 276, 2, 3, 0, 0,
-	src_int32_3_2_4535_5000_fir};
+	src_int32_3_2_4535_5000_fir, 1};
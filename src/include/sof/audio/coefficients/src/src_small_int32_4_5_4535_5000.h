@@ -7,7 +7,7 @@
 #include <sof/audio/src/src.h>
 #include <stdint.h>
 
-const int32_t src_int32_4_5_4535_5000_fir[448] = {
+const int32_t src_int32_4_5_4535_5000_fir[224] = {
 	71197,
 	-96779,
 	49471,
@@ -231,234 +231,10 @@ const int32_t src_int32_4_5_4535_5000_fir[448] = {
 	-164016,
 	178312,
 	-99102,
-	9852,
-	9852,
-	-99102,
-	178312,
-	-164016,
-	3130,
-	262654,
-	-481234,
-	458499,
-	-91950,
-	-508955,
-	1014441,
-	-1027906,
-	347252,
-	818846,
-	-1851585,
-	2011528,
-	-906287,
-	-1133409,
-	3055637,
-	-3576007,
-	1960696,
-	1339785,
-	-4666762,
-	5913035,
-	-3765930,
-	-1256094,
-	6692693,
-	-9244198,
-	6660091,
-	611055,
-	-9105405,
-	13846766,
-	-11111597,
-	995700,
-	11849132,
-	-20132109,
-	17845847,
-	-4193068,
-	-14869008,
-	28864160,
-	-28200844,
-	10127571,
-	18187533,
-	-41823323,
-	45274738,
-	-21466923,
-	-22147905,
-	64379051,
-	-78855949,
-	47261926,
-	28660134,
-	-122130393,
-	185455984,
-	-157121838,
-	-63806136,
-	1341442134,
-	1028749682,
-	-264895412,
-	-6035650,
-	123761888,
-	-136382438,
-	82993023,
-	-8104787,
-	-49463489,
-	68500003,
-	-49718675,
-	10678376,
-	25498644,
-	-41805068,
-	34124908,
-	-10782869,
-	-13743550,
-	26994230,
-	-24317648,
-	9834903,
-	7116647,
-	-17555796,
-	17324320,
-	-8374809,
-	-3254844,
-	11206091,
-	-12093356,
-	6717506,
-	1074280,
-	-6894411,
-	8157742,
-	-5078385,
-	42998,
-	4021510,
-	-5253282,
-	3603589,
-	-501007,
-	-2182763,
-	3186860,
-	-2379592,
-	580252,
-	1074820,
-	-1790070,
-	1440627,
-	-474555,
-	-461246,
-	906885,
-	-778671,
-	310006,
-	159954,
-	-395146,
-	356034,
-	-158942,
-	-37302,
-	132265,
-	-118900,
-	53196,
-	-46793,
-	-37441,
-	164013,
-	-247312,
-	185210,
-	60879,
-	-399952,
-	620541,
-	-500257,
-	-28762,
-	763718,
-	-1271122,
-	1110939,
-	-146740,
-	-1251922,
-	2294270,
-	-2172444,
-	603237,
-	1823308,
-	-3781265,
-	3875806,
-	-1538201,
-	-2384200,
-	5809674,
-	-6449790,
-	3221936,
-	2773374,
-	-8438543,
-	10173762,
-	-6022945,
-	-2742286,
-	11715755,
-	-15421055,
-	10470131,
-	1916803,
-	-15711374,
-	22780995,
-	-17418197,
-	301835,
-	20612607,
-	-33402967,
-	28528196,
-	-5041821,
-	-27004864,
-	50108990,
-	-47934955,
-	15118703,
-	36951969,
-	-82264524,
-	90509401,
-	-41716994,
-	-61254071,
-	188001418,
-	-283518341,
-	254016049,
-	1515878931,
-	641217564,
-	-332918830,
-	120333249,
-	30335097,
-	-104547276,
-	105055953,
-	-56402088,
-	-5686995,
-	49472473,
-	-58980862,
-	37420162,
-	-1778565,
-	-27726862,
-	37777274,
-	-27042398,
-	4656499,
-	16109422,
-	-25124266,
-	19896659,
-	-5519618,
-	-9174130,
-	16700446,
-	-14483712,
-	5331598,
-	4910493,
-	-10859531,
-	10262034,
-	-4597630,
-	-2339659,
-	6800004,
-	-6991115,
-	3634157,
-	880487,
-	-4040825,
-	4526754,
-	-2649605,
-	-141248,
-	2241133,
-	-2748372,
-	1774072,
-	-157396,
-	-1134552,
-	1535643,
-	-1075304,
-	214023,
-	506483,
-	-766164,
-	572338,
-	-162743,
-	-187249,
-	321751,
-	-249620,
-	85409,
-	49471,
-	-96779,
-	71197
+	9852
 
 };
 
 struct src_stage src_int32_4_5_4535_5000 = {
 	1, 1, 4, 112, 448, 5, 4, 0, 0,
-	src_int32_4_5_4535_5000_fir};
+	src_int32_4_5_4535_5000_fir, 1};
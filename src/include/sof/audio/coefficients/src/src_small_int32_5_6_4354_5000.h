@@ -7,7 +7,7 @@
 #include <sof/audio/src/src.h>
 #include <stdint.h>
 
-const int32_t src_int32_5_6_4354_5000_fir[380] = {
+const int32_t src_int32_5_6_4354_5000_fir[190] = {
 	-110765,
 	202615,
 	-181213,
@@ -197,200 +197,10 @@ const int32_t src_int32_5_6_4354_5000_fir[380] = {
 	141425750,
 	-50460371,
 	-208459562,
-	1209907046,
-	1209907046,
-	-208459562,
-	-50460371,
-	141425750,
-	-136995981,
-	80067707,
-	-9896067,
-	-42778263,
-	62395995,
-	-50157374,
-	19540469,
-	11871794,
-	-30467503,
-	31340812,
-	-18365939,
-	511288,
-	13241572,
-	-17852419,
-	13534842,
-	-4414489,
-	-4266521,
-	8789295,
-	-8261457,
-	4297017,
-	381983,
-	-3494980,
-	4131268,
-	-2778428,
-	680802,
-	975263,
-	-1602646,
-	1295790,
-	-552896,
-	-109422,
-	417986,
-	-387115,
-	196411,
-	-26669,
-	52972,
-	106682,
-	-372305,
-	579489,
-	-482090,
-	-84144,
-	1008386,
-	-1825398,
-	1872174,
-	-676653,
-	-1602490,
-	3982226,
-	-4952125,
-	3259408,
-	1157507,
-	-6653311,
-	10269995,
-	-9109682,
-	2149878,
-	8487264,
-	-17768431,
-	19809927,
-	-11082012,
-	-6800413,
-	26443067,
-	-37157358,
-	30011856,
-	-3335742,
-	-34187001,
-	65060050,
-	-69457064,
-	34538116,
-	37194100,
-	-124187428,
-	187947221,
-	-175714416,
-	-10835542,
-	1434247379,
-	912796765,
-	-316432297,
-	66618723,
-	69147397,
-	-118211915,
-	101648548,
-	-48973765,
-	-8187315,
-	45807278,
-	-53867037,
-	36720596,
-	-7971064,
-	-17231281,
-	28871533,
-	-25148377,
-	11363736,
-	4029762,
-	-13885351,
-	15229439,
-	-9597597,
-	1253179,
-	5411268,
-	-7899350,
-	6258494,
-	-2384260,
-	-1353763,
-	3338270,
-	-3236736,
-	1773109,
-	-62356,
-	-1041170,
-	1264573,
-	-848023,
-	244422,
-	183996,
-	-313644,
-	227519,
-	-84272,
-	136998,
-	-28531,
-	-258714,
-	616459,
-	-781233,
-	460670,
-	439526,
-	-1619886,
-	2393574,
-	-1989169,
-	63634,
-	2851946,
-	-5318073,
-	5557309,
-	-2481991,
-	-3330588,
-	9371949,
-	-12066006,
-	8600165,
-	1099419,
-	-13416074,
-	22006533,
-	-20678805,
-	7047191,
-	14935758,
-	-35327860,
-	42009053,
-	-26768671,
-	-9027332,
-	52259402,
-	-81274868,
-	74070145,
-	-18519170,
-	-79589975,
-	194075077,
-	-280549671,
-	262253212,
-	1554862275,
-	582806597,
-	-335622766,
-	152667682,
-	-10514225,
-	-74821263,
-	98819194,
-	-74343877,
-	26046873,
-	19866113,
-	-45182001,
-	44636431,
-	-24932443,
-	-798577,
-	19988179,
-	-25865264,
-	19053336,
-	-5591173,
-	-6992399,
-	13377047,
-	-12304414,
-	6157586,
-	1018501,
-	-5774708,
-	6675774,
-	-4421028,
-	938266,
-	1853065,
-	-2930341,
-	2375699,
-	-994344,
-	-299021,
-	953432,
-	-921634,
-	501917,
-	-60411,
-	-181213,
-	202615,
-	-110765
+	1209907046
 
 };
 
 struct src_stage src_int32_5_6_4354_5000 = {
 	1, 1, 5, 76, 380, 6, 5, 0, 0,
-	src_int32_5_6_4354_5000_fir};
+	src_int32_5_6_4354_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_10_21_4535_5000_fir[1720] = {
+const int32_t src_int32_10_21_4535_5000_fir[860] = {
 	64820,
 	140936,
 	-51986,
@@ -867,870 +867,10 @@ const int32_t src_int32_10_21_4535_5000_fir[1720] = {
 	-179026,
 	-179845,
 	73918,
-	130754,
-	130754,
-	73918,
-	-179845,
-	-179026,
-	199426,
-	328154,
-	-162271,
-	-507928,
-	41192,
-	690507,
-	184748,
-	-833676,
-	-523093,
-	883971,
-	961086,
-	-783121,
-	-1460381,
-	477594,
-	1954873,
-	69640,
-	-2352916,
-	-866590,
-	2544793,
-	1880981,
-	-2415561,
-	-3032485,
-	1862548,
-	4190665,
-	-815839,
-	-5180416,
-	-740793,
-	5795907,
-	2751642,
-	-5822906,
-	-5076949,
-	5068100,
-	7490095,
-	-3392677,
-	-9686588,
-	746305,
-	11306115,
-	2803160,
-	-11967321,
-	-7049136,
-	11313186,
-	11639462,
-	-9063106,
-	-16086670,
-	5066284,
-	19797132,
-	649916,
-	-22118684,
-	-7843232,
-	22404008,
-	16037325,
-	-20084775,
-	-24524605,
-	14749722,
-	32393154,
-	-6218773,
-	-38576948,
-	-5394808,
-	41925146,
-	19641059,
-	-41282750,
-	-35713055,
-	35571141,
-	52449753,
-	-23852796,
-	-68355322,
-	5358045,
-	81617120,
-	20561388,
-	-90082382,
-	-54621103,
-	91099790,
-	98104779,
-	-80970392,
-	-154197373,
-	53145694,
-	232191316,
-	8745725,
-	-366078551,
-	-172477550,
-	786147916,
-	1709071651,
-	1650641858,
-	672962183,
-	-231435639,
-	-342812529,
-	48213345,
-	229552194,
-	25426892,
-	-160280085,
-	-61815053,
-	108292377,
-	78748145,
-	-66397307,
-	-83257401,
-	32323197,
-	79213837,
-	-5322185,
-	-69341090,
-	-14934572,
-	55847126,
-	28784245,
-	-40616635,
-	-36738555,
-	25245883,
-	39525851,
-	-11024289,
-	-38065560,
-	-1092110,
-	33404850,
-	10494263,
-	-26637252,
-	-16911765,
-	18818122,
-	20380801,
-	-10888466,
-	-21191310,
-	3615531,
-	19819282,
-	2444695,
-	-16851781,
-	-6961132,
-	12912583,
-	9818465,
-	-8595637,
-	-11088774,
-	4412024,
-	10989262,
-	-753980,
-	-9832356,
-	-2122692,
-	7974574,
-	4098755,
-	-5769813,
-	-5176929,
-	3531499,
-	5456594,
-	-1506354,
-	-5102455,
-	-139229,
-	4311858,
-	1320835,
-	-3284824,
-	-2027698,
-	2199902,
-	2307260,
-	-1197675,
-	-2245879,
-	372498,
-	1948876,
-	228133,
-	-1522594,
-	-598041,
-	1060407,
-	762679,
-	-633703,
-	-767471,
-	287999,
-	666215,
-	-43608,
-	-511159,
-	-100265,
-	345809,
-	159375,
-	-200875,
-	-157628,
-	93253,
-	120804,
-	138403,
-	52094,
-	-199207,
-	-152557,
-	236767,
-	303060,
-	-222904,
-	-494080,
-	127600,
-	701230,
-	74955,
-	-884425,
-	-399029,
-	989998,
-	839798,
-	-956263,
-	-1366957,
-	722487,
-	1921054,
-	-240607,
-	-2413995,
-	-511636,
-	2734789,
-	1518047,
-	-2760989,
-	-2714107,
-	2375402,
-	3982237,
-	-1486704,
-	-5154283,
-	51639,
-	6022595,
-	1904275,
-	-6360085,
-	-4271023,
-	5948308,
-	6846836,
-	-4611296,
-	-9342324,
-	2251539,
-	11397862,
-	1116446,
-	-12614579,
-	-5339988,
-	12597496,
-	10114505,
-	-11007522,
-	-14986185,
-	7617303,
-	19373657,
-	-2364746,
-	-22609214,
-	-4602554,
-	23997733,
-	12898413,
-	-22889099,
-	-21889922,
-	18757826,
-	30713213,
-	-11282112,
-	-38313407,
-	414066,
-	43505617,
-	13566537,
-	-45050053,
-	-30020554,
-	41730076,
-	47941727,
-	-32416911,
-	-65968873,
-	16096857,
-	82404008,
-	8179189,
-	-95203099,
-	-41504684,
-	101859638,
-	85686226,
-	-98962188,
-	-144794656,
-	80681346,
-	230170229,
-	-32746989,
-	-383159911,
-	-104857085,
-	899141662,
-	1756682809,
-	1582093217,
-	560803339,
-	-281441142,
-	-314127620,
-	85006138,
-	222473896,
-	-1932740,
-	-163015506,
-	-41900616,
-	116098308,
-	65081436,
-	-76625794,
-	-74894056,
-	43241520,
-	75267953,
-	-15732170,
-	-68927251,
-	-5845056,
-	58081456,
-	21513271,
-	-44643775,
-	-31518221,
-	30274980,
-	36365876,
-	-16364061,
-	-36798894,
-	3994595,
-	33736067,
-	6079523,
-	-28191794,
-	-13437927,
-	21189393,
-	17973694,
-	-13679623,
-	-19850857,
-	6473314,
-	19444483,
-	-194117,
-	-17270277,
-	-4745626,
-	13911487,
-	8145897,
-	-9950568,
-	-9999484,
-	5911812,
-	10456586,
-	-2219326,
-	-9779367,
-	-827484,
-	8292754,
-	3060942,
-	-6337336,
-	-4436669,
-	4229209,
-	5013138,
-	-2230109,
-	-4923573,
-	529472,
-	4344790,
-	761596,
-	-3467171,
-	-1605907,
-	2469183,
-	2027808,
-	-1498686,
-	-2095899,
-	662031,
-	1903975,
-	-20792,
-	-1553002,
-	-405000,
-	1136257,
-	628916,
-	-728953,
-	-687528,
-	382794,
-	629209,
-	-125132,
-	-504021,
-	-38185,
-	355911,
-	117527,
-	-217827,
-	-133129,
-	109806,
-	108875,
-	143462,
-	28140,
-	-215177,
-	-121851,
-	270512,
-	270804,
-	-280850,
-	-469583,
-	213865,
-	697790,
-	-39280,
-	-918279,
-	-263742,
-	1078218,
-	698539,
-	-1113647,
-	-1243571,
-	957698,
-	1847309,
-	-552037,
-	-2426988,
-	-139624,
-	2872503,
-	1117727,
-	-3056197,
-	-2335058,
-	2848460,
-	3689397,
-	-2138069,
-	-5022952,
-	855228,
-	6130342,
-	1005629,
-	-6775953,
-	-3366790,
-	6720231,
-	6055652,
-	-5753094,
-	-8803865,
-	3731230,
-	11259668,
-	-614906,
-	-13014433,
-	-3500787,
-	13642692,
-	8365485,
-	-12753005,
-	-13568504,
-	10045188,
-	18552561,
-	-5367966,
-	-22647702,
-	-1229731,
-	25124547,
-	9460663,
-	-25263531,
-	-18780276,
-	22434447,
-	28390929,
-	-16178868,
-	-37270721,
-	6287014,
-	44224940,
-	7139195,
-	-47954091,
-	-23643747,
-	47127882,
-	42398585,
-	-40448598,
-	-62208891,
-	26678100,
-	81532037,
-	-4584003,
-	-98484849,
-	-27286445,
-	110776991,
-	71235320,
-	-115398942,
-	-132165370,
-	107477832,
-	223348787,
-	-75548948,
-	-393353667,
-	-28993324,
-	1010703017,
-	1792903026,
-	1504242962,
-	450852329,
-	-322333935,
-	-280838928,
-	118548921,
-	211251747,
-	-28414181,
-	-162441290,
-	-21636439,
-	121421615,
-	50396537,
-	-85133427,
-	-65185643,
-	53113690,
-	69882637,
-	-25668843,
-	-67142663,
-	3232125,
-	59124227,
-	13909816,
-	-47725578,
-	-25734697,
-	34635151,
-	32517830,
-	-21310944,
-	-34811454,
-	8940103,
-	33388325,
-	1595712,
-	-29163752,
-	-9736338,
-	23108532,
-	15235411,
-	-16163848,
-	-18129079,
-	9167340,
-	18685013,
-	-2797108,
-	-17337999,
-	-2462349,
-	14619564,
-	6331201,
-	-11089208,
-	-8723957,
-	7273892,
-	9721577,
-	-3620839,
-	-9531345,
-	466656,
-	8440552,
-	1976415,
-	-6769928,
-	-3618323,
-	4831995,
-	4475983,
-	-2898187,
-	-4648921,
-	1176984,
-	4290223,
-	196334,
-	-3577044,
-	-1159230,
-	2684297,
-	1712797,
-	-1764139,
-	-1906795,
-	932685,
-	1821843,
-	-264193,
-	-1551662,
-	-208052,
-	1187634,
-	485661,
-	-807295,
-	-595800,
-	467442,
-	580581,
-	-201823,
-	-486966,
-	22706,
-	358505,
-	74801,
-	-229721,
-	-106950,
-	123357,
-	95320,
-	145688,
-	2481,
-	-227272,
-	-87399,
-	299820,
-	231824,
-	-334811,
-	-434627,
-	298190,
-	679869,
-	-155711,
-	-934112,
-	-119747,
-	1146398,
-	539760,
-	-1251695,
-	-1092117,
-	1178204,
-	1734346,
-	-858300,
-	-2390713,
-	242162,
-	2954170,
-	687527,
-	-3294290,
-	-1902038,
-	3271419,
-	3316737,
-	-2756355,
-	-4787451,
-	1653791,
-	6115160,
-	73220,
-	-7060285,
-	-2381218,
-	7366652,
-	5130556,
-	-6793827,
-	-8079517,
-	5155000,
-	10891307,
-	-2356347,
-	-13155585,
-	-1567184,
-	14424559,
-	6425065,
-	-14261702,
-	-11858462,
-	12299227,
-	17345654,
-	-8298756,
-	-22227925,
-	2208502,
-	25756033,
-	5790113,
-	-27154834,
-	-15252918,
-	25701152,
-	25465515,
-	-20807889,
-	-35460379,
-	12105987,
-	44057666,
-	484540,
-	-49924807,
-	-16702470,
-	51644940,
-	35917818,
-	-47777689,
-	-57130623,
-	36885416,
-	78991432,
-	-17476990,
-	-99827382,
-	-12231525,
-	117632694,
-	54995704,
-	-129910069,
-	-116469088,
-	132975565,
-	211673078,
-	-118887942,
-	-396032525,
-	54568989,
-	1119586959,
-	1817295702,
-	1418014084,
-	344236491,
-	-354083224,
-	-243796917,
-	148348036,
-	196247673,
-	-53530637,
-	-158657641,
-	-1428850,
-	124211974,
-	35004286,
-	-91784178,
-	-54348580,
-	61761112,
-	63187937,
-	-34941623,
-	-64042996,
-	12116192,
-	58971034,
-	6130069,
-	-49812890,
-	-19510715,
-	38247719,
-	28067162,
-	-25770875,
-	-32151725,
-	13647213,
-	32376700,
-	-2866651,
-	-29540592,
-	-5883764,
-	24542485,
-	12224685,
-	-18295061,
-	-16064985,
-	11645633,
-	17560703,
-	-5312590,
-	-17057865,
-	-157858,
-	15026236,
-	4412502,
-	-11991483,
-	-7290122,
-	8472757,
-	8801606,
-	-4931288,
-	-9095879,
-	1733812,
-	8417361,
-	867560,
-	-7060843,
-	-2739421,
-	5329176,
-	3857300,
-	-3498047,
-	-4285492,
-	1790661,
-	4150665,
-	-363518,
-	-3613461,
-	-697052,
-	2841880,
-	1369187,
-	-1989361,
-	-1683102,
-	1179394,
-	1704874,
-	-497294,
-	-1519272,
-	-11241,
-	1214057,
-	336018,
-	-867559,
-	-494428,
-	540499,
-	521627,
-	-272270,
-	-460634,
-	81210,
-	353787,
-	32099,
-	-236505,
-	-79699,
-	133758,
-	80509,
-	144890,
-	-24404,
-	-235073,
-	-49791,
-	323913,
-	186713,
-	-383535,
-	-389628,
-	378768,
-	647444,
-	-271987,
-	-931145,
-	30198,
-	1192665,
-	366329,
-	-1367147,
-	-915105,
-	1379182,
-	1583690,
-	-1153028,
-	-2304971,
-	626102,
-	2977108,
-	235701,
-	-3469422,
-	-1422963,
-	3634826,
-	2870551,
-	-3328445,
-	-4450944,
-	2431000,
-	5975505,
-	-874490,
-	-7205383,
-	-1333174,
-	7872666,
-	4088478,
-	-7710972,
-	-7181475,
-	6493199,
-	10297222,
-	-4072670,
-	-13031843,
-	422804,
-	14923922,
-	4330199,
-	-15500094,
-	-9887129,
-	14331613,
-	15772709,
-	-11096857,
-	-21352872,
-	5643285,
-	25873463,
-	1958309,
-	-28518917,
-	-11374241,
-	28486859,
-	21988867,
-	-25072206,
-	-32909537,
-	17752553,
-	42995947,
-	-6265713,
-	-50910084,
-	-9329561,
-	55177770,
-	28617211,
-	-54245709,
-	-50816720,
-	46506570,
-	74805836,
-	-30241608,
-	-99167521,
-	3372955,
-	122244127,
-	37252285,
-	-142153651,
-	-97930252,
-	156621859,
-	195179405,
-	-161946364,
-	-390656732,
-	145164607,
-	1224560974,
-	1829566227,
-	1324422169,
-	242014851,
-	-376784852,
-	-203873205,
-	173996808,
-	177881562,
-	-76835649,
-	-151823824,
-	18326564,
-	124469592,
-	19223166,
-	-96481104,
-	-42617757,
-	69032385,
-	55337780,
-	-43375994,
-	-59709234,
-	20632761,
-	57641341,
-	-1668353,
-	-50877029,
-	-12976226,
-	41049918,
-	23110291,
-	-29660665,
-	-28881043,
-	18024661,
-	30729363,
-	-7218551,
-	-29321834,
-	-1959085,
-	25468299,
-	9005003,
-	-20034793,
-	-13703976,
-	13861159,
-	16098454,
-	-7691254,
-	-16439729,
-	2121436,
-	15127096,
-	2429529,
-	-12642312,
-	-5728724,
-	9486503,
-	7717524,
-	-6125628,
-	-8484213,
-	2948965,
-	8226011,
-	-243063,
-	-7206274,
-	-1818455,
-	5712344,
-	3170711,
-	-4018707,
-	-3841953,
-	2358738,
-	3930290,
-	-906824,
-	-3576932,
-	-228911,
-	2939787,
-	1004388,
-	-2170579,
-	-1429966,
-	1397671,
-	1556112,
-	-715625,
-	-1457140,
-	181481,
-	1215556,
-	183147,
-	-908968,
-	-385699,
-	600793,
-	453819,
-	-335224,
-	-425837,
-	136214,
-	342099,
-	-9706,
-	-238235,
-	-51986,
-	140936,
-	64820
+	130754
 
 };
 
 struct src_stage src_int32_10_21_4535_5000 = {
 	2, 1, 10, 172, 1720, 21, 10, 0, 1,
-	src_int32_10_21_4535_5000_fir};
+	src_int32_10_21_4535_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_1_2_4535_5000_fir[200] = {
+const int32_t src_int32_1_2_4535_5000_fir[100] = {
 	-84357,
 	50235,
 	139225,
@@ -107,110 +107,10 @@ const int32_t src_int32_1_2_4535_5000_fir[200] = {
 	-318949380,
 	-288878358,
 	673275541,
-	1754385456,
-	1754385456,
-	673275541,
-	-288878358,
-	-318949380,
-	122162882,
-	216966918,
-	-56184685,
-	-165179166,
-	20513896,
-	131785695,
-	1604602,
-	-107207496,
-	-16209471,
-	87624811,
-	26029055,
-	-71256846,
-	-32500220,
-	57190086,
-	36476272,
-	-44925759,
-	-38518842,
-	34178514,
-	39032330,
-	-24777037,
-	-38330725,
-	16611018,
-	36672451,
-	-9601236,
-	-34278963,
-	3682116,
-	31344654,
-	1208493,
-	-28041936,
-	-5135106,
-	24523651,
-	8167534,
-	-20924044,
-	-10381891,
-	17359034,
-	11860314,
-	-13926242,
-	-12689800,
-	10705076,
-	12960492,
-	-7757029,
-	-12763649,
-	5126279,
-	12189498,
-	-2840649,
-	-11325125,
-	912889,
-	10252525,
-	657725,
-	-9046916,
-	-1883559,
-	7775375,
-	2786607,
-	-6495849,
-	-3396388,
-	5256550,
-	3747828,
-	-4095751,
-	-3879209,
-	3041930,
-	3830245,
-	-2114262,
-	-3640362,
-	1323382,
-	3347216,
-	-672373,
-	-2985478,
-	157912,
-	2585926,
-	228488,
-	-2174817,
-	-499206,
-	1773556,
-	669274,
-	-1398622,
-	-755206,
-	1061730,
-	773956,
-	-770180,
-	-742023,
-	527362,
-	674732,
-	-333361,
-	-585693,
-	185624,
-	486442,
-	-79637,
-	-386259,
-	9590,
-	292130,
-	31015,
-	-208849,
-	-48832,
-	139225,
-	50235,
-	-84357
+	1754385456
 
 };
 
 struct src_stage src_int32_1_2_4535_5000 = {
 	1, 0, 1, 200, 200, 2, 1, 0, 1,
-	src_int32_1_2_4535_5000_fir};
+	src_int32_1_2_4535_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_1_3_2268_5000_fir[56] = {
+const int32_t src_int32_1_3_2268_5000_fir[28] = {
 	636662,
 	1367445,
 	1168433,
@@ -35,38 +35,10 @@ const int32_t src_int32_1_3_2268_5000_fir[56] = {
 	329128823,
 	953901216,
 	1547192859,
-	1908310509,
-	1908310509,
-	1547192859,
-	953901216,
-	329128823,
-	-140373711,
-	-354264540,
-	-325316190,
-	-153131824,
-	35627282,
-	147216043,
-	152749385,
-	82664699,
-	-5253484,
-	-62272596,
-	-70267160,
-	-41479156,
-	-2711393,
-	23219492,
-	28046417,
-	17380905,
-	2764092,
-	-6739201,
-	-8512773,
-	-5228555,
-	-1113091,
-	1168433,
-	1367445,
-	636662
+	1908310509
 
 };
 
 struct src_stage src_int32_1_3_2268_5000 = {
 	1, 0, 1, 56, 56, 3, 1, 0, 2,
-	src_int32_1_3_2268_5000_fir};
+	src_int32_1_3_2268_5000_fir, 1};
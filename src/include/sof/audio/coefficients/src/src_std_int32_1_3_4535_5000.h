@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_1_3_4535_5000_fir[268] = {
+const int32_t src_int32_1_3_4535_5000_fir[134] = {
 	53316,
 	-3193,
 	-78263,
@@ -141,144 +141,10 @@ const int32_t src_int32_1_3_4535_5000_fir[268] = {
 	-116659642,
 	295782476,
 	809543553,
-	1163409661,
-	1163409661,
-	809543553,
-	295782476,
-	-116659642,
-	-262519729,
-	-159328672,
-	34635074,
-	148889159,
-	116216226,
-	-4038926,
-	-97410434,
-	-93099762,
-	-11654755,
-	66916127,
-	77413504,
-	20706690,
-	-46235163,
-	-65279105,
-	-26044259,
-	31107760,
-	55149987,
-	28993377,
-	-19567058,
-	-46321273,
-	-30267040,
-	10580094,
-	38449669,
-	30305092,
-	-3546973,
-	-31364570,
-	-29411709,
-	-1913444,
-	24982482,
-	27817290,
-	6065370,
-	-19263960,
-	-25708241,
-	-9108138,
-	14190202,
-	23241795,
-	11204030,
-	-9749650,
-	-20553411,
-	-12493462,
-	5930190,
-	17760339,
-	13103138,
-	-2714719,
-	-14963245,
-	-13150167,
-	78881,
-	12246904,
-	12743797,
-	2009704,
-	-9680539,
-	-11985773,
-	-3591187,
-	7318144,
-	10969935,
-	4712513,
-	-5198989,
-	-9781482,
-	-5425956,
-	3348379,
-	8496154,
-	5787376,
-	-1778714,
-	-7179537,
-	-5854327,
-	490834,
-	5886597,
-	5684187,
-	524411,
-	-4661504,
-	-5332393,
-	-1284409,
-	3537793,
-	4850877,
-	1812940,
-	-2538830,
-	-4286781,
-	-2138313,
-	1678584,
-	3681471,
-	2291555,
-	-962640,
-	-3069891,
-	-2304734,
-	389390,
-	2480247,
-	2209466,
-	48640,
-	-1934003,
-	-2035646,
-	-363427,
-	1446165,
-	1810448,
-	570086,
-	-1025798,
-	-1557594,
-	-685589,
-	676729,
-	1296900,
-	727597,
-	-398384,
-	-1044078,
-	-713463,
-	186690,
-	810772,
-	659410,
-	-34996,
-	-604793,
-	-579922,
-	-65033,
-	430508,
-	487327,
-	122605,
-	-289345,
-	-391581,
-	-147088,
-	180355,
-	300219,
-	147424,
-	-100816,
-	-218458,
-	-131686,
-	46802,
-	149415,
-	106779,
-	-13727,
-	-94410,
-	-78263,
-	-3193,
-	53316
+	1163409661
 
 };
 
 struct src_stage src_int32_1_3_4535_5000 = {
 	1, 0, 1, 268, 268, 3, 1, 0, 1,
-	src_int32_1_3_4535_5000_fir};
+	src_int32_1_3_4535_5000_fir, 1};
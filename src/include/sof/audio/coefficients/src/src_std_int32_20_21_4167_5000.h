@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_20_21_4167_5000_fir[1120] = {
+const int32_t src_int32_20_21_4167_5000_fir[560] = {
 	125886,
 	-321269,
 	574508,
@@ -567,570 +567,10 @@ const int32_t src_int32_20_21_4167_5000_fir[1120] = {
 	-798871,
 	260367,
 	24757,
-	-108144,
-	-108144,
-	24757,
-	260367,
-	-798871,
-	1555852,
-	-2367514,
-	2928937,
-	-2831036,
-	1655256,
-	882741,
-	-4769151,
-	9553418,
-	-14287680,
-	17589915,
-	-17853736,
-	13593029,
-	-3870541,
-	-11273014,
-	30487632,
-	-50967293,
-	68531832,
-	-77904403,
-	73027484,
-	-47020773,
-	-9304735,
-	114490621,
-	-334589636,
-	1306281230,
-	1216042693,
-	-356677552,
-	141301234,
-	-32702884,
-	-29303630,
-	61529016,
-	-72189824,
-	67544022,
-	-53316405,
-	34716397,
-	-16077886,
-	513569,
-	10247759,
-	-15792425,
-	16751825,
-	-14409280,
-	10280019,
-	-5751754,
-	1844899,
-	885912,
-	-2323119,
-	2669933,
-	-2296784,
-	1597067,
-	-884345,
-	344043,
-	-35022,
-	-75467,
-	-140955,
-	87449,
-	167568,
-	-694288,
-	1483039,
-	-2395111,
-	3139852,
-	-3299428,
-	2413584,
-	-120239,
-	-3672943,
-	8629722,
-	-13893449,
-	18113193,
-	-19619328,
-	16746898,
-	-8265033,
-	-6165491,
-	25605269,
-	-47613852,
-	68249148,
-	-82272110,
-	83414496,
-	-64317346,
-	15021154,
-	84339117,
-	-304468061,
-	1390594526,
-	1120851741,
-	-370908161,
-	164439215,
-	-54781256,
-	-11498983,
-	49154524,
-	-65261060,
-	65328587,
-	-54636713,
-	38225542,
-	-20496867,
-	4806382,
-	6776653,
-	-13479348,
-	15620810,
-	-14261714,
-	10800367,
-	-6605122,
-	2749341,
-	120159,
-	-1786239,
-	2369112,
-	-2185638,
-	1607029,
-	-949846,
-	417402,
-	-90871,
-	-43588,
-	-173189,
-	151923,
-	67077,
-	-571875,
-	1378892,
-	-2377603,
-	3297148,
-	-3718194,
-	3146115,
-	-1145946,
-	-2481295,
-	7522044,
-	-13228222,
-	18305291,
-	-21049971,
-	19646149,
-	-12587267,
-	-845814,
-	20148859,
-	-43299878,
-	66676054,
-	-85182638,
-	92469905,
-	-80859370,
-	39853578,
-	51250200,
-	-266237144,
-	1468065936,
-	1021724627,
-	-377553538,
-	183647297,
-	-75182896,
-	6066922,
-	36150132,
-	-57270305,
-	61950119,
-	-54923154,
-	40963550,
-	-24455386,
-	8930180,
-	3246363,
-	-10962275,
-	14223755,
-	-13853382,
-	11109340,
-	-7316394,
-	3580661,
-	-627841,
-	-1231213,
-	2033344,
-	-2037474,
-	1586666,
-	-994926,
-	479506,
-	-141904,
-	-13113,
-	-204101,
-	216947,
-	-39449,
-	-433319,
-	1244300,
-	-2313838,
-	3396163,
-	-4077905,
-	3838174,
-	-2175404,
-	-1214616,
-	6247292,
-	-12298813,
-	18155779,
-	-22111995,
-	22231160,
-	-16754400,
-	4589822,
-	14210243,
-	-38088035,
-	63816410,
-	-86550573,
-	99993252,
-	-96318009,
-	64748753,
-	15695133,
-	-219925467,
-	1537847069,
-	919707785,
-	-376975272,
-	198744199,
-	-93591089,
-	23080292,
-	22767978,
-	-48386092,
-	57493340,
-	-54189810,
-	42894088,
-	-27888762,
-	12811820,
-	-276624,
-	-8291827,
-	12591945,
-	-13197354,
-	11205866,
-	-7875651,
-	4325195,
-	-1344625,
-	-668895,
-	1669954,
-	-1856275,
-	1537448,
-	-1019549,
-	529677,
-	-187381,
-	15420,
-	-232927,
-	281215,
-	-150158,
-	-280696,
-	1080782,
-	-2203524,
-	3433225,
-	-4370004,
-	4475475,
-	-3189094,
-	104776,
-	4825926,
-	-11117198,
-	17660489,
-	-22778035,
-	24447093,
-	-20684948,
-	10041239,
-	7892058,
-	-32059038,
-	59698245,
-	-86317499,
-	105807911,
-	-110375690,
-	89247475,
-	-21792170,
-	-165668039,
-	1599169017,
-	815864284,
-	-369617105,
-	209624906,
-	-109733703,
-	39245082,
-	9261524,
-	-38789892,
-	52061156,
-	-52469293,
-	43996403,
-	-30743213,
-	16384008,
-	-3727221,
-	-5520482,
-	10760391,
-	-12311029,
-	11092850,
-	-8276040,
-	4971231,
-	-2017663,
-	-109977,
-	1286567,
-	-1646521,
-	1461342,
-	-1024070,
-	567500,
-	-226709,
-	41550,
-	-258903,
-	343367,
-	-263029,
-	-116443,
-	890482,
-	-2047267,
-	3405748,
-	-4586999,
-	5044412,
-	-4167319,
-	1453036,
-	3281649,
-	-9700394,
-	16821720,
-	-23027679,
-	26245026,
-	-24300350,
-	15406084,
-	1306004,
-	-25310485,
-	54373713,
-	-84453653,
-	109764895,
-	-122732166,
-	112882753,
-	-60621401,
-	-103706979,
-	1651352559,
-	711260171,
-	-355996556,
-	216259743,
-	-123386655,
-	54287839,
-	-4119057,
-	-28672543,
-	45772425,
-	-49811801,
-	44265418,
-	-32976658,
-	19586431,
-	-7042924,
-	-2701563,
-	8767105,
-	-11215725,
-	10777033,
-	-8513827,
-	5509185,
-	-2635571,
-	435213,
-	890953,
-	-1413086,
-	1360756,
-	-1009218,
-	592822,
-	-259453,
-	64898,
-	-281277,
-	402015,
-	-375907,
-	56674,
-	676144,
-	-1846586,
-	3312320,
-	-4722632,
-	5532331,
-	-5090576,
-	2805218,
-	1641027,
-	-8070241,
-	15648323,
-	-22847987,
-	27582993,
-	-27526503,
-	20581714,
-	-5429076,
-	-17955350,
-	47918593,
-	-80959071,
-	111746227,
-	-133110425,
-	135187782,
-	-100153163,
-	-34390690,
-	1693817213,
-	606950905,
-	-336695652,
-	218692296,
-	-134376456,
-	67962048,
-	-17131341,
-	-18230581,
-	38759476,
-	-46283864,
-	43711538,
-	-34559276,
-	22366752,
-	-10164918,
-	111770,
-	6652333,
-	-9936190,
-	10268782,
-	-8588395,
-	5931725,
-	-3188291,
-	956891,
-	490881,
-	-1161130,
-	1238476,
-	-976064,
-	605739,
-	-285333,
-	85170,
-	-299331,
-	455774,
-	-486539,
-	235604,
-	441082,
-	-1603916,
-	3152759,
-	-4772038,
-	5927805,
-	-5939933,
-	4135718,
-	-66956,
-	-6253091,
-	14155670,
-	-22233886,
-	28426907,
-	-30295246,
-	25467129,
-	-12189305,
-	-10120158,
-	40431344,
-	-75864222,
-	111667834,
-	-141262323,
-	155704158,
-	-139707237,
-	41828492,
-	1726088979,
-	503968068,
-	-312350939,
-	217036224,
-	-142581840,
-	80051889,
-	-29544873,
-	-7662539,
-	31165421,
-	-41966825,
-	42360176,
-	-35473835,
-	24681427,
-	-13039103,
-	2867502,
-	4457758,
-	-8500080,
-	9581817,
-	-8502186,
-	6233855,
-	-3667253,
-	1445990,
-	93967,
-	-895995,
-	1097601,
-	-925991,
-	606588,
-	-304223,
-	102158,
-	-312400,
-	503290,
-	-592620,
-	417064,
-	189133,
-	-1322586,
-	2928158,
-	-4731876,
-	6220880,
-	-6697408,
-	5418756,
-	-1811396,
-	-4279399,
-	12365492,
-	-21188417,
-	28751356,
-	-32545759,
-	29964898,
-	-18847996,
-	-1942877,
-	32031720,
-	-69230078,
-	109481876,
-	-146973848,
-	173990164,
-	-178571693,
-	124398159,
-	1747806687,
-	403306539,
-	-283642917,
-	211471046,
-	-147934437,
-	90375370,
-	-41145087,
-	2834716,
-	23141323,
-	-36955058,
-	40251006,
-	-35715778,
-	26496350,
-	-15617006,
-	5515713,
-	2225697,
-	-6937369,
-	8732882,
-	-8260580,
-	6412952,
-	-4065488,
-	1894310,
-	-292462,
-	-623096,
-	941473,
-	-860646,
-	595926,
-	-316147,
-	115743,
-	-319883,
-	543269,
-	-691836,
-	597589,
-	-75399,
-	-1006784,
-	2640899,
-	-4600439,
-	6403310,
-	-7346339,
-	6628860,
-	-3560016,
-	-2183233,
-	10305596,
-	-19722840,
-	28540252,
-	-34225844,
-	33983063,
-	-25277982,
-	6429449,
-	22858953,
-	-61147635,
-	105178476,
-	-150069906,
-	189629029,
-	-216012726,
-	212671156,
-	1758726828,
-	305912317,
-	-251285082,
-	202236992,
-	-150418530,
-	98786784,
-	-51736860,
-	13069550,
-	14843278,
-	-31353996,
-	37436971,
-	-35293075,
-	27787309,
-	-17856576,
-	8009461,
-	-1700,
-	-5279754,
-	7741360,
-	-7871729,
-	6468754,
-	-4377725,
-	2294646,
-	-661501,
-	-347815,
-	773601,
-	-781908,
-	574508,
-	-321269,
-	125886
+	-108144
 
 };
 
 struct src_stage src_int32_20_21_4167_5000 = {
 	1, 1, 20, 56, 1120, 21, 20, 0, 0,
-	src_int32_20_21_4167_5000_fir};
+	src_int32_20_21_4167_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_20_7_2976_5000_fir[480] = {
+const int32_t src_int32_20_7_2976_5000_fir[240] = {
 	-256723,
 	1344746,
 	-2486660,
@@ -247,250 +247,10 @@ const int32_t src_int32_20_7_2976_5000_fir[480] = {
 	10398097,
 	-4932590,
 	1005906,
-	175685,
-	175685,
-	1005906,
-	-4932590,
-	10398097,
-	-10860107,
-	-3878880,
-	39286714,
-	-84545738,
-	106019809,
-	-49394345,
-	-175763838,
-	1170223995,
-	1105662099,
-	-209429797,
-	-23091857,
-	93468962,
-	-82660716,
-	42514303,
-	-7701529,
-	-8530533,
-	9629912,
-	-4964038,
-	1188383,
-	83482,
-	277852,
-	785957,
-	-4812965,
-	11043746,
-	-13146676,
-	202077,
-	35283230,
-	-85183602,
-	117488238,
-	-76324425,
-	-136700052,
-	1230165094,
-	1037065415,
-	-237649478,
-	2236568,
-	80069897,
-	-79610761,
-	44951408,
-	-11219206,
-	-6196888,
-	8759054,
-	-4913133,
-	1333417,
-	2078,
-	388813,
-	529258,
-	-4600534,
-	11547875,
-	-15349871,
-	4488098,
-	30531607,
-	-84508106,
-	127646050,
-	-103509015,
-	-92347211,
-	1284937076,
-	965051045,
-	-260433716,
-	26274465,
-	66059175,
-	-75492215,
-	46596269,
-	-14392256,
-	-3896107,
-	7805887,
-	-4786710,
-	1441735,
-	-68016,
-	507055,
-	237335,
-	-4292028,
-	11892777,
-	-17428496,
-	8919923,
-	25072920,
-	-82470803,
-	136274740,
-	-130552275,
-	-42874712,
-	1334035510,
-	890260280,
-	-277850917,
-	48738256,
-	51672186,
-	-70413498,
-	47459422,
-	-17188341,
-	-1662635,
-	6790900,
-	-4592426,
-	1514691,
-	-126597,
-	630726,
-	-87448,
-	-3885702,
-	12062407,
-	-19341191,
-	13432966,
-	18961492,
-	-79042523,
-	143169199,
-	-157039901,
-	11487844,
-	1377005590,
-	813351472,
-	-290024675,
-	69379621,
-	37139770,
-	-64492961,
-	47563003,
-	-19582602,
-	472008,
-	5734358,
-	-4338570,
-	1554188,
-	-173742,
-	757646,
-	-441871,
-	-3381467,
-	12042769,
-	-21047124,
-	17958130,
-	12264611,
-	-74214664,
-	148141360,
-	-182543791,
-	70451819,
-	1413447322,
-	734992775,
-	-297130784,
-	87987310,
-	22685034,
-	-57856679,
-	46939894,
-	-21557704,
-	2479587,
-	4655972,
-	-4033875,
-	1562603,
-	-209785,
-	885325,
-	-821850,
-	-2781010,
-	11822288,
-	-22506719,
-	22422731,
-	5062027,
-	-68000205,
-	151023745,
-	-206627048,
-	133671448,
-	1443020096,
-	655854845,
-	-299393672,
-	104388416,
-	8520404,
-	-50636218,
-	45632743,
-	-23103753,
-	4335443,
-	3574601,
-	-3687330,
-	1542701,
-	-235284,
-	1010988,
-	-1222450,
-	-2087883,
-	11392151,
-	-23682389,
-	26751530,
-	-2554778,
-	-60434436,
-	151672845,
-	-228849250,
-	200746465,
-	1465446600,
-	576603587,
-	-297082341,
-	118449090,
-	-5155053,
-	-42966397,
-	43692864,
-	-24218101,
-	6018699,
-	2507980,
-	-3308001,
-	1497545,
-	-250985,
-	1131618,
-	-1637919,
-	-1307565,
-	10746634,
-	-24539283,
-	30867847,
-	-10483542,
-	-51575356,
-	149972291,
-	-248771931,
-	271225445,
-	1480516005,
-	497893035,
-	-290505844,
-	130074709,
-	-18158004,
-	-34983105,
-	41179060,
-	-24905037,
-	7512409,
-	1472489,
-	-2904866,
-	1430421,
-	-257790,
-	1243993,
-	-2061731,
-	-447489,
-	9883375,
-	-25046017,
-	34694762,
-	-18612384,
-	-41503751,
-	145835752,
-	-265964196,
-	344609809,
-	1488086393,
-	420358466,
-	-280008402,
-	139209517,
-	-30322914,
-	-26821177,
-	38156367,
-	-25175385,
-	8803622,
-	482960,
-	-2486660,
-	1344746,
-	-256723
+	175685
 
 };
 
 struct src_stage src_int32_20_7_2976_5000 = {
 	1, 3, 20, 24, 480, 7, 20, 0, 0,
-	src_int32_20_7_2976_5000_fir};
+	src_int32_20_7_2976_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_21_20_4167_5000_fir[1092] = {
+const int32_t src_int32_21_20_4167_5000_fir[546] = {
 	-148365,
 	253251,
 	-300044,
@@ -553,556 +553,10 @@ const int32_t src_int32_21_20_4167_5000_fir[1092] = {
 	-97991225,
 	192548148,
 	-389242219,
-	1276735561,
-	1276735561,
-	-389242219,
-	192548148,
-	-97991225,
-	41013562,
-	-4294518,
-	-18952542,
-	32289015,
-	-38134741,
-	38454339,
-	-34970939,
-	29201397,
-	-22428631,
-	15664078,
-	-9625642,
-	4741422,
-	-1179906,
-	-1098814,
-	2279687,
-	-2627070,
-	2425723,
-	-1934954,
-	1359301,
-	-835989,
-	436725,
-	-179653,
-	-158038,
-	409128,
-	-817788,
-	1379185,
-	-2036136,
-	2663971,
-	-3064512,
-	2973875,
-	-2087313,
-	101840,
-	3225807,
-	-8011590,
-	14175443,
-	-21381358,
-	28995789,
-	-36071041,
-	41354530,
-	-43315322,
-	40163908,
-	-29812468,
-	9657239,
-	24122758,
-	-78723625,
-	172418462,
-	-374320235,
-	1371492118,
-	1176780210,
-	-396202914,
-	208365225,
-	-114883829,
-	56728449,
-	-17858858,
-	-7964791,
-	23971387,
-	-32348243,
-	34898342,
-	-33245339,
-	28863054,
-	-23040137,
-	16832058,
-	-11026626,
-	6134795,
-	-2408993,
-	-115216,
-	1562212,
-	-2153762,
-	2150023,
-	-1801289,
-	1314775,
-	-837618,
-	454488,
-	-196202,
-	-131473,
-	371717,
-	-782605,
-	1373031,
-	-2101682,
-	2858925,
-	-3456591,
-	3630827,
-	-3061969,
-	1413132,
-	1613909,
-	-6210372,
-	12387561,
-	-19909241,
-	28239346,
-	-36512758,
-	43531654,
-	-47780750,
-	47439236,
-	-40338013,
-	23743694,
-	6341573,
-	-57365516,
-	148165618,
-	-351150697,
-	1460028025,
-	1072693503,
-	-395582527,
-	219760264,
-	-129167353,
-	71010149,
-	-30795665,
-	2946086,
-	15372957,
-	-26074168,
-	30764655,
-	-30938080,
-	27997590,
-	-23213259,
-	17664378,
-	-12193161,
-	7382834,
-	-3563842,
-	845301,
-	835459,
-	-1654484,
-	1843234,
-	-1638800,
-	1247420,
-	-823393,
-	462594,
-	-207687,
-	-100192,
-	324719,
-	-730354,
-	1339905,
-	-2129028,
-	3005395,
-	-3794399,
-	4236922,
-	-4003815,
-	2729728,
-	-65882,
-	-4252020,
-	10327964,
-	-18031467,
-	26935463,
-	-36274990,
-	44930776,
-	-51433125,
-	53966307,
-	-50324581,
-	37703923,
-	-12020719,
-	-34248170,
-	120058811,
-	-319547822,
-	1541380411,
-	965574536,
-	-387847468,
-	226702870,
-	-140660768,
-	83633578,
-	-42881510,
-	13580950,
-	6657687,
-	-19437611,
-	26140600,
-	-28102936,
-	26631281,
-	-22953565,
-	18152577,
-	-13108687,
-	8465674,
-	-4624776,
-	1765456,
-	113226,
-	-1139329,
-	1512104,
-	-1451564,
-	1159418,
-	-794303,
-	461406,
-	-214216,
-	-64550,
-	268575,
-	-661292,
-	1279372,
-	-2116265,
-	3098967,
-	-4069814,
-	4779139,
-	-4894023,
-	4026693,
-	-1783226,
-	-2170207,
-	8029917,
-	-15775292,
-	25097943,
-	-35349048,
-	45510558,
-	-54187936,
-	59607514,
-	-59573385,
-	51273443,
-	-30636165,
-	-9745121,
-	88445423,
-	-279431514,
-	1614658080,
-	856539835,
-	-373541538,
-	229239476,
-	-149237778,
-	94409091,
-	-53913345,
-	23749746,
-	-2011483,
-	-12567987,
-	21120916,
-	-24802430,
-	24799176,
-	-22274546,
-	18294762,
-	-13761673,
-	9366983,
-	-5574342,
-	2629159,
-	-591147,
-	-618392,
-	1163621,
-	-1243986,
-	1053259,
-	-751588,
-	451454,
-	-215999,
-	-25024,
-	203942,
-	-576030,
-	1191526,
-	-2062208,
-	3136112,
-	-4275678,
-	5245328,
-	-5714267,
-	5278863,
-	-3506371,
-	-1690,
-	5531904,
-	-13175685,
-	22750948,
-	-33739058,
-	45244301,
-	-55975907,
-	64239127,
-	-67895272,
-	64189024,
-	-49163659,
-	15733235,
-	53748160,
-	-230831156,
-	1679053311,
-	746709000,
-	-353276190,
-	227489980,
-	-154827509,
-	103185037,
-	-63711743,
-	33274801,
-	-10475609,
-	-5596560,
-	15805872,
-	-21106513,
-	22544278,
-	-21197204,
-	18095511,
-	-14145721,
-	10074178,
-	-6397585,
-	3421790,
-	-1265023,
-	-101577,
-	804881,
-	-1020701,
-	931684,
-	-696695,
-	433415,
-	-213333,
-	17791,
-	131688,
-	-475532,
-	1077005,
-	-1966436,
-	3114286,
-	-4405963,
-	5624466,
-	-6447091,
-	6461321,
-	-5202728,
-	2214320,
-	2877007,
-	-10274824,
-	19928738,
-	-31462127,
-	44120724,
-	-56744596,
-	67753885,
-	-75114450,
-	76193594,
-	-67254839,
-	41745825,
-	16460928,
-	-173887893,
-	1733852586,
-	637190454,
-	-327720020,
-	221643306,
-	-157414230,
-	109849580,
-	-72123658,
-	41993823,
-	-18582587,
-	1346008,
-	10299303,
-	-17091120,
-	19916591,
-	-19749515,
-	17565651,
-	-14259577,
-	10578583,
-	-7082270,
-	4130433,
-	-1896682,
-	401584,
-	442941,
-	-786478,
-	797620,
-	-631244,
-	408096,
-	-206594,
-	63190,
-	52885,
-	-361114,
-	937004,
-	-1829335,
-	3032010,
-	-4455925,
-	5906903,
-	-7076264,
-	7549877,
-	-6839472,
-	4436862,
-	112182,
-	-7121438,
-	16675229,
-	-28548276,
-	42144471,
-	-56459696,
-	70063328,
-	-81072038,
-	87041119,
-	-84560253,
-	67827790,
-	-22856546,
-	-108855370,
-	1778446098,
-	529067481,
-	-297587677,
-	211951991,
-	-157036133,
-	114331768,
-	-79024638,
-	49762567,
-	-26189820,
-	8132057,
-	4706629,
-	-12836658,
-	16972057,
-	-17965764,
-	16721924,
-	-14107040,
-	10875497,
-	-7619042,
-	4744073,
-	-2475521,
-	882096,
-	84690,
-	-546125,
-	654120,
-	-556988,
-	376406,
-	-196221,
-	110367,
-	-31202,
-	-234431,
-	773268,
-	-1652111,
-	2888933,
-	-4422234,
-	6084582,
-	-7587128,
-	8521553,
-	-8384165,
-	6623954,
-	-2712550,
-	-3770016,
-	13043342,
-	-25040115,
-	39336334,
-	-55106036,
-	71099825,
-	-85629375,
-	96501411,
-	-100735707,
-	93497987,
-	-63585259,
-	-36098867,
-	1812335900,
-	423384751,
-	-263628339,
-	198725893,
-	-153783204,
-	116601851,
-	-84320484,
-	56457111,
-	-33166657,
-	14639231,
-	-867126,
-	-8426423,
-	13771400,
-	-15885789,
-	15586558,
-	-13696782,
-	10964194,
-	-8001533,
-	5253760,
-	-2992218,
-	1331662,
-	-263274,
-	-304392,
-	504292,
-	-475770,
-	339334,
-	-182704,
-	158426,
-	-119135,
-	-97459,
-	588081,
-	-1436800,
-	2685872,
-	-4303075,
-	6151241,
-	-7966914,
-	9355049,
-	-9805380,
-	8733380,
-	-5544994,
-	-279892,
-	9094186,
-	-20992285,
-	35733161,
-	-52688233,
-	70818254,
-	-88671030,
-	104364730,
-	-115448664,
-	118266980,
-	-105054593,
-	43907150,
-	1835142568,
-	321135533,
-	-226613958,
-	182325160,
-	-147794258,
-	116670859,
-	-87948323,
-	61975727,
-	-39396566,
-	20752631,
-	-6319272,
-	-3945006,
-	10378908,
-	-13554119,
-	14186734,
-	-13042081,
-	10847843,
-	-8226411,
-	5652714,
-	-3438876,
-	1742814,
-	-594767,
-	-65886,
-	351244,
-	-389487,
-	297924,
-	-166569,
-	206397,
-	-209322,
-	47534,
-	384239,
-	-1186255,
-	2424839,
-	-4098230,
-	6102582,
-	-8205040,
-	10031194,
-	-11073331,
-	10723485,
-	-8331721,
-	3285785,
-	4896061,
-	-16470657,
-	31387478,
-	-49230987,
-	69197295,
-	-90107433,
-	110446135,
-	-128384601,
-	141645404,
-	-146550977,
-	130583077,
-	1846610288,
-	223249753,
-	-187327445,
-	163152569,
-	-139253201,
-	114589459,
-	-89877091,
-	66240300,
-	-44779009,
-	26366797,
-	-11551306,
-	523301,
-	6861167,
-	-11019062,
-	12553979,
-	-12160474,
-	10533360,
-	-8293365,
-	5936407,
-	-3809131,
-	2109032,
-	-904116,
-	165016,
-	198018,
-	-300044,
-	253251,
-	-148365
+	1276735561
 
 };
 
 struct src_stage src_int32_21_20_4167_5000 = {
 	19, 20, 21, 52, 1092, 20, 21, 0, 0,
-	src_int32_21_20_4167_5000_fir};
+	src_int32_21_20_4167_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_21_40_3968_5000_fir[1596] = {
+const int32_t src_int32_21_40_3968_5000_fir[798] = {
 	-210430,
 	-287852,
 	472564,
@@ -805,808 +805,10 @@ const int32_t src_int32_21_40_3968_5000_fir[1596] = {
 	-329603487,
 	-251343660,
 	695018080,
-	1723437527,
-	1723437527,
-	695018080,
-	-251343660,
-	-329603487,
-	81287723,
-	215699855,
-	-15417310,
-	-152222111,
-	-16831949,
-	108371766,
-	32672073,
-	-75397130,
-	-38852604,
-	50048414,
-	38969684,
-	-30812964,
-	-35375044,
-	16740807,
-	29777723,
-	-7027948,
-	-23447966,
-	880758,
-	17292371,
-	2500322,
-	-11895048,
-	-3887160,
-	7559690,
-	3976319,
-	-4362496,
-	-3347674,
-	2214316,
-	2439778,
-	-925319,
-	-1545403,
-	264343,
-	825446,
-	-6381,
-	-335964,
-	-341675,
-	32751,
-	845377,
-	185963,
-	-1601553,
-	-795701,
-	2567871,
-	2029422,
-	-3598458,
-	-4134252,
-	4414162,
-	7325359,
-	-4585004,
-	-11726918,
-	3530392,
-	17306456,
-	-539337,
-	-23810485,
-	-5192306,
-	30708509,
-	14517920,
-	-37148028,
-	-28310208,
-	41912216,
-	47483172,
-	-43348373,
-	-73140842,
-	39178196,
-	107029857,
-	-25935020,
-	-152822111,
-	-2838862,
-	220264587,
-	63567892,
-	-343649489,
-	-224277992,
-	752252637,
-	1752684606,
-	1691601700,
-	638051539,
-	-276167325,
-	-314367895,
-	98211842,
-	210180640,
-	-27704648,
-	-150893790,
-	-7780782,
-	109169010,
-	26094810,
-	-77257495,
-	-34226178,
-	52337275,
-	35875464,
-	-33133274,
-	-33453077,
-	18852431,
-	28714456,
-	-8803644,
-	-22976186,
-	2275500,
-	17193937,
-	1474396,
-	-12002099,
-	-3182288,
-	7752627,
-	3527204,
-	-4564640,
-	-3085633,
-	2384041,
-	2302607,
-	-1046911,
-	-1483033,
-	338901,
-	801922,
-	-43858,
-	-328628,
-	-345644,
-	73376,
-	861477,
-	104065,
-	-1651005,
-	-658525,
-	2685999,
-	1829963,
-	-3836462,
-	-3880539,
-	4838297,
-	7050060,
-	-5272187,
-	-11497529,
-	4559520,
-	17234818,
-	-1978093,
-	-24060354,
-	-3304986,
-	31500376,
-	12193272,
-	-38761285,
-	-25634968,
-	44686575,
-	44650586,
-	-47689665,
-	-70494448,
-	45580316,
-	105142145,
-	-35046347,
-	-152679231,
-	9974948,
-	223833981,
-	45117567,
-	-356406593,
-	-194994925,
-	809606397,
-	1779257455,
-	1657269966,
-	581499433,
-	-298732253,
-	-298044267,
-	114279959,
-	203751386,
-	-39647425,
-	-148854921,
-	1175713,
-	109425325,
-	19479175,
-	-78718110,
-	-29493242,
-	54342179,
-	32646567,
-	-35262191,
-	-31393456,
-	20843963,
-	27525713,
-	-10511538,
-	-22399025,
-	3638417,
-	17012930,
-	457599,
-	-12048549,
-	-2473992,
-	7903957,
-	3069261,
-	-4740193,
-	-2813884,
-	2538081,
-	2157269,
-	-1160062,
-	-1414939,
-	409362,
-	775056,
-	-79533,
-	-319786,
-	-347763,
-	115318,
-	873520,
-	18982,
-	-1693305,
-	-514313,
-	2793307,
-	1616636,
-	-4060194,
-	-3602133,
-	5246316,
-	6734433,
-	-5945068,
-	-11207010,
-	5582544,
-	17076485,
-	-3428620,
-	-24194696,
-	-1374626,
-	32147486,
-	9776998,
-	-40204722,
-	-22798191,
-	47276894,
-	41561121,
-	-51853109,
-	-67465751,
-	51845631,
-	102710128,
-	-44121598,
-	-151782247,
-	22966293,
-	226371021,
-	26006705,
-	-367778150,
-	-163526946,
-	866928636,
-	1803078261,
-	1620542203,
-	525505307,
-	-319029542,
-	-280735978,
-	129436859,
-	196459870,
-	-51194697,
-	-146126362,
-	9995840,
-	109146987,
-	12857684,
-	-79777130,
-	-24678148,
-	56057024,
-	29300445,
-	-37191821,
-	-29208036,
-	22707276,
-	26219016,
-	-12144214,
-	-21720825,
-	4963290,
-	16751504,
-	-545206,
-	-12035171,
-	-1765833,
-	8013681,
-	2604932,
-	-4888811,
-	-2533993,
-	2676012,
-	2004699,
-	-1264411,
-	-1341635,
-	475482,
-	745111,
-	-113277,
-	-309565,
-	-347930,
-	158385,
-	881296,
-	-68924,
-	-1728023,
-	-363635,
-	2888975,
-	1390224,
-	-4268207,
-	-3299954,
-	5635845,
-	6379336,
-	-6600016,
-	-10855798,
-	6594250,
-	16830910,
-	-4883871,
-	-24211170,
-	589798,
-	32644640,
-	7279821,
-	-41468955,
-	-19811764,
-	49668006,
-	38226648,
-	-55815901,
-	-64064528,
-	57941563,
-	99737970,
-	-53115960,
-	-150123373,
-	36075505,
-	227842769,
-	6309805,
-	-377670587,
-	-129914401,
-	924067216,
-	1824077143,
-	1581524974,
-	470209371,
-	-337058058,
-	-262547805,
-	143632544,
-	188356926,
-	-62298217,
-	-142731912,
-	18639152,
-	108342750,
-	6262448,
-	-80434676,
-	-19805336,
-	57477199,
-	25854894,
-	-38915341,
-	-26909133,
-	24434982,
-	24802364,
-	-13694731,
-	-20946362,
-	6244179,
-	16412176,
-	-1529303,
-	-11963020,
-	-1061310,
-	8082008,
-	2136648,
-	-5010291,
-	-2247535,
-	2797503,
-	1845845,
-	-1359653,
-	-1263649,
-	537047,
-	712357,
-	-144974,
-	-298094,
-	-346050,
-	202372,
-	884614,
-	-159265,
-	-1754762,
-	-207112,
-	2972226,
-	1151594,
-	-4459105,
-	-2975059,
-	6004559,
-	5985845,
-	-7233428,
-	-10444643,
-	7589396,
-	16497971,
-	-6336669,
-	-24107989,
-	2579014,
-	32987313,
-	4713011,
-	-42545359,
-	-16688468,
-	51845530,
-	34660393,
-	-59555926,
-	-60302512,
-	63835918,
-	96232517,
-	-61984345,
-	-147698348,
-	49241317,
-	228220585,
-	-13894320,
-	-385993807,
-	-94205444,
-	980869095,
-	1842192408,
-	1540331156,
-	415748053,
-	-352824335,
-	-243585502,
-	156822341,
-	179496171,
-	-72912617,
-	-138698156,
-	27066628,
-	107023774,
-	-274973,
-	-80692810,
-	-14899211,
-	58599582,
-	22327968,
-	-40427025,
-	-24509456,
-	26020452,
-	23284187,
-	-15156646,
-	-20080821,
-	7475450,
-	15997814,
-	-2490146,
-	-11833428,
-	-363844,
-	8109348,
-	1666811,
-	-5104571,
-	-1956085,
-	2902311,
-	1681663,
-	-1445538,
-	-1181518,
-	593874,
-	677069,
-	-174528,
-	-285503,
-	-342041,
-	247059,
-	883300,
-	-251631,
-	-1773155,
-	-45413,
-	3042330,
-	901699,
-	-4631549,
-	-2628645,
-	6350197,
-	5555247,
-	-7841746,
-	-9974612,
-	8562744,
-	16077987,
-	-7779741,
-	-23883937,
-	4583499,
-	33171688,
-	2088334,
-	-43426129,
-	-13441927,
-	53795951,
-	30876894,
-	-63051873,
-	-56193355,
-	69497047,
-	92203304,
-	-70681604,
-	-144506516,
-	62401126,
-	227480333,
-	-34522784,
-	-392661589,
-	-56455965,
-	1037180833,
-	1857370766,
-	1497079539,
-	362253565,
-	-366342456,
-	-223955380,
-	168966989,
-	169933709,
-	-82995568,
-	-134054299,
-	35240837,
-	105203532,
-	-6723719,
-	-80555497,
-	-9984024,
-	59422540,
-	18737886,
-	-41722251,
-	-22022039,
-	27457844,
-	21673298,
-	-16524043,
-	-19129758,
-	8651796,
-	15511608,
-	-3423372,
-	-11647989,
-	323239,
-	8096310,
-	1197789,
-	-5171726,
-	-1661210,
-	2990288,
-	1513118,
-	-1521869,
-	-1095787,
-	645811,
-	639529,
-	-201857,
-	-271927,
-	-335827,
-	292217,
-	877202,
-	-345583,
-	-1782868,
-	120752,
-	3098608,
-	641569,
-	-4784268,
-	-2262042,
-	6670573,
-	5089042,
-	-8421481,
-	-9447084,
-	9509078,
-	15571712,
-	-9205759,
-	-23538385,
-	6593520,
-	33194680,
-	-582001,
-	-44104324,
-	-10086553,
-	55506702,
-	26891947,
-	-66283350,
-	-51752590,
-	74894007,
-	87662543,
-	-79162738,
-	-140550880,
-	75491254,
-	225602574,
-	-55488894,
-	-397591973,
-	-16729473,
-	1092849108,
-	1869567514,
-	1451894417,
-	309853495,
-	-377633898,
-	-203763891,
-	180032703,
-	159727845,
-	-92507928,
-	-128831990,
-	43126094,
-	102897722,
-	-13053766,
-	-80028562,
-	-5083761,
-	59945915,
-	15102941,
-	-42797516,
-	-19460176,
-	28742120,
-	19978847,
-	-17791552,
-	-18099072,
-	9768259,
-	14957057,
-	-4324828,
-	-11408546,
-	996721,
-	8043692,
-	731897,
-	-5211969,
-	-1364462,
-	3061371,
-	1341170,
-	-1588508,
-	-1007003,
-	692739,
-	600023,
-	-226895,
-	-257499,
-	-327347,
-	337603,
-	866190,
-	-440664,
-	-1783608,
-	290628,
-	3140437,
-	372313,
-	-4916067,
-	-1876711,
-	6963588,
-	4588938,
-	-8969226,
-	-8863753,
-	10423240,
-	14980350,
-	-10607370,
-	-23071300,
-	8599180,
-	33053965,
-	-3285392,
-	-44573914,
-	-6637480,
-	56966230,
-	22722544,
-	-69230998,
-	-46997578,
-	79996723,
-	82625101,
-	-87383120,
-	-135838147,
-	88447226,
-	222572738,
-	-76702436,
-	-400707633,
-	24903034,
-	1147721236,
-	1878746701,
-	1404905152,
-	258670407,
-	-386727364,
-	-183117209,
-	189991216,
-	148938783,
-	-101413867,
-	-123065140,
-	50688600,
-	100124157,
-	-19236059,
-	-79119644,
-	-222030,
-	60171009,
-	11441411,
-	-43650436,
-	-16837351,
-	29869056,
-	18210265,
-	-18954369,
-	-16994966,
-	10820250,
-	14337944,
-	-5190580,
-	-11117184,
-	1653507,
-	7952478,
-	271394,
-	-5225642,
-	-1067368,
-	3115588,
-	1166777,
-	-1645366,
-	-915717,
-	734568,
-	558837,
-	-249593,
-	-242352,
-	-316548,
-	382965,
-	850156,
-	-536397,
-	-1775121,
-	463422,
-	3167256,
-	95108,
-	-5025834,
-	-1474234,
-	7227244,
-	4056846,
-	-9481680,
-	-8226619,
-	11300148,
-	14305546,
-	-11977232,
-	-22483255,
-	10590465,
-	32748000,
-	-6008908,
-	-44829822,
-	-3110505,
-	58164074,
-	18386805,
-	-71876596,
-	-41947448,
-	84776141,
-	77108470,
-	-95298710,
-	-130378753,
-	101204058,
-	218381278,
-	-98069979,
-	-401936243,
-	68363245,
-	1201645683,
-	1884881251,
-	1356245724,
-	208821474,
-	-393658572,
-	-162120832,
-	198819794,
-	137628320,
-	-109680988,
-	-116789728,
-	57896583,
-	96902655,
-	-25242640,
-	-77838126,
-	4578056,
-	60100556,
-	7771468,
-	-44279741,
-	-14167168,
-	30835257,
-	16377222,
-	-20008273,
-	-15823920,
-	11803567,
-	13658313,
-	-6016939,
-	-10776208,
-	2290639,
-	7823825,
-	-181533,
-	-5213215,
-	-771427,
-	3153049,
-	990885,
-	-1692413,
-	-822475,
-	771239,
-	516256,
-	-269918,
-	-226619,
-	-303391,
-	428042,
-	829019,
-	-632286,
-	-1757196,
-	638308,
-	3178570,
-	-188799,
-	-5112546,
-	-1056318,
-	7459654,
-	3494871,
-	-9955662,
-	-7537989,
-	12134829,
-	13549390,
-	-13308058,
-	-21775434,
-	12557295,
-	32276042,
-	-8739344,
-	-44867962,
-	477987,
-	59090927,
-	13903900,
-	-74203167,
-	-36623029,
-	89204386,
-	71132714,
-	-102866273,
-	-124186874,
-	113696543,
-	213023812,
-	-119495190,
-	-401210816,
-	113565721,
-	1254472587,
-	1887953061,
-	1306054266,
-	160418126,
-	-398470037,
-	-140879176,
-	206501229,
-	125859548,
-	-117280415,
-	-110043601,
-	64720412,
-	93254914,
-	-31046767,
-	-76195076,
-	9293973,
-	59738695,
-	4111092,
-	-44685272,
-	-11463284,
-	31638162,
-	14489570,
-	-20949636,
-	-14592646,
-	12714409,
-	12922443,
-	-6800465,
-	-10388131,
-	2905310,
-	7659057,
-	-624777,
-	-5175280,
-	-478099,
-	3173952,
-	814425,
-	-1729666,
-	-727820,
-	802722,
-	472564,
-	-287852,
-	-210430
+	1723437527
 
 };
 
 struct src_stage src_int32_21_40_3968_5000 = {
 	19, 10, 21, 76, 1596, 40, 21, 0, 1,
-	src_int32_21_40_3968_5000_fir};
+	src_int32_21_40_3968_5000_fir, 1};
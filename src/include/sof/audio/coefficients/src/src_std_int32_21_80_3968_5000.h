@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_21_80_3968_5000_fir[3108] = {
+const int32_t src_int32_21_80_3968_5000_fir[1554] = {
 	-174020,
 	2072,
 	309190,
@@ -1561,1564 +1561,10 @@ const int32_t src_int32_21_80_3968_5000_fir[3108] = {
 	402093888,
 	994716615,
 	1529451361,
-	1846064414,
-	1846064414,
-	1529451361,
-	994716615,
-	402093888,
-	-84898066,
-	-356061992,
-	-387299524,
-	-238318102,
-	-18972685,
-	159516988,
-	227377070,
-	176459833,
-	52286391,
-	-75069813,
-	-146040686,
-	-136596608,
-	-63649429,
-	28865933,
-	94287981,
-	105387292,
-	64441812,
-	-1869994,
-	-58391628,
-	-79332610,
-	-59340577,
-	-13396771,
-	33002698,
-	57454240,
-	51031478,
-	20852646,
-	-15423865,
-	-39495305,
-	-41351788,
-	-23040899,
-	3906920,
-	25322197,
-	31621308,
-	21839933,
-	2929243,
-	-14707744,
-	-22749192,
-	-18703974,
-	-6289546,
-	7273357,
-	15284374,
-	14742036,
-	7241636,
-	-2508637,
-	-9463959,
-	-10748300,
-	-6699458,
-	-172239,
-	5274450,
-	7228846,
-	5396641,
-	1362970,
-	-2524339,
-	-4440548,
-	-3871237,
-	-1603864,
-	919893,
-	2443572,
-	2470042,
-	1337719,
-	-134514,
-	-1161853,
-	-1372220,
-	-887663,
-	-136374,
-	443313,
-	626871,
-	456506,
-	139531,
-	-111995,
-	-103546,
-	154505,
-	469852,
-	627374,
-	424004,
-	-171138,
-	-920681,
-	-1380559,
-	-1130541,
-	-69486,
-	1406495,
-	2500392,
-	2404543,
-	814829,
-	-1729600,
-	-3946966,
-	-4407252,
-	-2373893,
-	1570128,
-	5551473,
-	7227844,
-	5082775,
-	-484782,
-	-6977069,
-	-10822784,
-	-9250774,
-	-2073050,
-	7693107,
-	14954176,
-	15091487,
-	6711101,
-	-6968313,
-	-19135427,
-	-22646824,
-	-14038573,
-	3883412,
-	22590076,
-	31713708,
-	24599838,
-	2644754,
-	-24222757,
-	-41782119,
-	-38819306,
-	-13849170,
-	22587062,
-	51986991,
-	56984221,
-	31154332,
-	-15806071,
-	-61061300,
-	-79308995,
-	-56372377,
-	1333335,
-	67240873,
-	106170328,
-	92299065,
-	24752327,
-	-67966308,
-	-138758887,
-	-144460870,
-	-69923457,
-	58838333,
-	181057569,
-	227015233,
-	153202093,
-	-29266027,
-	-247962816,
-	-390637323,
-	-348754858,
-	-66036258,
-	429084752,
-	1022873952,
-	1550575079,
-	1853655929,
-	1837735398,
-	1507820813,
-	966427447,
-	375353249,
-	-103253287,
-	-362808432,
-	-383543211,
-	-228513744,
-	-8780418,
-	165568643,
-	227458886,
-	171691201,
-	45729492,
-	-80081074,
-	-147429913,
-	-134284961,
-	-59287729,
-	32914106,
-	96147739,
-	104481349,
-	61583586,
-	-5049167,
-	-60326037,
-	-79259309,
-	-57558925,
-	-10987112,
-	34798540,
-	57851005,
-	50019991,
-	19104312,
-	-16969176,
-	-40118483,
-	-40873822,
-	-21838950,
-	5155586,
-	26008524,
-	31490850,
-	21068410,
-	1978405,
-	-15353964,
-	-22822899,
-	-18252848,
-	-5608297,
-	7822263,
-	15456933,
-	14513497,
-	6785007,
-	-2937437,
-	-9663630,
-	-10661218,
-	-6416095,
-	137612,
-	5457774,
-	7220884,
-	5236669,
-	1156256,
-	-2670045,
-	-4467946,
-	-3791529,
-	-1477589,
-	1022532,
-	2479036,
-	2436970,
-	1268183,
-	-198447,
-	-1191211,
-	-1362245,
-	-854040,
-	-102044,
-	461668,
-	625533,
-	442829,
-	124729,
-	-120040,
-	-94696,
-	169632,
-	482839,
-	627025,
-	403753,
-	-206296,
-	-953039,
-	-1387225,
-	-1097289,
-	-3434,
-	1474410,
-	2527944,
-	2361956,
-	707446,
-	-1854630,
-	-4018574,
-	-4368035,
-	-2218850,
-	1777473,
-	5700918,
-	7217792,
-	4882911,
-	-799648,
-	-7248526,
-	-10884465,
-	-9024226,
-	-1631162,
-	8138816,
-	15149518,
-	14878350,
-	6136090,
-	-7643735,
-	-19546521,
-	-22515705,
-	-13347111,
-	4839754,
-	23317757,
-	31767666,
-	23842087,
-	1370554,
-	-25382927,
-	-42163961,
-	-38090963,
-	-12246834,
-	24305330,
-	52884983,
-	56441037,
-	29255361,
-	-18212054,
-	-62718575,
-	-79187841,
-	-54270181,
-	4557066,
-	69976935,
-	106828630,
-	90182481,
-	20577812,
-	-72232776,
-	-140767994,
-	-142690815,
-	-64647060,
-	65377390,
-	185477262,
-	226370924,
-	146628492,
-	-39649631,
-	-257434588,
-	-393546346,
-	-340884782,
-	-46675789,
-	456309595,
-	1050880279,
-	1571176750,
-	1860504348,
-	1828675015,
-	1485698989,
-	938025643,
-	348878782,
-	-121094475,
-	-368996886,
-	-379378914,
-	-218563045,
-	1300194,
-	171352863,
-	227263424,
-	166758956,
-	39175504,
-	-84952386,
-	-148628430,
-	-131827896,
-	-54886810,
-	36892431,
-	97877014,
-	103454461,
-	58670072,
-	-8200487,
-	-62173823,
-	-79089829,
-	-55718919,
-	-8580036,
-	36540012,
-	58174514,
-	48954137,
-	17344289,
-	-18483410,
-	-40688432,
-	-40349131,
-	-20618522,
-	6389314,
-	26658227,
-	31322762,
-	20276609,
-	1032043,
-	-15976606,
-	-22868066,
-	-17782754,
-	-4925426,
-	8357246,
-	15609115,
-	14268974,
-	6323830,
-	-3358975,
-	-9849657,
-	-10561757,
-	-6127383,
-	444411,
-	5632596,
-	7204053,
-	5071808,
-	950242,
-	-2810880,
-	-4489473,
-	-3707989,
-	-1350942,
-	1122645,
-	2510935,
-	2401253,
-	1197987,
-	-261217,
-	-1218607,
-	-1350672,
-	-819868,
-	-68188,
-	479063,
-	623378,
-	428846,
-	110117,
-	-127677,
-	-85448,
-	184892,
-	495440,
-	625807,
-	382569,
-	-241807,
-	-984684,
-	-1392184,
-	-1062113,
-	63570,
-	1541363,
-	2552627,
-	2315822,
-	597855,
-	-1978784,
-	-4085924,
-	-4322882,
-	-2059357,
-	1984744,
-	5844733,
-	7198612,
-	4675030,
-	-1116462,
-	-7513433,
-	-10933152,
-	-8784481,
-	-1183473,
-	8578156,
-	15327681,
-	14645067,
-	5548938,
-	-8314948,
-	-19936591,
-	-22355784,
-	-12634051,
-	5797102,
-	24021914,
-	31782842,
-	23049632,
-	85811,
-	-26519831,
-	-42496512,
-	-37310818,
-	-10618645,
-	26005229,
-	53723965,
-	55824868,
-	27307780,
-	-20611744,
-	-64309944,
-	-78968638,
-	-52087049,
-	7797395,
-	72646217,
-	107360509,
-	87939886,
-	16347017,
-	-76443262,
-	-142620283,
-	-140731099,
-	-59245875,
-	71895577,
-	189711902,
-	225441996,
-	139801064,
-	-50112458,
-	-266720130,
-	-396016617,
-	-332449982,
-	-26825053,
-	483751890,
-	1078716445,
-	1591241508,
-	1866604620,
-	1818889935,
-	1463101766,
-	909530396,
-	322686129,
-	-138414660,
-	-374630515,
-	-374817425,
-	-208479294,
-	11258817,
-	176865800,
-	226793717,
-	161670499,
-	32632218,
-	-89679101,
-	-149636343,
-	-129229505,
-	-50452279,
-	40796614,
-	99474647,
-	102308723,
-	55705190,
-	-11320314,
-	-63933323,
-	-78825021,
-	-53823189,
-	-6178460,
-	38225349,
-	58424858,
-	47835580,
-	15574807,
-	-19964922,
-	-41204812,
-	-39778673,
-	-19381236,
-	7606694,
-	27270765,
-	31117517,
-	19465647,
-	91290,
-	-16575077,
-	-22884852,
-	-17294414,
-	-4241788,
-	8877754,
-	15740892,
-	14008901,
-	5858714,
-	-3772790,
-	-10021928,
-	-10450151,
-	-5833730,
-	747803,
-	5798779,
-	7178463,
-	4902315,
-	745179,
-	-2946717,
-	-4505169,
-	-3620763,
-	-1224088,
-	1220134,
-	2539271,
-	2362972,
-	1127230,
-	-322758,
-	-1244032,
-	-1337541,
-	-785201,
-	-34843,
-	495490,
-	620425,
-	414585,
-	95714,
-	-134905,
-	-75808,
-	200265,
-	507628,
-	623704,
-	360465,
-	-277626,
-	-1015559,
-	-1395401,
-	-1025029,
-	131452,
-	1607255,
-	2574371,
-	2266155,
-	486170,
-	-2101894,
-	-4148881,
-	-4271785,
-	-1895570,
-	2191676,
-	5982678,
-	7170240,
-	4459319,
-	-1434846,
-	-7771397,
-	-10968667,
-	-8531725,
-	-730491,
-	9010527,
-	15488303,
-	14391765,
-	4950280,
-	-8981083,
-	-20304992,
-	-22167044,
-	-11900117,
-	6754275,
-	24701508,
-	31758943,
-	22223209,
-	-1207963,
-	-27631903,
-	-42779028,
-	-36479483,
-	-8966435,
-	27684542,
-	54502511,
-	55135987,
-	25313659,
-	-23002153,
-	-65833015,
-	-78650994,
-	-49825104,
-	11050474,
-	75244989,
-	107764420,
-	85573100,
-	12064675,
-	-80592219,
-	-144312264,
-	-138582533,
-	-53725345,
-	78384864,
-	193754630,
-	224226607,
-	132725024,
-	-60643254,
-	-275806185,
-	-398038453,
-	-323449144,
-	-6492911,
-	511394836,
-	1106363351,
-	1610754851,
-	1871952246,
-	1808387357,
-	1440045334,
-	880960885,
-	296790608,
-	-155207354,
-	-379712929,
-	-369869782,
-	-198275757,
-	21085363,
-	182103950,
-	226053083,
-	156433346,
-	26107348,
-	-94256779,
-	-150453982,
-	-126494020,
-	-45989741,
-	44622477,
-	100939645,
-	101046357,
-	52692893,
-	-14405070,
-	-65602993,
-	-78465843,
-	-51874415,
-	-3785277,
-	39852867,
-	58602215,
-	46666035,
-	13798092,
-	-21412117,
-	-41667351,
-	-39163457,
-	-18128725,
-	8806345,
-	27845643,
-	30875628,
-	18636658,
-	-842739,
-	-17148818,
-	-22873446,
-	-16788571,
-	-3558233,
-	9383258,
-	15852265,
-	13733725,
-	5390266,
-	-4178435,
-	-10180346,
-	-10326646,
-	-5535547,
-	1047442,
-	5956198,
-	7144230,
-	4728448,
-	541315,
-	-3077438,
-	-4515075,
-	-3530005,
-	-1097190,
-	1314907,
-	2564054,
-	2322208,
-	1056012,
-	-383009,
-	-1267483,
-	-1322893,
-	-750093,
-	-2045,
-	510946,
-	616694,
-	400073,
-	81537,
-	-141722,
-	-65782,
-	215729,
-	519377,
-	620703,
-	337456,
-	-313711,
-	-1045612,
-	-1396846,
-	-986061,
-	200134,
-	1671985,
-	2593110,
-	2212975,
-	372511,
-	-2223788,
-	-4207315,
-	-4214746,
-	-1727652,
-	2398005,
-	6114521,
-	7132623,
-	4235974,
-	-1754412,
-	-8022031,
-	-10990851,
-	-8266163,
-	-272740,
-	9435331,
-	15631040,
-	14118601,
-	4340772,
-	-9641274,
-	-20651102,
-	-21949502,
-	-11146066,
-	7710087,
-	25355520,
-	31695722,
-	21363603,
-	-2509233,
-	-28717602,
-	-43010818,
-	-35597637,
-	-7292076,
-	29341067,
-	55219262,
-	54374756,
-	23275137,
-	-25380287,
-	-67285461,
-	-78234634,
-	-47486579,
-	14312411,
-	77769583,
-	108038959,
-	83084108,
-	7735617,
-	-84674134,
-	-145840613,
-	-136246159,
-	-48091102,
-	84837182,
-	197598748,
-	222723227,
-	125405926,
-	-71230556,
-	-284679533,
-	-399602479,
-	-313881429,
-	14311316,
-	539221377,
-	1133801958,
-	1629702653,
-	1876543281,
-	1797175004,
-	1416546174,
-	852336251,
-	271207207,
-	-171466554,
-	-384248181,
-	-364547261,
-	-187965661,
-	30770009,
-	187064156,
-	225045118,
-	151055117,
-	19608519,
-	-98681193,
-	-151081901,
-	-123625800,
-	-41504793,
-	48365967,
-	102271184,
-	99669713,
-	49637165,
-	-17451248,
-	-67181404,
-	-78013364,
-	-49875325,
-	-1403348,
-	41420960,
-	58706851,
-	45447269,
-	12016366,
-	-22823454,
-	-42075845,
-	-38504540,
-	-16862627,
-	9986919,
-	28382420,
-	30597652,
-	17790790,
-	-1768944,
-	-17697304,
-	-22834073,
-	-16265978,
-	-2875603,
-	9873252,
-	15943261,
-	13443909,
-	4919096,
-	-4575476,
-	-10324835,
-	-10191500,
-	-5233246,
-	1342989,
-	6104740,
-	7101481,
-	4550469,
-	338894,
-	-3202933,
-	-4519243,
-	-3435869,
-	-970410,
-	1406875,
-	2585296,
-	2279046,
-	984430,
-	-441908,
-	-1288957,
-	-1306771,
-	-714599,
-	30170,
-	525425,
-	612205,
-	385335,
-	67601,
-	-148128,
-	-55376,
-	231263,
-	530660,
-	616791,
-	313557,
-	-350017,
-	-1074788,
-	-1396490,
-	-945232,
-	269537,
-	1735452,
-	2608781,
-	2156309,
-	256999,
-	-2344298,
-	-4261101,
-	-4151771,
-	-1555772,
-	2603462,
-	6240034,
-	7085717,
-	4005205,
-	-2074770,
-	-8264955,
-	-10999556,
-	-7988014,
-	189250,
-	9851974,
-	15755568,
-	13825756,
-	3721086,
-	-10294654,
-	-20974323,
-	-21703214,
-	-10372685,
-	8663344,
-	25982958,
-	31592979,
-	20471644,
-	-3816442,
-	-29775407,
-	-43191253,
-	-34666025,
-	-5597481,
-	30972611,
-	55872924,
-	53541628,
-	21194421,
-	-27743144,
-	-68665028,
-	-77719403,
-	-45073817,
-	17579276,
-	80216398,
-	108182872,
-	80475057,
-	3364764,
-	-88683530,
-	-147202177,
-	-133723252,
-	-42348960,
-	91244435,
-	201237722,
-	220930639,
-	117849660,
-	-81862706,
-	-293327010,
-	-400699636,
-	-303746476,
-	35577851,
-	567214212,
-	1161013308,
-	1648071177,
-	1880374334,
-	1785261111,
-	1392621054,
-	823675590,
-	245950569,
-	-187186748,
-	-388240757,
-	-358861358,
-	-177562183,
-	40303193,
-	191743604,
-	223773686,
-	145543522,
-	13143258,
-	-102948331,
-	-151520875,
-	-120629331,
-	-37003017,
-	52023161,
-	103468604,
-	98181260,
-	46542015,
-	-20455405,
-	-68667253,
-	-77468759,
-	-47828689,
-	964494,
-	42928109,
-	58739120,
-	44181098,
-	10231840,
-	-24197446,
-	-42430158,
-	-37803026,
-	-15584589,
-	11147097,
-	28880703,
-	30284184,
-	16929202,
-	-2686241,
-	-18220046,
-	-22766991,
-	-15727409,
-	-2194733,
-	10347251,
-	16013928,
-	13139933,
-	4445809,
-	-4963493,
-	-10455337,
-	-10044984,
-	-4927240,
-	1634114,
-	6244302,
-	7050353,
-	4368641,
-	138155,
-	-3323098,
-	-4517730,
-	-3338512,
-	-843907,
-	1495955,
-	2603013,
-	2233574,
-	912583,
-	-499398,
-	-1308457,
-	-1289220,
-	-678772,
-	61768,
-	538927,
-	606980,
-	370400,
-	53922,
-	-154123,
-	-44597,
-	246845,
-	541450,
-	611954,
-	288786,
-	-386496,
-	-1103032,
-	-1394305,
-	-902568,
-	339579,
-	1797556,
-	2621323,
-	2096185,
-	139761,
-	-2463251,
-	-4310117,
-	-4082878,
-	-1380108,
-	2807778,
-	6358995,
-	7029492,
-	3767231,
-	-2395525,
-	-8499794,
-	-10994654,
-	-7697519,
-	654937,
-	10259869,
-	15861584,
-	13513437,
-	3091913,
-	-10940359,
-	-21274078,
-	-21428270,
-	-9580789,
-	9612848,
-	26582856,
-	31450561,
-	19548206,
-	-5128019,
-	-30803822,
-	-43319760,
-	-33685460,
-	-3884603,
-	32577001,
-	56462273,
-	52637149,
-	19073785,
-	-30087724,
-	-69969537,
-	-77105264,
-	-42589264,
-	20847109,
-	82581899,
-	108195053,
-	77748253,
-	-1042875,
-	-92614979,
-	-148393977,
-	-131015317,
-	-36504910,
-	97598507,
-	204665199,
-	218847948,
-	110062444,
-	-92527857,
-	-301735517,
-	-401321193,
-	-293044405,
-	57296468,
-	595355810,
-	1187978540,
-	1665847086,
-	1883442578,
-	1772654426,
-	1368287005,
-	794997929,
-	221034983,
-	-202362910,
-	-391695573,
-	-352823780,
-	-167078441,
-	49675632,
-	196139828,
-	222242918,
-	139906360,
-	6718989,
-	-107054400,
-	-151771894,
-	-117509216,
-	-32489974,
-	55590267,
-	104531413,
-	96583585,
-	43411473,
-	-23414178,
-	-70059355,
-	-76833304,
-	-45737316,
-	3315458,
-	44372877,
-	58699460,
-	42869384,
-	8446715,
-	-25532661,
-	-42730219,
-	-37060062,
-	-14296258,
-	12285599,
-	29340149,
-	29935860,
-	16053068,
-	-3593567,
-	-18716589,
-	-22672490,
-	-15173649,
-	-1516449,
-	10804797,
-	16064343,
-	12822287,
-	3971009,
-	-5342082,
-	-10571811,
-	-9887382,
-	-4617944,
-	1920494,
-	6374798,
-	6990992,
-	4183232,
-	-60668,
-	-3437840,
-	-4510600,
-	-3238094,
-	-717840,
-	1582068,
-	2617227,
-	2185878,
-	840566,
-	-555424,
-	-1325984,
-	-1270284,
-	-642666,
-	92717,
-	551450,
-	601041,
-	355291,
-	40517,
-	-159708,
-	-33454,
-	262452,
-	551722,
-	606182,
-	263160,
-	-423103,
-	-1130293,
-	-1390267,
-	-858100,
-	410177,
-	1858198,
-	2630681,
-	2032639,
-	20928,
-	-2580478,
-	-4354248,
-	-4008088,
-	-1200841,
-	3010682,
-	6471188,
-	6963927,
-	3522285,
-	-2716276,
-	-8726180,
-	-10976029,
-	-7394934,
-	1123771,
-	10658434,
-	15948805,
-	13181878,
-	2453962,
-	-11577527,
-	-21549818,
-	-21124798,
-	-8771224,
-	10557395,
-	27154273,
-	31268364,
-	18594212,
-	-6442373,
-	-31801375,
-	-43395828,
-	-32656819,
-	-2155427,
-	34152079,
-	56986155,
-	51661956,
-	16915569,
-	-32411027,
-	-71196884,
-	-76392303,
-	-40035474,
-	24111919,
-	84862627,
-	108074549,
-	74906162,
-	-5482211,
-	-96463103,
-	-149413214,
-	-128124096,
-	-30565116,
-	103891271,
-	207875010,
-	216474583,
-	102050826,
-	-103213987,
-	-309892037,
-	-401458759,
-	-281775819,
-	79456499,
-	623628423,
-	1214678903,
-	1683017458,
-	1885745746,
-	1759364194,
-	1343561312,
-	766322217,
-	196474373,
-	-216990506,
-	-394617965,
-	-346446433,
-	-156527474,
-	58878321,
-	200250705,
-	220457201,
-	134151501,
-	343024,
-	-110995829,
-	-151836167,
-	-114270173,
-	-27971197,
-	59063627,
-	105459282,
-	94879391,
-	40249583,
-	-26324277,
-	-71356645,
-	-76108381,
-	-43604053,
-	5646786,
-	45753913,
-	58588395,
-	41514032,
-	6663178,
-	-26827725,
-	-42976028,
-	-36276842,
-	-12999285,
-	13401177,
-	29760464,
-	29553356,
-	15163567,
-	-4489878,
-	-19186517,
-	-22550891,
-	-14605495,
-	-841570,
-	11245454,
-	16094605,
-	12491476,
-	3495296,
-	-5710854,
-	-10674235,
-	-9718988,
-	-4305773,
-	2201817,
-	6496149,
-	6923552,
-	3994510,
-	-257344,
-	-3547071,
-	-4497923,
-	-3134776,
-	-592363,
-	1665140,
-	2627964,
-	2136051,
-	768476,
-	-609934,
-	-1341546,
-	-1250011,
-	-606334,
-	122987,
-	562996,
-	594411,
-	340037,
-	27398,
-	-164884,
-	-21955,
-	278062,
-	561450,
-	599466,
-	236701,
-	-459790,
-	-1156517,
-	-1384352,
-	-811859,
-	481247,
-	1917279,
-	2636800,
-	1965711,
-	-99366,
-	-2695808,
-	-4393383,
-	-3927433,
-	-1018163,
-	3211903,
-	6576403,
-	6889015,
-	3270608,
-	-3036621,
-	-8943753,
-	-10943585,
-	-7080533,
-	1595192,
-	11047094,
-	16016970,
-	12831338,
-	1807957,
-	-12205300,
-	-21801019,
-	-20792961,
-	-7944864,
-	11495779,
-	27696300,
-	31046333,
-	17610627,
-	-7757902,
-	-32766626,
-	-43419007,
-	-31581045,
-	-411974,
-	35695713,
-	57443489,
-	50616776,
-	14722172,
-	-34710059,
-	-72345046,
-	-75580725,
-	-37415101,
-	27369692,
-	87055201,
-	107820560,
-	71951409,
-	-9948078,
-	-100222584,
-	-150257274,
-	-125051560,
-	-24535907,
-	110114600,
-	210861178,
-	213810297,
-	93821678,
-	-113908907,
-	-317783643,
-	-401104289,
-	-269941809,
-	102046838,
-	652014101,
-	1241095777,
-	1699569792,
-	1887282138,
-	1745400155,
-	1318461497,
-	737667305,
-	172282288,
-	-231065496,
-	-397013681,
-	-339741405,
-	-145922238,
-	67902542,
-	204074456,
-	218421172,
-	128286881,
-	-5977446,
-	-114769268,
-	-151715112,
-	-110917021,
-	-23452184,
-	62439724,
-	106252049,
-	93071488,
-	37060400,
-	-29182498,
-	-72558185,
-	-75295470,
-	-41431778,
-	7955765,
-	47069953,
-	58406535,
-	40116987,
-	4883400,
-	-28081321,
-	-43167648,
-	-35454596,
-	-11695318,
-	14492621,
-	30141408,
-	29137382,
-	14261890,
-	-5374152,
-	-19629446,
-	-22402546,
-	-14023757,
-	-170901,
-	11668811,
-	16104839,
-	12148018,
-	3019269,
-	-6069434,
-	-10762602,
-	-9540108,
-	-3991142,
-	2477779,
-	6608293,
-	6848197,
-	3802745,
-	-451648,
-	-3650713,
-	-4479778,
-	-3028723,
-	-467629,
-	1745102,
-	2635254,
-	2084183,
-	696407,
-	-662878,
-	-1355152,
-	-1228449,
-	-569829,
-	152547,
-	573566,
-	587113,
-	324661,
-	14579,
-	-169654,
-	-10109,
-	293649,
-	570608,
-	591796,
-	209430,
-	-496506,
-	-1181651,
-	-1376540,
-	-763883,
-	552701,
-	1974702,
-	2639632,
-	1895445,
-	-220985,
-	-2809071,
-	-4427416,
-	-3840953,
-	-832269,
-	3411169,
-	6674439,
-	6804759,
-	3012454,
-	-3356154,
-	-9152160,
-	-10897239,
-	-6754607,
-	2068633,
-	11425282,
-	16065838,
-	12462102,
-	1154639,
-	-12822825,
-	-22027183,
-	-20432959,
-	-7102610,
-	12426793,
-	28208054,
-	30784459,
-	16598459,
-	-9072988,
-	-33698160,
-	-43388909,
-	-30459146,
-	1343706,
-	37205792,
-	57833271,
-	49502428,
-	12496053,
-	-36981839,
-	-73412085,
-	-74670859,
-	-34730899,
-	30616396,
-	89156327,
-	107432444,
-	68886771,
-	-14435239,
-	-103888170,
-	-150923731,
-	-121799914,
-	-18423772,
-	116260374,
-	213617932,
-	210855178,
-	85382191,
-	-124600270,
-	-325397517,
-	-400250100,
-	-257543957,
-	125055954,
-	680494707,
-	1267210683,
-	1715492023,
-	1888050617,
-	1730772532,
-	1293005303,
-	709051931,
-	148471892,
-	-244584332,
-	-398888877,
-	-332720960,
-	-135275589,
-	76739873,
-	207609646,
-	216139710,
-	122320493,
-	-12235355,
-	-118371595,
-	-151410356,
-	-107454682,
-	-18938394,
-	65715182,
-	106909715,
-	91162794,
-	33847984,
-	-31985716,
-	-73663155,
-	-74396147,
-	-39223396,
-	10239727,
-	48319821,
-	58154570,
-	38680234,
-	3109533,
-	-29292194,
-	-43305209,
-	-34594599,
-	-10386005,
-	15558759,
-	30482787,
-	28688687,
-	13349231,
-	-6245388,
-	-20045030,
-	-22227839,
-	-13429257,
-	494763,
-	12074481,
-	16095193,
-	11792440,
-	2543519,
-	-6417466,
-	-10836927,
-	-9351056,
-	-3674464,
-	2748086,
-	6711176,
-	6765100,
-	3608207,
-	-643361,
-	-3748695,
-	-4456245,
-	-2920099,
-	-343787,
-	1821890,
-	2639131,
-	2030368,
-	624451,
-	-714209,
-	-1366812,
-	-1205646,
-	-533203,
-	181370,
-	583165,
-	579170,
-	309190,
-	2072,
-	-174020
+	1846064414
 
 };
 
 struct src_stage src_int32_21_80_3968_5000 = {
 	19, 5, 21, 148, 3108, 80, 21, 0, 2,
-	src_int32_21_80_3968_5000_fir};
+	src_int32_21_80_3968_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_2_3_4535_5000_fir[272] = {
+const int32_t src_int32_2_3_4535_5000_fir[136] = {
 	12509,
 	72682,
 	-101869,
@@ -143,146 +143,10 @@ const int32_t src_int32_2_3_4535_5000_fir[272] = {
 	132607,
 	-120702,
 	-4244,
-	70735,
-	70735,
-	-4244,
-	-120702,
-	132607,
-	56816,
-	-260361,
-	173025,
-	208930,
-	-448521,
-	139046,
-	483954,
-	-646785,
-	-38753,
-	891991,
-	-780271,
-	-433305,
-	1403443,
-	-738424,
-	-1100011,
-	1933479,
-	-386635,
-	-2050083,
-	2334127,
-	410043,
-	-3222926,
-	2398900,
-	1752448,
-	-4463894,
-	1883231,
-	3666426,
-	-5514076,
-	541139,
-	6062230,
-	-6017518,
-	-1824981,
-	8702095,
-	-5548334,
-	-5307918,
-	11183063,
-	-3655758,
-	-9841278,
-	12938746,
-	79990,
-	-15155986,
-	13257315,
-	5993711,
-	-20753072,
-	11302322,
-	14302105,
-	-25889530,
-	6103395,
-	25120800,
-	-29554449,
-	-3561933,
-	38589212,
-	-30360472,
-	-19617737,
-	55267881,
-	-26089299,
-	-46298250,
-	77494206,
-	-11663647,
-	-97461622,
-	116254553,
-	34641155,
-	-262536181,
-	295779779,
-	1163363281,
-	809519577,
-	-116662167,
-	-159346832,
-	148926012,
-	-4040632,
-	-93159250,
-	66976180,
-	20731500,
-	-65379735,
-	31167738,
-	29061753,
-	-46452494,
-	10615562,
-	30423816,
-	-31506635,
-	-1923372,
-	27981320,
-	-19392145,
-	-9176106,
-	23435231,
-	-9839704,
-	-12620967,
-	17959816,
-	-2748154,
-	-13327185,
-	12426558,
-	2041743,
-	-12192929,
-	7454958,
-	4807613,
-	-9994160,
-	3426684,
-	5932721,
-	-7372894,
-	504991,
-	5859570,
-	-4815201,
-	-1329621,
-	5033026,
-	-2640451,
-	-2229493,
-	3848623,
-	-1009160,
-	-2423245,
-	2615925,
-	51471,
-	-2161669,
-	1541427,
-	610057,
-	-1673889,
-	730569,
-	789333,
-	-1138655,
-	204767,
-	727777,
-	-672059,
-	-72811,
-	550177,
-	-329727,
-	-169398,
-	349975,
-	-119196,
-	-158327,
-	183342,
-	-17280,
-	-101869,
-	72682,
-	12509
+	70735
 
 };
 
 struct src_stage src_int32_2_3_4535_5000 = {
 	1, 1, 2, 136, 272, 3, 2, 0, 0,
-	src_int32_2_3_4535_5000_fir};
+	src_int32_2_3_4535_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_32_21_4535_5000_fir[2816] = {
+const int32_t src_int32_32_21_4535_5000_fir[1408] = {
 	-70924,
 	93303,
 	-103450,
@@ -1415,1418 +1415,10 @@ const int32_t src_int32_32_21_4535_5000_fir[2816] = {
 	411632,
 	-285507,
 	184076,
-	-107506,
-	-107506,
-	184076,
-	-285507,
-	411632,
-	-559613,
-	723343,
-	-892964,
-	1054547,
-	-1189996,
-	1277234,
-	-1290696,
-	1202171,
-	-981980,
-	600509,
-	-30025,
-	-753249,
-	1766898,
-	-3020007,
-	4510881,
-	-6224917,
-	8132748,
-	-10188742,
-	12329976,
-	-14475722,
-	16527476,
-	-18369512,
-	19869861,
-	-20881551,
-	21243843,
-	-20783032,
-	19312205,
-	-16628988,
-	12509762,
-	-6697812,
-	-1119117,
-	11350419,
-	-24580910,
-	41724652,
-	-64349700,
-	95438996,
-	-141461502,
-	219442228,
-	-392599939,
-	1247388055,
-	1180433453,
-	-393227474,
-	225275523,
-	-148485863,
-	102689978,
-	-71447029,
-	48470772,
-	-30856759,
-	17080332,
-	-6256647,
-	-2176644,
-	8610371,
-	-13340996,
-	16611814,
-	-18635273,
-	19604817,
-	-19700665,
-	19092031,
-	-17937289,
-	16383023,
-	-14562599,
-	12594688,
-	-10582003,
-	8610456,
-	-6748818,
-	5048930,
-	-3546458,
-	2262129,
-	-1203383,
-	366325,
-	262122,
-	-701982,
-	978021,
-	-1117671,
-	1149156,
-	-1099900,
-	995244,
-	-857504,
-	705358,
-	-553559,
-	412920,
-	-290548,
-	190249,
-	-113070,
-	-100790,
-	176089,
-	-277805,
-	406661,
-	-560817,
-	735227,
-	-921079,
-	1105390,
-	-1270807,
-	1395678,
-	-1454429,
-	1418289,
-	-1256371,
-	937111,
-	-430025,
-	-292239,
-	1251659,
-	-2462463,
-	3928751,
-	-5642213,
-	7580066,
-	-9703324,
-	11955490,
-	-14261747,
-	16528686,
-	-18644556,
-	20479952,
-	-21888819,
-	22709469,
-	-22765250,
-	21864223,
-	-19796902,
-	16330531,
-	-11197339,
-	4072190,
-	5469019,
-	-18028030,
-	34539475,
-	-56600065,
-	87243603,
-	-133063488,
-	211524605,
-	-388457842,
-	1311991279,
-	1111460664,
-	-390480139,
-	229028657,
-	-154102382,
-	108948483,
-	-77839218,
-	54724534,
-	-36804168,
-	22610645,
-	-11296451,
-	2326883,
-	4666716,
-	-9962304,
-	13787541,
-	-16341796,
-	17807859,
-	-18357660,
-	18154435,
-	-17352796,
-	16097650,
-	-14522590,
-	12748177,
-	-10880425,
-	9009654,
-	-7209858,
-	5538608,
-	-4037520,
-	2733236,
-	-1638838,
-	755619,
-	-75092,
-	-418868,
-	747877,
-	-936963,
-	1012676,
-	-1001423,
-	928115,
-	-815114,
-	681524,
-	-542789,
-	410582,
-	-292941,
-	194599,
-	-117465,
-	-92952,
-	166318,
-	-267456,
-	397979,
-	-557073,
-	740804,
-	-941489,
-	1147208,
-	-1341501,
-	1503327,
-	-1607318,
-	1624386,
-	-1522687,
-	1268957,
-	-830205,
-	175708,
-	720742,
-	-1878431,
-	3307256,
-	-5005310,
-	6956634,
-	-9129260,
-	11473645,
-	-13921570,
-	16385564,
-	-18758847,
-	20915740,
-	-22712398,
-	23987626,
-	-24563404,
-	24244489,
-	-22816185,
-	20038737,
-	-15635811,
-	9272478,
-	-514000,
-	-11252443,
-	26972928,
-	-48257245,
-	78160675,
-	-123338257,
-	201535371,
-	-380680247,
-	1373919501,
-	1040810428,
-	-384515147,
-	230722281,
-	-158289186,
-	114175530,
-	-83480095,
-	60437434,
-	-42375053,
-	27895400,
-	-16195790,
-	6773956,
-	713274,
-	-6522849,
-	10864764,
-	-13923538,
-	15869693,
-	-16865361,
-	17066372,
-	-16622226,
-	15674888,
-	-14357006,
-	12789975,
-	-11082169,
-	9327516,
-	-7604561,
-	5976078,
-	-4489245,
-	3176350,
-	-2055971,
-	1134545,
-	-408218,
-	-135132,
-	513804,
-	-750235,
-	869084,
-	-895533,
-	853851,
-	-766266,
-	652141,
-	-527480,
-	404708,
-	-292720,
-	197131,
-	-120685,
-	-84029,
-	154806,
-	-254495,
-	385594,
-	-548332,
-	739927,
-	-953901,
-	1179506,
-	-1401321,
-	1599099,
-	-1747893,
-	1818541,
-	-1778502,
-	1593087,
-	-1227057,
-	646559,
-	178652,
-	-1272788,
-	2651496,
-	-4319327,
-	6267326,
-	-8470862,
-	10887817,
-	-13457198,
-	16098270,
-	-18710192,
-	21172133,
-	-23343747,
-	25065780,
-	-26160440,
-	26430948,
-	-25659361,
-	23601149,
-	-19974027,
-	14436491,
-	-6547433,
-	-4310942,
-	19086634,
-	-39386225,
-	68255538,
-	-112344328,
-	189504416,
-	-369166109,
-	1432860636,
-	968828982,
-	-375505889,
-	230392999,
-	-161036681,
-	118341421,
-	-88330459,
-	65566123,
-	-47525034,
-	32891166,
-	-20913502,
-	11126562,
-	-3215665,
-	-3052871,
-	7869531,
-	-11402366,
-	13808143,
-	-15237791,
-	15838375,
-	-15752992,
-	15119431,
-	-14068239,
-	12720585,
-	-11186252,
-	9561942,
-	-7930053,
-	6357992,
-	-4898060,
-	3587880,
-	-2451335,
-	1499916,
-	-734403,
-	146756,
-	277881,
-	-559180,
-	719717,
-	-783246,
-	773199,
-	-711481,
-	617555,
-	-507842,
-	395415,
-	-289943,
-	197866,
-	-122736,
-	-74075,
-	141618,
-	-238985,
-	369547,
-	-534583,
-	732499,
-	-958086,
-	1201867,
-	-1449599,
-	1682004,
-	-1874773,
-	1998913,
-	-2021458,
-	1906578,
-	-1617069,
-	1116215,
-	-369965,
-	-650646,
-	1966916,
-	-3589856,
-	5517634,
-	-7733217,
-	10202316,
-	-12871740,
-	15668232,
-	-18497804,
-	21245568,
-	-23775944,
-	25933050,
-	-27540931,
-	28403070,
-	-28300281,
-	26985552,
-	-24173337,
-	19518898,
-	-12579167,
-	2737675,
-	10945667,
-	-30057365,
-	57601547,
-	-100152033,
-	175478973,
-	-353835284,
-	1488516038,
-	895865979,
-	-363640504,
-	228092742,
-	-162347425,
-	121425856,
-	-92358328,
-	70072726,
-	-52213781,
-	37557393,
-	-25410337,
-	15347809,
-	-7086287,
-	417354,
-	4828320,
-	-8800875,
-	11641975,
-	-13490041,
-	14482117,
-	-14753658,
-	14437090,
-	-13659730,
-	12541471,
-	-11192544,
-	9711577,
-	-8184089,
-	6681513,
-	-5260795,
-	3964542,
-	-2821702,
-	1848692,
-	-1050886,
-	424366,
-	42179,
-	-365508,
-	565944,
-	-665622,
-	686949,
-	-651325,
-	578149,
-	-484124,
-	382851,
-	-284689,
-	196842,
-	-123633,
-	-63151,
-	126832,
-	-221009,
-	349911,
-	-515862,
-	718482,
-	-953886,
-	1213956,
-	-1485759,
-	1751155,
-	-1986682,
-	2163764,
-	-2249286,
-	2206572,
-	-1996754,
-	1580549,
-	-920362,
-	-17305,
-	1259258,
-	-2822914,
-	4713624,
-	-6922143,
-	9422358,
-	-12169386,
-	15098129,
-	-18122319,
-	21134054,
-	-24003750,
-	26580313,
-	-28691228,
-	30142039,
-	-30714360,
-	30161023,
-	-28195987,
-	24474692,
-	-18556625,
-	9833093,
-	2618027,
-	-20345865,
-	46279572,
-	-86843150,
-	159523650,
-	-334629415,
-	1540602332,
-	822272401,
-	-349120374,
-	223888033,
-	-162235894,
-	123417979,
-	-95539124,
-	73925102,
-	-56405321,
-	41856733,
-	-29649284,
-	19402237,
-	-10865543,
-	3857780,
-	1767813,
-	-6142194,
-	9390723,
-	-11638139,
-	13010295,
-	-13633849,
-	13634732,
-	-13135935,
-	12255038,
-	-11101767,
-	9775811,
-	-8365058,
-	6944334,
-	-5574711,
-	4303387,
-	-3164096,
-	2178008,
-	-1355017,
-	695332,
-	-191258,
-	-170935,
-	409158,
-	-543756,
-	595930,
-	-586402,
-	534346,
-	-456604,
-	367189,
-	-277058,
-	194113,
-	-123404,
-	-51331,
-	110544,
-	-200680,
-	326794,
-	-492252,
-	697898,
-	-941214,
-	1215526,
-	-1509326,
-	1805775,
-	-2082462,
-	2311473,
-	-2459825,
-	2490298,
-	-2362683,
-	2035442,
-	-1467736,
-	621789,
-	534518,
-	-2024898,
-	3861885,
-	-6044148,
-	8554025,
-	-11355381,
-	14391891,
-	-17585805,
-	20837202,
-	-24023676,
-	27000302,
-	-29599587,
-	31630935,
-	-32878800,
-	33098220,
-	-32005451,
-	29259578,
-	-24427220,
-	16913988,
-	-5825916,
-	-10331185,
-	34377433,
-	-72510435,
-	141720346,
-	-311512682,
-	1588853147,
-	748398474,
-	-332158544,
-	217859157,
-	-160728166,
-	124316329,
-	-97855795,
-	77097064,
-	-60068303,
-	45755331,
-	-33595867,
-	23256111,
-	-14521430,
-	7238840,
-	-1285338,
-	-3449775,
-	7074515,
-	-9698895,
-	11436515,
-	-12404167,
-	12720214,
-	-12502274,
-	11864604,
-	-10915477,
-	9754781,
-	-8472002,
-	7144695,
-	-5837516,
-	4601818,
-	-3475807,
-	2485195,
-	-1644281,
-	957371,
-	-420425,
-	22838,
-	250760,
-	-418763,
-	501000,
-	-517349,
-	486598,
-	-425588,
-	348626,
-	-267168,
-	189744,
-	-122083,
-	-38700,
-	92865,
-	-178128,
-	300337,
-	-463878,
-	670824,
-	-920058,
-	1206417,
-	-1519927,
-	1845203,
-	-2161082,
-	2440553,
-	-2651043,
-	2755103,
-	-2711513,
-	2476818,
-	-2007265,
-	1261092,
-	-201109,
-	-1202530,
-	2969478,
-	-5106377,
-	7604220,
-	-10435984,
-	13554661,
-	-16891751,
-	20356237,
-	-23834021,
-	27187679,
-	-30256290,
-	32854890,
-	-34772807,
-	35769646,
-	-35566761,
-	33830368,
-	-30138809,
-	23918549,
-	-14313996,
-	-96413,
-	21989254,
-	-57257058,
-	122168027,
-	-284472411,
-	1633020765,
-	674591603,
-	-312978094,
-	210099243,
-	-157861512,
-	124128729,
-	-99298864,
-	79568536,
-	-63176222,
-	49223091,
-	-37218421,
-	26877698,
-	-18023261,
-	10531707,
-	-4304744,
-	-747192,
-	4713896,
-	-7689754,
-	9775168,
-	-11076087,
-	11702308,
-	-11765079,
-	11374362,
-	-10636049,
-	9649363,
-	-8504610,
-	7281395,
-	-6047381,
-	4857616,
-	-3754422,
-	2767804,
-	-1916319,
-	1208302,
-	-643379,
-	214135,
-	92146,
-	-291772,
-	403042,
-	-444829,
-	435385,
-	-391409,
-	327379,
-	-255155,
-	183816,
-	-119715,
-	-25350,
-	73925,
-	-153512,
-	270715,
-	-430911,
-	637398,
-	-890482,
-	1186564,
-	-1517302,
-	1868907,
-	-2221651,
-	2549662,
-	-2821056,
-	2998470,
-	-3040017,
-	2900684,
-	-2534153,
-	1895010,
-	-941279,
-	-362801,
-	2043876,
-	-4116554,
-	6580612,
-	-9418425,
-	12592770,
-	-16045047,
-	19694000,
-	-23434900,
-	27139098,
-	-30653742,
-	33801234,
-	-36377786,
-	38149900,
-	-38846823,
-	38145361,
-	-35640148,
-	30785004,
-	-22772861,
-	10272395,
-	9214764,
-	-41195944,
-	100982376,
-	-253519543,
-	1672877637,
-	601194340,
-	-291810462,
-	200713268,
-	-153683904,
-	122872087,
-	-99866429,
-	81325660,
-	-65707604,
-	52233895,
-	-40488347,
-	30237529,
-	-21341916,
-	13708533,
-	-7264502,
-	1942066,
-	2329648,
-	-5628640,
-	8041299,
-	-9661852,
-	10590616,
-	-10931534,
-	10789342,
-	-10266647,
-	9461158,
-	-8463221,
-	7353795,
-	-6202956,
-	5068952,
-	-3997835,
-	3023625,
-	-2168944,
-	1446064,
-	-858252,
-	401322,
-	-65299,
-	-163915,
-	302951,
-	-369527,
-	381211,
-	-354422,
-	303689,
-	-241172,
-	176420,
-	-116355,
-	-11386,
-	53864,
-	-127010,
-	238132,
-	-393566,
-	597818,
-	-852623,
-	1155995,
-	-1501304,
-	1876486,
-	-2263427,
-	2637620,
-	-2968146,
-	3218046,
-	-3345117,
-	3303160,
-	-3043670,
-	2517945,
-	-1679553,
-	487087,
-	1092904,
-	-3082920,
-	5491572,
-	-8310847,
-	11513684,
-	-15051956,
-	18854940,
-	-22828259,
-	26853247,
-	-30786552,
-	34459626,
-	-37677517,
-	40215922,
-	-41814721,
-	42164723,
-	-40881347,
-	37452156,
-	-31128582,
-	20686918,
-	-3841463,
-	-24449027,
-	78295317,
-	-218688941,
-	1708217799,
-	528542391,
-	-268893736,
-	189816985,
-	-148253442,
-	120572136,
-	-99564080,
-	82360852,
-	-67646139,
-	54765796,
-	-43380325,
-	33308628,
-	-24450085,
-	16742683,
-	-10139416,
-	4594797,
-	-57396,
-	-3533797,
-	6250470,
-	-8174361,
-	9395482,
-	-10009603,
-	10115353,
-	-9811190,
-	9192473,
-	-8348812,
-	7361821,
-	-6303371,
-	5234398,
-	-4204269,
-	3250699,
-	-2400161,
-	1668732,
-	-1063266,
-	582820,
-	-220222,
-	-36316,
-	201629,
-	-292141,
-	324596,
-	-315000,
-	277811,
-	-225385,
-	167661,
-	-112063,
-	3081,
-	32838,
-	-98820,
-	202824,
-	-352101,
-	552336,
-	-806696,
-	1114832,
-	-1471901,
-	1867676,
-	-2285825,
-	2703422,
-	-3090781,
-	3411665,
-	-3623910,
-	3680517,
-	-3531195,
-	3124347,
-	-2409456,
-	1339786,
-	124674,
-	-2014164,
-	4346113,
-	-7122242,
-	10325948,
-	-13920063,
-	17845079,
-	-22017870,
-	26330875,
-	-30651600,
-	34822156,
-	-38658318,
-	41947205,
-	-44442001,
-	45850845,
-	-45814314,
-	43859921,
-	-39307292,
-	31057291,
-	-17070816,
-	-7146413,
-	54254408,
-	-180039550,
-	1738858143,
-	456962686,
-	-244470930,
-	177535795,
-	-141637711,
-	117263093,
-	-98404773,
-	82672797,
-	-68980770,
-	56801169,
-	-45872510,
-	36066731,
-	-27322488,
-	19608959,
-	-12905212,
-	7188285,
-	-2426530,
-	-1423629,
-	4418623,
-	-6627055,
-	8127895,
-	-9007955,
-	9358935,
-	-9274314,
-	8846295,
-	-8162988,
-	7305957,
-	-6348247,
-	5352942,
-	-4372283,
-	3447339,
-	-2608184,
-	1874535,
-	-1256751,
-	757118,
-	-371305,
-	89917,
-	99975,
-	-213377,
-	266075,
-	-273531,
-	250014,
-	-207974,
-	157650,
-	-106908,
-	17930,
-	11016,
-	-69161,
-	165057,
-	-306815,
-	501266,
-	-752990,
-	1063296,
-	-1429180,
-	1842357,
-	-2288423,
-	2746243,
-	-3187625,
-	3577364,
-	-3873695,
-	4029214,
-	-3992259,
-	3708763,
-	-3124527,
-	2187858,
-	-852488,
-	-919352,
-	3153806,
-	-5862377,
-	9039123,
-	-12658224,
-	16671976,
-	-21009311,
-	25574801,
-	-30248079,
-	34883437,
-	-39309182,
-	43325995,
-	-46702943,
-	49168693,
-	-50393188,
-	49949852,
-	-47235819,
-	41292863,
-	-30361506,
-	10574531,
-	29022106,
-	-137654401,
-	1764639549,
-	386771521,
-	-218788249,
-	164003561,
-	-133913070,
-	112987257,
-	-96408626,
-	82266401,
-	-69705743,
-	58326824,
-	-47946692,
-	38490472,
-	-29936079,
-	22283803,
-	-15538741,
-	9700494,
-	-4757354,
-	683464,
-	2561941,
-	-5033792,
-	6799393,
-	-7935886,
-	8527289,
-	-8661323,
-	8426260,
-	-7907960,
-	7187240,
-	-6337687,
-	5423984,
-	-4500785,
-	3612139,
-	-2791443,
-	2061864,
-	-1437155,
-	922785,
-	-517283,
-	213704,
-	-1119,
-	-133944,
-	206190,
-	-230414,
-	220580,
-	-189127,
-	146510,
-	-100962,
-	33035,
-	-11424,
-	-38270,
-	125122,
-	-258047,
-	444971,
-	-691866,
-	1001699,
-	-1373347,
-	1800549,
-	-2270970,
-	2765455,
-	-3257557,
-	3713407,
-	-4092000,
-	4345925,
-	-4422584,
-	4265884,
-	-3818384,
-	3023848,
-	-1830109,
-	192153,
-	1924711,
-	-4541717,
-	7663707,
-	-11276494,
-	15344672,
-	-19809931,
-	24589904,
-	-29577518,
-	34640667,
-	-39621895,
-	44337473,
-	-48574802,
-	52086130,
-	-54574757,
-	55665667,
-	-54842320,
-	51302952,
-	-43599461,
-	28570167,
-	2774915,
-	-91640451,
-	1785427880,
-	318272771,
-	-192093362,
-	149361384,
-	-125163880,
-	107794548,
-	-93602669,
-	81152679,
-	-69820602,
-	59334084,
-	-49588416,
-	40561546,
-	-32270228,
-	24745491,
-	-18018168,
-	12110254,
-	-7029950,
-	2769239,
-	696700,
-	-3408728,
-	5421952,
-	-6803232,
-	7628217,
-	-7978143,
-	7936615,
-	-7586520,
-	7007242,
-	-6272277,
-	5447346,
-	-4589035,
-	3743983,
-	-2948603,
-	2229292,
-	-1603058,
-	1078483,
-	-656948,
-	333998,
-	-100781,
-	-54544,
-	145486,
-	-186057,
-	189801,
-	-169044,
-	134368,
-	-94306,
-	48264,
-	-34291,
-	-6399,
-	83335,
-	-206170,
-	383870,
-	-623757,
-	930448,
-	-1304725,
-	1742421,
-	-2233388,
-	2760629,
-	-3299677,
-	3818300,
-	-4276604,
-	4627577,
-	-4818123,
-	4790592,
-	-4484774,
-	3840342,
-	-2799644,
-	1310764,
-	669283,
-	-3171341,
-	6211049,
-	-9786051,
-	13873622,
-	-18428799,
-	23383096,
-	-28643787,
-	34093676,
-	-39591125,
-	44969899,
-	-50038034,
-	54574222,
-	-58318858,
-	60953755,
-	-62056922,
-	60997624,
-	-56669247,
-	46691640,
-	-24297580,
-	-42128269,
-	1801114808,
-	251756211,
-	-164633686,
-	133756337,
-	-115481679,
-	101741982,
-	-90020536,
-	79348600,
-	-69330147,
-	59818813,
-	-50787087,
-	42264837,
-	-34306880,
-	26974308,
-	-20323156,
-	14397435,
-	-9225046,
-	4815776,
-	-1160866,
-	-1766186,
-	4007885,
-	-5620279,
-	6670040,
-	-7231258,
-	7382176,
-	-7202016,
-	6768054,
-	-6153073,
-	5423265,
-	-4636653,
-	3842053,
-	-3078568,
-	2375579,
-	-1753180,
-	1222976,
-	-789165,
-	449800,
-	-198162,
-	24130,
-	84508,
-	-140870,
-	157974,
-	-147930,
-	121360,
-	-87023,
-	63479,
-	-57388,
-	26186,
-	40036,
-	-151595,
-	318429,
-	-549165,
-	850042,
-	-1223756,
-	1668287,
-	-2175775,
-	2731543,
-	-3313324,
-	3890810,
-	-4425562,
-	4871371,
-	-5175097,
-	5278010,
-	-5117632,
-	4630037,
-	-3752551,
-	2426760,
-	-601710,
-	-1762842,
-	4693260,
-	-8199107,
-	12270611,
-	-16876638,
-	21963277,
-	-27453082,
-	33244945,
-	-39214494,
-	45214744,
-	-51076493,
-	56607519,
-	-61588752,
-	65763665,
-	-68812339,
-	70288473,
-	-69455029,
-	64785996,
-	-51993803,
-	10728440,
-	1811618493,
-	187495932,
-	-136654712,
-	117340189,
-	-104964314,
-	94893100,
-	-85702097,
-	76876882,
-	-68244338,
-	59781420,
-	-51536016,
-	43588532,
-	-36030691,
-	28952699,
-	-22435026,
-	16543118,
-	-11324186,
-	6805620,
-	-2994711,
-	-120540,
-	2569729,
-	-4397671,
-	5661531,
-	-6427655,
-	6768283,
-	-6758311,
-	6472264,
-	-5981591,
-	5352387,
-	-4643613,
-	3905833,
-	-3180489,
-	2499680,
-	-1886396,
-	1355142,
-	-912875,
-	560160,
-	-292446,
-	101403,
-	23792,
-	-95264,
-	125398,
-	-125995,
-	107624,
-	-79199,
-	78540,
-	-80510,
-	59207,
-	-4416,
-	-94760,
-	249162,
-	-468655,
-	761066,
-	-1130996,
-	1578604,
-	-2098408,
-	2678185,
-	-3298080,
-	3929973,
-	-4537223,
-	5074819,
-	-5490030,
-	5723545,
-	-5711135,
-	5385803,
-	-4680361,
-	3530364,
-	-1877279,
-	-328238,
-	3123109,
-	-6528804,
-	10548664,
-	-15165740,
-	20341271,
-	-26013885,
-	32099605,
-	-38492622,
-	45066787,
-	-51677594,
-	58164302,
-	-64351478,
-	70048576,
-	-75044484,
-	79089392,
-	-81841534,
-	82697352,
-	-80101364,
-	66753465,
-	1816884089,
-	125748871,
-	-108398354,
-	100268107,
-	-93715031,
-	87317342,
-	-80693054,
-	73765738,
-	-66578167,
-	59226809,
-	-51832458,
-	44524189,
-	-37429141,
-	30665411,
-	-24336911,
-	18529746,
-	-13309878,
-	8721941,
-	-4789113,
-	1513922,
-	1120136,
-	-3146313,
-	4611830,
-	-5574759,
-	6100749,
-	-6259756,
-	6122930,
-	-5759785,
-	5235760,
-	-4610244,
-	3935110,
-	-3253773,
-	2600759,
-	-2001738,
-	1473976,
-	-1027111,
-	664189,
-	-382855,
-	176622,
-	-36134,
-	-49646,
-	92376,
-	-103450,
-	93303,
-	-70924
+	-107506
 
 };
 
 struct src_stage src_int32_32_21_4535_5000 = {
 	19, 29, 32, 88, 2816, 21, 32, 0, 0,
-	src_int32_32_21_4535_5000_fir};
+	src_int32_32_21_4535_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_3_1_2268_5000_fir[60] = {
+const int32_t src_int32_3_1_2268_5000_fir[30] = {
 	-166536,
 	2306339,
 	-6050784,
@@ -37,40 +37,10 @@ const int32_t src_int32_3_1_2268_5000_fir[60] = {
 	115231627,
 	-111856179,
 	-100474502,
-	1096579163,
-	1096579163,
-	-100474502,
-	-111856179,
-	115231627,
-	-49228991,
-	-2290482,
-	16157737,
-	-9179696,
-	1663348,
-	346619,
-	1421800,
-	-1408097,
-	-6857929,
-	25146783,
-	-34183778,
-	-4081183,
-	109710788,
-	-235734562,
-	234544530,
-	1351061190,
-	677549850,
-	-254983011,
-	26267865,
-	63227591,
-	-56648456,
-	20170183,
-	2678997,
-	-6050784,
-	2306339,
-	-166536
+	1096579163
 
 };
 
 struct src_stage src_int32_3_1_2268_5000 = {
 	0, 1, 3, 20, 60, 1, 3, 0, 0,
-	src_int32_3_1_2268_5000_fir};
+	src_int32_3_1_2268_5000_fir, 1};
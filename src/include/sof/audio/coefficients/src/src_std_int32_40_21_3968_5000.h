@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_40_21_3968_5000_fir[1600] = {
+const int32_t src_int32_40_21_3968_5000_fir[800] = {
 	-168855,
 	272170,
 	-146895,
@@ -807,810 +807,10 @@ const int32_t src_int32_40_21_3968_5000_fir[1600] = {
 	2457706,
 	-1588692,
 	818071,
-	-307462,
-	-307462,
-	818071,
-	-1588692,
-	2457706,
-	-3052657,
-	2791421,
-	-963209,
-	-3101589,
-	9789116,
-	-18930279,
-	29561053,
-	-39777580,
-	46724941,
-	-46702893,
-	35268831,
-	-7001478,
-	-46052212,
-	141035880,
-	-339566127,
-	1219433365,
-	1174306161,
-	-347743943,
-	151958746,
-	-56040784,
-	1057967,
-	29412257,
-	-42953582,
-	44763240,
-	-39166703,
-	29837948,
-	-19677026,
-	10679079,
-	-3918465,
-	-330228,
-	2369263,
-	-2813918,
-	2349852,
-	-1556997,
-	819484,
-	-315596,
-	-297164,
-	812231,
-	-1613045,
-	2555640,
-	-3281097,
-	3207723,
-	-1602535,
-	-2255994,
-	8837086,
-	-18079154,
-	29134339,
-	-40200300,
-	48481910,
-	-50271382,
-	41031647,
-	-15145963,
-	-35664609,
-	129173193,
-	-329411973,
-	1263183059,
-	1127928940,
-	-353977526,
-	161911397,
-	-65589506,
-	8994848,
-	23491506,
-	-39043979,
-	42608976,
-	-38373095,
-	29965683,
-	-20317206,
-	11503528,
-	-4703057,
-	293389,
-	1943459,
-	-2566291,
-	2232858,
-	-1518323,
-	816609,
-	-321612,
-	-284668,
-	801848,
-	-1629722,
-	2642910,
-	-3497853,
-	3615950,
-	-2245101,
-	-1385447,
-	7826796,
-	-17126390,
-	28557880,
-	-40430294,
-	50022832,
-	-53639138,
-	46671183,
-	-23337003,
-	-24921381,
-	116406008,
-	-317255691,
-	1305431055,
-	1080432061,
-	-358305085,
-	170868395,
-	-74660293,
-	16772767,
-	17536074,
-	-34995128,
-	40275101,
-	-37403006,
-	29945642,
-	-20849184,
-	12259395,
-	-5452016,
-	904720,
-	1516194,
-	-2311202,
-	2107534,
-	-1473062,
-	809604,
-	-325566,
-	-269954,
-	786825,
-	-1638420,
-	2718806,
-	-3701568,
-	4013880,
-	-2887731,
-	-493901,
-	6762402,
-	-16075274,
-	27832496,
-	-40463890,
-	51337307,
-	-56786978,
-	52158116,
-	-31535325,
-	-13868359,
-	102774510,
-	-303077981,
-	1346056897,
-	1031948298,
-	-360770719,
-	178809283,
-	-83217923,
-	24356608,
-	11575231,
-	-30828478,
-	37775275,
-	-36263465,
-	29779911,
-	-21271882,
-	12943993,
-	-6162223,
-	1500954,
-	1089618,
-	-2050086,
-	1974711,
-	-1421629,
-	798643,
-	-327524,
-	-253014,
-	767089,
-	-1638874,
-	2782664,
-	-3890925,
-	4399302,
-	-3527195,
-	414522,
-	5648393,
-	-14929627,
-	26959756,
-	-40298338,
-	52415919,
-	-59696545,
-	57463474,
-	-39701039,
-	-2553629,
-	88323674,
-	-286866197,
-	1384944284,
-	982612388,
-	-361424166,
-	185718569,
-	-91230157,
-	31712684,
-	5637885,
-	-26565772,
-	35123789,
-	-34962240,
-	29471264,
-	-21584772,
-	13555025,
-	-6830802,
-	2079406,
-	665841,
-	-1784377,
-	1835241,
-	-1364459,
-	783917,
-	-327563,
-	-233851,
-	742592,
-	-1630852,
-	2833867,
-	-4064656,
-	4770028,
-	-4160223,
-	1335549,
-	4489574,
-	-13693797,
-	25941985,
-	-39931836,
-	53250293,
-	-62350415,
-	62558772,
-	-47793824,
-	8972659,
-	73103165,
-	-268614476,
-	1421981472,
-	932560567,
-	-360320545,
-	191585708,
-	-98667838,
-	38808874,
-	-247552,
-	-22228941,
-	32335495,
-	-33507786,
-	29023139,
-	-21787875,
-	14090596,
-	-7455127,
-	2637522,
-	246915,
-	-1515503,
-	1689990,
-	-1302007,
-	765634,
-	-325767,
-	-212487,
-	713310,
-	-1614165,
-	2871849,
-	-4221542,
-	5123903,
-	-4783521,
-	2264776,
-	3291047,
-	-12372643,
-	24782256,
-	-39363553,
-	53833148,
-	-64732190,
-	67416168,
-	-55773114,
-	20658488,
-	57167212,
-	-248323854,
-	1457061661,
-	881930109,
-	-357520072,
-	196405051,
-	-105504979,
-	45614759,
-	-6053297,
-	-17839995,
-	29425717,
-	-31909198,
-	28439610,
-	-21881751,
-	14549208,
-	-8032834,
-	3172898,
-	-165169,
-	-1244880,
-	1539833,
-	-1234744,
-	744011,
-	-322230,
-	-188954,
-	679247,
-	-1588663,
-	2896102,
-	-4360432,
-	5458817,
-	-5393787,
-	3197685,
-	2058186,
-	-10971516,
-	23484388,
-	-38593647,
-	54158349,
-	-66826591,
-	72008596,
-	-63598288,
-	32450182,
-	40574471,
-	-226002347,
-	1490083373,
-	830858861,
-	-353087771,
-	200175781,
-	-111718831,
-	52101737,
-	-11752316,
-	-13420914,
-	26410177,
-	-30176157,
-	27725360,
-	-21867490,
-	14929765,
-	-8561829,
-	3683280,
-	-568492,
-	-973900,
-	1385648,
-	-1163153,
-	719279,
-	-317051,
-	-163301,
-	640432,
-	-1554241,
-	2906175,
-	-4480238,
-	5772718,
-	-5987729,
-	4129671,
-	796619,
-	-9496242,
-	22052940,
-	-37623272,
-	54220951,
-	-68619551,
-	76309915,
-	-71228864,
-	44292634,
-	23387864,
-	-201665015,
-	1520950803,
-	779484777,
-	-347093155,
-	202901823,
-	-117289939,
-	58243136,
-	-17318448,
-	-8993543,
-	23304911,
-	-28318874,
-	26885651,
-	-21746696,
-	15231575,
-	-9040292,
-	4166582,
-	-961214,
-	-703929,
-	1228317,
-	-1087724,
-	691677,
-	-310335,
-	-135590,
-	596922,
-	-1510837,
-	2901683,
-	-4579951,
-	6063621,
-	-6562081,
-	5056059,
-	-487799,
-	-7953098,
-	20493193,
-	-36454591,
-	54017238,
-	-70098297,
-	80295044,
-	-78624693,
-	56129532,
-	5674390,
-	-175333994,
-	1549574158,
-	727945454,
-	-339609909,
-	204591748,
-	-122202181,
-	64014314,
-	-22726518,
-	-4579486,
-	20126188,
-	-26348037,
-	25926287,
-	-21521477,
-	15454345,
-	-9466683,
-	4620887,
-	-1341587,
-	-436301,
-	1068713,
-	-1008959,
-	661455,
-	-302195,
-	-105900,
-	548802,
-	-1458437,
-	2882309,
-	-4658645,
-	6329625,
-	-7113619,
-	5972127,
-	-1789011,
-	-6348787,
-	18811136,
-	-35090774,
-	53544758,
-	-71251427,
-	83940101,
-	-85746156,
-	67903600,
-	-12495068,
-	-147038504,
-	1575869968,
-	676377676,
-	-330715548,
-	205258643,
-	-126442792,
-	69392745,
-	-27952445,
-	-200009,
-	16890426,
-	-24274745,
-	24853583,
-	-21194424,
-	15598173,
-	-9839745,
-	5044456,
-	-1707956,
-	-172307,
-	907702,
-	-927360,
-	628866,
-	-292746,
-	-74323,
-	496187,
-	-1397076,
-	2847803,
-	-4715481,
-	6568915,
-	-7639180,
-	6873131,
-	-3100788,
-	-4690412,
-	17013446,
-	-33535997,
-	52802352,
-	-72068991,
-	87222533,
-	-92554363,
-	79556847,
-	-31045969,
-	-116814834,
-	1599761386,
-	624916956,
-	-320491074,
-	204919974,
-	-130002366,
-	74358098,
-	-32973345,
-	4124065,
-	13614109,
-	-22110459,
-	23674322,
-	-20768592,
-	15663550,
-	-10158505,
-	5435734,
-	-2058767,
-	86807,
-	746137,
-	-843430,
-	594170,
-	-282106,
-	-40968,
-	439218,
-	-1326834,
-	2797993,
-	-4749717,
-	6779783,
-	-8135679,
-	7754328,
-	-4416755,
-	-2985443,
-	15107462,
-	-31795437,
-	51790175,
-	-72542550,
-	90121243,
-	-99011346,
-	91030827,
-	-49900349,
-	-84706294,
-	1621178452,
-	573697092,
-	-309020617,
-	203597432,
-	-132874857,
-	78892305,
-	-37767622,
-	8372446,
-	10313713,
-	-19866930,
-	22395719,
-	-20247479,
-	15651345,
-	-10422276,
-	5793355,
-	-2392575,
-	339845,
-	584851,
-	-757674,
-	557629,
-	-270397,
-	-5958,
-	378065,
-	-1247845,
-	2732779,
-	-4760713,
-	6960632,
-	-8600125,
-	8611000,
-	-5730422,
-	-1241687,
-	13101161,
-	-29875254,
-	50509711,
-	-72665240,
-	92616713,
-	-105080254,
-	102266891,
-	-68977079,
-	-50763144,
-	1640058343,
-	522849728,
-	-296391070,
-	201316760,
-	-135057545,
-	82979613,
-	-42315059,
-	12525472,
-	7005615,
-	-17556146,
-	21025380,
-	-19635001,
-	15562795,
-	-10630656,
-	6116144,
-	-2708050,
-	585669,
-	424659,
-	-670588,
-	519507,
-	-257742,
-	30570,
-	312930,
-	-1160290,
-	2652141,
-	-4747933,
-	7109990,
-	-9029639,
-	9438476,
-	-7035213,
-	532745,
-	11003123,
-	-27782577,
-	48963786,
-	-72431830,
-	94691121,
-	-110725549,
-	113206463,
-	-88192139,
-	-15042498,
-	1656345595,
-	472503926,
-	-282691722,
-	198107567,
-	-136551007,
-	86606628,
-	-46596894,
-	16564193,
-	3706024,
-	-15190267,
-	19571254,
-	-18935468,
-	15399499,
-	-10783520,
-	6403119,
-	-3003976,
-	823200,
-	266348,
-	-582665,
-	480068,
-	-244266,
-	68463,
-	244038,
-	-1064401,
-	2556140,
-	-4710954,
-	7226515,
-	-9421467,
-	10232159,
-	-8324503,
-	2329478,
-	8822498,
-	-25525481,
-	47156567,
-	-71838762,
-	96328447,
-	-115913189,
-	123791305,
-	-107458900,
-	22391800,
-	1669992298,
-	422785750,
-	-268013879,
-	194003128,
-	-137359059,
-	89762346,
-	-50595894,
-	20470457,
-	430898,
-	-12781563,
-	18041597,
-	-18153559,
-	15163398,
-	-10881026,
-	6653497,
-	-3279262,
-	1051427,
-	110677,
-	-494386,
-	439575,
-	-230091,
-	107557,
-	171646,
-	-960463,
-	2444916,
-	-4649468,
-	7309010,
-	-9773001,
-	10987552,
-	-9591643,
-	4139908,
-	6568968,
-	-23112957,
-	45093563,
-	-70884195,
-	97514576,
-	-120610816,
-	133963793,
-	-126688433,
-	61469328,
-	1680958263,
-	373817864,
-	-252450488,
-	189040172,
-	-137488691,
-	92438173,
-	-54296418,
-	24226988,
-	-2804126,
-	-10342351,
-	16444922,
-	-17294290,
-	14856764,
-	-10923599,
-	6866689,
-	-3532939,
-	1269406,
-	-41628,
-	-406221,
-	398286,
-	-215343,
-	147673,
-	96035,
-	-848808,
-	2318694,
-	-4563289,
-	7356429,
-	-10081794,
-	11700276,
-	-10830000,
-	5955245,
-	4252705,
-	-20554884,
-	42781612,
-	-69568033,
-	98237396,
-	-124787934,
-	143667189,
-	-145789821,
-	102113260,
-	1689211170,
-	325719144,
-	-236095758,
-	183258659,
-	-136949984,
-	94627933,
-	-57684468,
-	27817456,
-	-5983811,
-	-7884940,
-	14789953,
-	-16362985,
-	14482185,
-	-10911933,
-	7042303,
-	-3764169,
-	1476266,
-	-189875,
-	-318627,
-	356457,
-	-200141,
-	188618,
-	17514,
-	-729820,
-	2177780,
-	-4452351,
-	7367885,
-	-10345571,
-	12366101,
-	-12032986,
-	7766549,
-	1884331,
-	-17861985,
-	40228866,
-	-67891952,
-	98486878,
-	-128416081,
-	152845919,
-	-164670491,
-	144240568,
-	1694726677,
-	278604306,
-	-219044777,
-	176701544,
-	-135756020,
-	96327864,
-	-60747741,
-	31226546,
-	-9093380,
-	-5421563,
-	13085584,
-	-15365248,
-	14042542,
-	-10846980,
-	7180141,
-	-3972240,
-	1671211,
-	-333409,
-	-232044,
-	314338,
-	-184607,
-	230188,
-	-63582,
-	-603930,
-	2022565,
-	-4316715,
-	7342657,
-	-10562246,
-	12980964,
-	-13194094,
-	9564778,
-	-525135,
-	-15045790,
-	37444768,
-	-65859411,
-	98255158,
-	-131468995,
-	161445844,
-	-183236549,
-	187762244,
-	1697488506,
-	232583555,
-	-201393135,
-	169414536,
-	-133922773,
-	97536602,
-	-63475661,
-	34440019,
-	-12118589,
-	-2964323,
-	11340829,
-	-14306929,
-	13540996,
-	-10729938,
-	7280198,
-	-4156572,
-	1853523,
-	-471617,
-	-146895,
-	272170,
-	-168855
+	-307462
 
 };
 
 struct src_stage src_int32_40_21_3968_5000 = {
 	11, 21, 40, 40, 1600, 21, 40, 0, 0,
-	src_int32_40_21_3968_5000_fir};
+	src_int32_40_21_3968_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_4_3_4535_5000_fir[352] = {
+const int32_t src_int32_4_3_4535_5000_fir[176] = {
 	-92406,
 	134596,
 	-172955,
@@ -183,186 +183,10 @@ const int32_t src_int32_4_3_4535_5000_fir[352] = {
 	367521,
 	-239095,
 	142729,
-	-75412,
-	-75412,
-	142729,
-	-239095,
-	367521,
-	-528870,
-	721093,
-	-938509,
-	1171177,
-	-1404449,
-	1618728,
-	-1789538,
-	1887914,
-	-1881173,
-	1734067,
-	-1410327,
-	874553,
-	-94423,
-	-956886,
-	2298127,
-	-3937391,
-	5869613,
-	-8074279,
-	10513476,
-	-13130355,
-	15848091,
-	-18569352,
-	21176260,
-	-23530723,
-	25474929,
-	-26831647,
-	27403763,
-	-26972147,
-	25290375,
-	-22073792,
-	16978445,
-	-9561299,
-	-795929,
-	15038822,
-	-34766272,
-	63007473,
-	-106383275,
-	182728934,
-	-361976166,
-	1461114371,
-	932444601,
-	-369909774,
-	229472505,
-	-161853737,
-	119998879,
-	-90425662,
-	67875066,
-	-49905711,
-	35246386,
-	-23174218,
-	13243486,
-	-5154556,
-	-1314149,
-	6343080,
-	-10091891,
-	12710360,
-	-14343708,
-	15134503,
-	-15222474,
-	14743115,
-	-13825651,
-	12590816,
-	-11148719,
-	9597032,
-	-8019632,
-	6485781,
-	-5049885,
-	3751798,
-	-2617655,
-	1661121,
-	-885003,
-	283079,
-	157934,
-	-456402,
-	633869,
-	-713318,
-	717655,
-	-668473,
-	585105,
-	-483989,
-	378322,
-	-277971,
-	189618,
-	-117075,
-	24318,
-	-133,
-	-52186,
-	141438,
-	-276159,
-	463787,
-	-709698,
-	1016168,
-	-1381308,
-	1798040,
-	-2253207,
-	2726878,
-	-3191933,
-	3614009,
-	-3951853,
-	4158132,
-	-4180727,
-	3964496,
-	-3453483,
-	2593518,
-	-1335110,
-	-363454,
-	2532951,
-	-5190123,
-	8334785,
-	-11947265,
-	15986286,
-	-20387357,
-	25061680,
-	-29895522,
-	34749839,
-	-39459786,
-	43833437,
-	-47648483,
-	50644700,
-	-52507853,
-	52836065,
-	-51068157,
-	46321858,
-	-36989159,
-	19545653,
-	16013223,
-	-115092154,
-	1775663649,
-	352289694,
-	-205545868,
-	156801585,
-	-129645170,
-	110480787,
-	-95078238,
-	81765532,
-	-69803863,
-	58857567,
-	-48783143,
-	39532369,
-	-31102720,
-	23509887,
-	-16771756,
-	10898942,
-	-5889416,
-	1725890,
-	1624834,
-	-4211085,
-	6094510,
-	-7347530,
-	8050355,
-	-8287785,
-	8146004,
-	-7709550,
-	7058601,
-	-6266696,
-	5398956,
-	-4510854,
-	3647541,
-	-2843689,
-	2123834,
-	-1503105,
-	988295,
-	-579151,
-	269806,
-	-50243,
-	-92271,
-	171872,
-	-202952,
-	199213,
-	-172955,
-	134596,
-	-92406
+	-75412
 
 };
 
 struct src_stage src_int32_4_3_4535_5000 = {
 	2, 3, 4, 88, 352, 3, 4, 0, 0,
-	src_int32_4_3_4535_5000_fir};
+	src_int32_4_3_4535_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int32_t src_int32_8_21_3239_5000_fir[480] = {
+const int32_t src_int32_8_21_3239_5000_fir[240] = {
 	-149226,
 	295321,
 	1071448,
@@ -247,250 +247,10 @@ const int32_t src_int32_8_21_3239_5000_fir[480] = {
 	535725,
 	1278029,
 	689552,
-	865,
-	865,
-	689552,
-	1278029,
-	535725,
-	-1891823,
-	-4092017,
-	-2797256,
-	3064350,
-	9351387,
-	8621517,
-	-2568400,
-	-17156944,
-	-20285222,
-	-2607392,
-	26349794,
-	40133511,
-	17096957,
-	-33930531,
-	-70481563,
-	-47970555,
-	34282027,
-	114941998,
-	108924134,
-	-16197399,
-	-186152865,
-	-244970574,
-	-58698883,
-	371233281,
-	875484447,
-	1203756592,
-	1179914989,
-	816999850,
-	308605343,
-	-97055662,
-	-249200418,
-	-167473081,
-	4492404,
-	116450780,
-	108029490,
-	22331038,
-	-54661027,
-	-68477368,
-	-27263058,
-	22068278,
-	40189905,
-	22944839,
-	-5843078,
-	-20985100,
-	-15639985,
-	-728353,
-	9300349,
-	8798834,
-	2170906,
-	-3231068,
-	-3944587,
-	-1538503,
-	732295,
-	1252570,
-	586678,
-	-50476,
-	61532,
-	791922,
-	1281591,
-	309469,
-	-2243896,
-	-4181986,
-	-2284446,
-	3969814,
-	9789133,
-	7764001,
-	-4473748,
-	-18487964,
-	-19233125,
-	830263,
-	29512557,
-	39458483,
-	11638211,
-	-40377760,
-	-71501493,
-	-40256053,
-	46246471,
-	120428804,
-	99384497,
-	-37708079,
-	-203070278,
-	-236722314,
-	-16296482,
-	435139661,
-	931116717,
-	1221830041,
-	1150521271,
-	756167262,
-	247723041,
-	-131209647,
-	-249603676,
-	-147379419,
-	24113017,
-	121949620,
-	99852390,
-	10565347,
-	-60273374,
-	-65559571,
-	-20482535,
-	26499944,
-	39654211,
-	19359411,
-	-8837921,
-	-21339515,
-	-13969585,
-	1021838,
-	9800167,
-	8146945,
-	1302794,
-	-3584312,
-	-3746324,
-	-1189989,
-	898324,
-	1207812,
-	485451,
-	-92452,
-	131239,
-	891418,
-	1260863,
-	55043,
-	-2588200,
-	-4208409,
-	-1695708,
-	4872903,
-	10097584,
-	6731118,
-	-6417408,
-	-19601843,
-	-17827357,
-	4425920,
-	32372328,
-	38146729,
-	5754146,
-	-46496253,
-	-71478433,
-	-31589397,
-	58044839,
-	124342567,
-	87876352,
-	-59767649,
-	-217881629,
-	-224300515,
-	29947857,
-	499834323,
-	983412235,
-	1233971170,
-	1115840947,
-	693505507,
-	189026078,
-	-161050786,
-	-246405629,
-	-126220886,
-	42441972,
-	125434492,
-	90582781,
-	-853017,
-	-64771346,
-	-61809257,
-	-13693333,
-	30349957,
-	38560661,
-	15655163,
-	-11558511,
-	-21360175,
-	-12178967,
-	2660308,
-	10123475,
-	7411867,
-	472093,
-	-3856853,
-	-3504250,
-	-851794,
-	1033582,
-	1146499,
-	387782,
-	-125242,
-	209441,
-	985491,
-	1213730,
-	-225353,
-	-2917837,
-	-4165896,
-	-1035658,
-	5758331,
-	10263546,
-	5529287,
-	-8370280,
-	-20469254,
-	-16072056,
-	8130976,
-	34870231,
-	36189265,
-	-483802,
-	-52177836,
-	-70366989,
-	-22059907,
-	69492235,
-	126552414,
-	74474519,
-	-82083007,
-	-230252369,
-	-207589635,
-	79785089,
-	564808985,
-	1031911724,
-	1240069506,
-	1076186058,
-	629542365,
-	132922525,
-	-186516191,
-	-239861449,
-	-104342845,
-	59284423,
-	126946515,
-	80400887,
-	-11773742,
-	-68136346,
-	-57316330,
-	-6995570,
-	33586760,
-	36950332,
-	11892756,
-	-13977156,
-	-21063319,
-	-10301522,
-	4168095,
-	10275415,
-	6610126,
-	-310478,
-	-4049899,
-	-3225632,
-	-528828,
-	1138422,
-	1071448,
-	295321,
-	-149226
+	865
 
 };
 
 struct src_stage src_int32_8_21_3239_5000 = {
 	13, 5, 8, 60, 480, 21, 8, 0, 1,
-	src_int32_8_21_3239_5000_fir};
+	src_int32_8_21_3239_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int16_t src_int16_1_3_1814_5000_fir[48] = {
+const int16_t src_int16_1_3_1814_5000_fir[24] = {
 	-9,
 	-7,
 	22,
@@ -31,34 +31,10 @@ const int16_t src_int16_1_3_1814_5000_fir[48] = {
 	6035,
 	14053,
 	21417,
-	25826,
-	25826,
-	21417,
-	14053,
-	6035,
-	-410,
-	-3943,
-	-4467,
-	-2922,
-	-693,
-	1037,
-	1701,
-	1390,
-	596,
-	-149,
-	-530,
-	-520,
-	-288,
-	-37,
-	106,
-	126,
-	77,
-	22,
-	-7,
-	-9
+	25826
 
 };
 
 struct src_stage src_int16_1_3_1814_5000 = {
 	1, 0, 1, 48, 48, 3, 1, 0, 2,
-	src_int16_1_3_1814_5000_fir};
+	src_int16_1_3_1814_5000_fir, 1};
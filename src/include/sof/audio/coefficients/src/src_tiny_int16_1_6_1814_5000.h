@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int16_t src_int16_1_6_1814_5000_fir[92] = {
+const int16_t src_int16_1_6_1814_5000_fir[46] = {
 	-4,
 	0,
 	10,
@@ -53,56 +53,10 @@ const int16_t src_int16_1_6_1814_5000_fir[92] = {
 	19713,
 	22791,
 	25001,
-	26156,
-	26156,
-	25001,
-	22791,
-	19713,
-	16024,
-	12021,
-	8009,
-	4275,
-	1055,
-	-1481,
-	-3243,
-	-4223,
-	-4486,
-	-4154,
-	-3391,
-	-2374,
-	-1275,
-	-245,
-	606,
-	1208,
-	1536,
-	1606,
-	1461,
-	1165,
-	788,
-	397,
-	45,
-	-230,
-	-409,
-	-491,
-	-488,
-	-423,
-	-319,
-	-202,
-	-92,
-	-3,
-	58,
-	91,
-	100,
-	90,
-	70,
-	47,
-	26,
-	10,
-	0,
-	-4
+	26156
 
 };
 
 struct src_stage src_int16_1_6_1814_5000 = {
 	1, 0, 1, 92, 92, 6, 1, 0, 3,
-	src_int16_1_6_1814_5000_fir};
+	src_int16_1_6_1814_5000_fir, 1};
@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int16_t src_int16_25_24_1814_5000_fir[400] = {
+const int16_t src_int16_25_24_1814_5000_fir[200] = {
 	-6,
 	60,
 	-44,
@@ -207,210 +207,10 @@ const int16_t src_int16_25_24_1814_5000_fir[400] = {
 	1152,
 	-2457,
 	253,
-	15762,
-	15762,
-	253,
-	-2457,
-	1152,
-	96,
-	-296,
-	85,
-	6,
-	10,
-	84,
-	-315,
-	158,
-	1108,
-	-2614,
-	733,
-	16260,
-	15234,
-	-199,
-	-2291,
-	1186,
-	36,
-	-276,
-	88,
-	3,
-	12,
-	80,
-	-333,
-	223,
-	1053,
-	-2759,
-	1240,
-	16725,
-	14677,
-	-621,
-	-2116,
-	1209,
-	-20,
-	-255,
-	89,
-	1,
-	15,
-	75,
-	-349,
-	290,
-	986,
-	-2891,
-	1774,
-	17155,
-	14094,
-	-1013,
-	-1936,
-	1222,
-	-73,
-	-233,
-	89,
-	-1,
-	19,
-	69,
-	-364,
-	359,
-	909,
-	-3009,
-	2332,
-	17548,
-	13489,
-	-1374,
-	-1750,
-	1225,
-	-123,
-	-211,
-	88,
-	-2,
-	24,
-	63,
-	-376,
-	429,
-	820,
-	-3109,
-	2913,
-	17902,
-	12862,
-	-1704,
-	-1561,
-	1219,
-	-168,
-	-189,
-	86,
-	-4,
-	27,
-	53,
-	-386,
-	499,
-	720,
-	-3192,
-	3515,
-	18216,
-	12218,
-	-2002,
-	-1369,
-	1204,
-	-210,
-	-166,
-	84,
-	-4,
-	31,
-	43,
-	-394,
-	570,
-	609,
-	-3255,
-	4137,
-	18487,
-	11560,
-	-2269,
-	-1178,
-	1181,
-	-247,
-	-144,
-	80,
-	-5,
-	36,
-	32,
-	-398,
-	640,
-	487,
-	-3297,
-	4775,
-	18715,
-	10889,
-	-2505,
-	-988,
-	1150,
-	-280,
-	-123,
-	77,
-	-5,
-	40,
-	19,
-	-400,
-	710,
-	355,
-	-3316,
-	5429,
-	18899,
-	10209,
-	-2709,
-	-800,
-	1112,
-	-309,
-	-102,
-	73,
-	-7,
-	45,
-	5,
-	-398,
-	778,
-	214,
-	-3310,
-	6095,
-	19038,
-	9523,
-	-2882,
-	-616,
-	1068,
-	-334,
-	-82,
-	69,
-	-6,
-	50,
-	-10,
-	-393,
-	843,
-	63,
-	-3280,
-	6770,
-	19131,
-	8833,
-	-3025,
-	-436,
-	1019,
-	-355,
-	-62,
-	64,
-	-7,
-	55,
-	-26,
-	-384,
-	905,
-	-96,
-	-3223,
-	7454,
-	19177,
-	8142,
-	-3138,
-	-263,
-	964,
-	-371,
-	-44,
-	60,
-	-6
+	15762
 
 };
 
 struct src_stage src_int16_25_24_1814_5000 = {
 	23, 24, 25, 16, 400, 24, 25, 0, 0,
-	src_int16_25_24_1814_5000_fir};
+	src_int16_25_24_1814_5000_fir, 1};
@@ -61,4 +61,4 @@ const int16_t src_int16_2_3_1814_5000_fir[48] = {
 
 struct src_stage src_int16_2_3_1814_5000 = {
 	1, 1, 2, 24, 48, 3, 2, 0, 1,
-	src_int16_2_3_1814_5000_fir};
+	src_int16_2_3_1814_5000_fir, 0};
@@ -61,4 +61,4 @@ const int16_t src_int16_3_2_1814_5000_fir[48] = {
 
 struct src_stage src_int16_3_2_1814_5000 = {
 	1, 2, 3, 16, 48, 2, 3, 0, 0,
-	src_int16_3_2_1814_5000_fir};
+	src_int16_3_2_1814_5000_fir, 0};
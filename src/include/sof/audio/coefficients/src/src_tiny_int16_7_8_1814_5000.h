@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-const int16_t src_int16_7_8_1814_5000_fir[140] = {
+const int16_t src_int16_7_8_1814_5000_fir[70] = {
 	-3,
 	-28,
 	94,
@@ -77,80 +77,10 @@ const int16_t src_int16_7_8_1814_5000_fir[140] = {
 	370,
 	-3209,
 	2176,
-	15612,
-	15612,
-	2176,
-	-3209,
-	370,
-	988,
-	-436,
-	-170,
-	154,
-	-2,
-	-16,
-	-21,
-	17,
-	155,
-	-264,
-	-327,
-	1174,
-	-136,
-	-3284,
-	4023,
-	16864,
-	14036,
-	547,
-	-2925,
-	780,
-	758,
-	-497,
-	-80,
-	141,
-	-15,
-	-11,
-	-26,
-	40,
-	142,
-	-354,
-	-171,
-	1294,
-	-712,
-	-3108,
-	6027,
-	17732,
-	12206,
-	-817,
-	-2481,
-	1079,
-	508,
-	-512,
-	-1,
-	120,
-	-24,
-	-7,
-	-28,
-	66,
-	112,
-	-432,
-	28,
-	1329,
-	-1325,
-	-2649,
-	8115,
-	18176,
-	10203,
-	-1887,
-	-1931,
-	1261,
-	259,
-	-488,
-	64,
-	94,
-	-28,
-	-3
+	15612
 
 };
 
 struct src_stage src_int16_7_8_1814_5000 = {
 	1, 1, 7, 20, 140, 8, 7, 0, 0,
-	src_int16_7_8_1814_5000_fir};
+	src_int16_7_8_1814_5000_fir, 1};
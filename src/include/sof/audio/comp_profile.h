@@ -0,0 +1,140 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2020 Intel Corporation. All rights reserved.
+ */
+
+/**
+ * \file include/sof/audio/comp_profile.h
+ * \brief Component copy profiling for host (library) builds
+ */
+
+#ifndef __SOF_AUDIO_COMP_PROFILE_H__
+#define __SOF_AUDIO_COMP_PROFILE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct comp_dev;
+
+/** \brief Sub-buckets per power of two in the copy time histogram. */
+#define COMP_PROFILE_HIST_SHIFT	3
+
+/** \brief Copy time histogram size, covers times up to 2^34 ns. */
+#define COMP_PROFILE_HIST_SIZE	256
+
+/** \brief Copy statistics of a component, times are in nanoseconds. */
+struct comp_profile {
+	uint64_t count;		/**< number of copies */
+	uint64_t frames;	/**< frames processed */
+	uint64_t time_sum;	/**< sum of copy times */
+	uint64_t time_min;	/**< shortest copy */
+	uint64_t time_max;	/**< longest copy */
+	uint64_t cycles_sum;	/**< sum of host cycles spent in copy */
+	uint32_t rate;		/**< stream rate, for MCPS calculation */
+	uint32_t hist[COMP_PROFILE_HIST_SIZE];	/**< log scale histogram */
+};
+
+/** \brief State captured before single copy. */
+struct comp_profile_stamp {
+	uint64_t time;
+	uint64_t cycles;
+	uint32_t sink_avail;
+	uint32_t source_avail;
+};
+
+#if CONFIG_LIBRARY
+
+/** \brief Profiling of all pipeline copies is enabled. */
+extern bool comp_profile_enabled;
+
+void comp_profile_stamp_begin(struct comp_dev *dev,
+			      struct comp_profile_stamp *stamp);
+void comp_profile_stamp_end(struct comp_dev *dev,
+			    struct comp_profile_stamp *stamp);
+void comp_profile_stamp_toggle(struct comp_profile_stamp *stamp);
+void comp_profile_stamp_end_paused(struct comp_dev *dev,
+				   struct comp_profile_stamp *stamp,
+				   uint32_t frames, uint32_t rate);
+
+/**
+ * \brief Calculates copy time percentile from the histogram.
+ * \param[in] prof Component profile.
+ * \param[in] pct Percentile, 0 to 100.
+ * \return Copy time in nanoseconds, accurate to 1/16 of its value.
+ */
+uint64_t comp_profile_percentile(const struct comp_profile *prof,
+				 uint32_t pct);
+
+/**
+ * \brief Calculates MCPS needed to process the stream in real time.
+ * \param[in] prof Component profile.
+ * \return Millions of host cycles per second of audio.
+ */
+double comp_profile_mcps(const struct comp_profile *prof);
+
+static inline void comp_profile_begin(struct comp_dev *dev,
+				      struct comp_profile_stamp *stamp)
+{
+	if (comp_profile_enabled)
+		comp_profile_stamp_begin(dev, stamp);
+}
+
+static inline void comp_profile_end(struct comp_dev *dev,
+				    struct comp_profile_stamp *stamp)
+{
+	if (comp_profile_enabled)
+		comp_profile_stamp_end(dev, stamp);
+}
+
+/**
+ * \brief Stops the clock of a copy done in parts, interleaved with copies
+ *	  of other components, the time so far is kept in the stamp.
+ * \param[in,out] stamp Stamp set by comp_profile_begin().
+ */
+static inline void comp_profile_pause(struct comp_profile_stamp *stamp)
+{
+	if (comp_profile_enabled)
+		comp_profile_stamp_toggle(stamp);
+}
+
+/**
+ * \brief Restarts the clock stopped by comp_profile_pause().
+ * \param[in,out] stamp Paused stamp.
+ */
+static inline void comp_profile_resume(struct comp_profile_stamp *stamp)
+{
+	if (comp_profile_enabled)
+		comp_profile_stamp_toggle(stamp);
+}
+
+/**
+ * \brief Records a copy done in parts, the buffers around the component
+ *	  may not show what it processed, so frames are given explicitly.
+ * \param[in] dev Component.
+ * \param[in] stamp Paused stamp.
+ * \param[in] frames Frames processed by the copy.
+ * \param[in] rate Stream rate, for MCPS calculation.
+ */
+static inline void comp_profile_end_paused(struct comp_dev *dev,
+					   struct comp_profile_stamp *stamp,
+					   uint32_t frames, uint32_t rate)
+{
+	if (comp_profile_enabled)
+		comp_profile_stamp_end_paused(dev, stamp, frames, rate);
+}
+
+#else
+
+static inline void comp_profile_begin(struct comp_dev *dev,
+				      struct comp_profile_stamp *stamp) { }
+static inline void comp_profile_end(struct comp_dev *dev,
+				    struct comp_profile_stamp *stamp) { }
+static inline void comp_profile_pause(struct comp_profile_stamp *stamp) { }
+static inline void comp_profile_resume(struct comp_profile_stamp *stamp) { }
+static inline void comp_profile_end_paused(struct comp_dev *dev,
+					   struct comp_profile_stamp *stamp,
+					   uint32_t frames, uint32_t rate) { }
+
+#endif
+
+#endif /* __SOF_AUDIO_COMP_PROFILE_H__ */
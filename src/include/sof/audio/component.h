@@ -17,6 +17,7 @@
 #define __SOF_AUDIO_COMPONENT_H__
 
 #include <sof/audio/buffer.h>
+#include <sof/audio/comp_profile.h>
 #include <sof/audio/format.h>
 #include <sof/audio/pipeline.h>
 #include <sof/debug/panic.h>
@@ -327,6 +328,28 @@ struct comp_ops {
 	 */
 	int (*copy)(struct comp_dev *dev);
 
+	/**
+	 * Processes frames from source to sink stream, for components
+	 * producing one output frame per input frame. Used instead of
+	 * copy() when the pipeline runs a chain of such components in
+	 * small tiles, see pipeline_fused_copy().
+	 * @param dev Component device.
+	 * @param source Source stream, frames are consumed from it.
+	 * @param sink Sink stream, frames are produced to it.
+	 * @param frames Number of frames to process.
+	 * @return 0 if succeeded, error code otherwise.
+	 */
+	int (*process)(struct comp_dev *dev, struct audio_stream *source,
+		       struct audio_stream *sink, uint32_t frames);
+
+	/**
+	 * Writes back the component private data from the cache of the
+	 * current core, called before the component is moved to another
+	 * core. Components without it are never moved.
+	 * @param dev Component device.
+	 */
+	void (*writeback)(struct comp_dev *dev);
+
 	/**
 	 * Retrieves component rendering position.
 	 * @param dev Component device.
@@ -388,6 +411,10 @@ struct comp_driver {
 	uint32_t type;			/**< SOF_COMP_ for driver */
 	const struct sof_uuid *uid;	/**< Address to UUID value */
 	struct tr_ctx *tctx;		/**< Pointer to trace context */
+	uint32_t mcps;			/**< estimated load at 48 kHz stereo,
+					  *  0 if negligible, not scaled to
+					  *  the actual stream parameters
+					  */
 	struct comp_ops ops;		/**< component operations */
 };
 
@@ -428,6 +455,10 @@ struct comp_dev {
 	bool is_shared;		/**< indicates whether component is shared
 				  *  across cores
 				  */
+	bool inplace;		/**< indicates whether component can process
+				  *  with the sink buffer sharing the data
+				  *  area of the source buffer
+				  */
 	struct tr_ctx tctx;	/**< trace settings */
 
 	/* common runtime configuration for downstream/upstream */
@@ -446,6 +477,10 @@ struct comp_dev {
 	struct perf_cnt_data pcd;
 #endif
 
+#if CONFIG_LIBRARY
+	struct comp_profile profile;	/**< copy profile, host builds only */
+#endif
+
 	/**
 	 * IPC config object header - MUST be at end as it's
 	 * variable size/type
@@ -828,6 +863,13 @@ struct comp_data_blob_handler *comp_data_blob_handler_new(struct comp_dev *dev);
  */
 void comp_data_blob_handler_free(struct comp_data_blob_handler *blob_handler);
 
+/**
+ * Writes back data blob handler and its data blobs from the cache.
+ *
+ * @param blob_handler Data blob handler
+ */
+void comp_data_blob_writeback(struct comp_data_blob_handler *blob_handler);
+
 /**
  * Called by component in  params() function in order to set and update some of
  * downstream (playback) or upstream (capture) buffer parameters with pcm
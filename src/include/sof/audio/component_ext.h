@@ -210,6 +210,16 @@ static inline int comp_copy(struct comp_dev *dev)
 	return ret;
 }
 
+/** See comp_ops::process */
+static inline int comp_process(struct comp_dev *dev,
+			       struct audio_stream *source,
+			       struct audio_stream *sink, uint32_t frames)
+{
+	assert(dev->drv->ops.process);
+
+	return dev->drv->ops.process(dev, source, sink, frames);
+}
+
 /** See comp_ops::set_attribute */
 static inline int comp_set_attribute(struct comp_dev *dev, uint32_t type,
 				     void *value)
@@ -366,6 +376,13 @@ static inline bool comp_is_scheduling_source(struct comp_dev *dev)
 	return dev == dev->pipeline->sched_comp;
 }
 
+/** See comp_ops::writeback */
+static inline void comp_writeback_drvdata(struct comp_dev *dev)
+{
+	if (dev->drv->ops.writeback)
+		dev->drv->ops.writeback(dev);
+}
+
 /**
  * Called to reallocate component in shared memory.
  * @param dev Component device.
@@ -72,8 +72,11 @@ typedef void (*crossover_process)(const struct comp_dev *dev,
 				  int32_t num_sinks,
 				  uint32_t frames);
 
-typedef void (*crossover_split)(int32_t in, int32_t out[],
-				struct crossover_state *state);
+/* Frames processed by a split function call at most */
+#define CROSSOVER_BLOCK_FRAMES 16
+
+typedef void (*crossover_split)(const int32_t in[], int32_t *out[],
+				struct crossover_state *state, int frames);
 
 /* Crossover component private data */
 struct comp_data {
@@ -143,13 +146,15 @@ static inline crossover_split crossover_find_split_func(int32_t num_sinks)
 }
 
 /*
- * \brief Runs input in through the LR4 filter and returns it's output.
+ * \brief Runs frames of input x through the LR4 filter to y.
  */
-static inline int32_t crossover_generic_process_lr4(int32_t in,
-						    struct iir_state_df2t *lr4)
+static inline void crossover_generic_process_lr4(const int32_t x[],
+						 int32_t y[],
+						 struct iir_state_df2t *lr4,
+						 int frames)
 {
 	/* Cascade two biquads with same coefficients in series. */
-	return iir_df2t(lr4, in);
+	iir_df2t_block(lr4, x, y, frames, 1);
 }
 
 #endif //  __SOF_AUDIO_CROSSOVER_CROSSOVER_H__
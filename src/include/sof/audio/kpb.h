@@ -9,6 +9,7 @@
 #define __SOF_AUDIO_KPB_H__
 
 #include <sof/trace/trace.h>
+#include <ipc/stream.h>
 #include <user/trace.h>
 #include <stdint.h>
 
@@ -17,31 +18,23 @@ struct comp_buffer;
 /* KPB internal defines */
 
 #ifdef CONFIG_TIGERLAKE
-#define KPB_MAX_BUFF_TIME 3000 /**< time of buffering in miliseconds */
+#define KPB_DEFAULT_BUFF_TIME 3000 /**< time of buffering in miliseconds */
 #define HOST_WAKEUP_TIME 1000 /* aprox. time of host DMA wakup from suspend [ms] */
 #else
 /** Due to memory constraints on non-TGL platforms, the buffers are smaller. */
-#define KPB_MAX_BUFF_TIME 2100 /**< time of buffering in miliseconds */
+#define KPB_DEFAULT_BUFF_TIME 2100 /**< time of buffering in miliseconds */
 #define HOST_WAKEUP_TIME 0 /* aprox. time of host DMA wakup from suspend [ms] */
 #endif
 
-#define KPB_MAX_DRAINING_REQ (KPB_MAX_BUFF_TIME - HOST_WAKEUP_TIME)
-#define KPB_MAX_SUPPORTED_CHANNELS 2 /**< number of supported channels */
-/**< number of samples taken each milisecond */
-#define	KPB_SAMPLES_PER_MS (KPB_SAMPLNG_FREQUENCY / 1000)
-#define	KPB_SAMPLNG_FREQUENCY 16000 /**< supported sampling frequency in Hz */
-#define KPB_NUM_OF_CHANNELS 2
+/**< longest draining request for history of given depth [ms] */
+#define KPB_MAX_DRAINING_REQ(depth) ((depth) - HOST_WAKEUP_TIME)
+/**< number of supported channels */
+#define KPB_MAX_SUPPORTED_CHANNELS SOF_IPC_MAX_CHANNELS
 #define KPB_SAMPLE_CONTAINER_SIZE(sw) ((sw == 16) ? 16 : 32)
-#define KPB_MAX_BUFFER_SIZE(sw) ((KPB_SAMPLNG_FREQUENCY / 1000) * \
-	(KPB_SAMPLE_CONTAINER_SIZE(sw) / 8) * KPB_MAX_BUFF_TIME * \
-	KPB_NUM_OF_CHANNELS)
-#define KPB_MAX_NO_OF_CLIENTS 2
+#define KPB_MAX_NO_OF_CLIENTS 8
 #define KPB_NO_OF_HISTORY_BUFFERS 2 /**< no of internal buffers */
 #define KPB_ALLOCATION_STEP 0x100
 #define KPB_NO_OF_MEM_POOLS 3
-#define KPB_BYTES_TO_FRAMES(bytes, sample_width) \
-	(bytes / ((KPB_SAMPLE_CONTAINER_SIZE(sample_width) / 8) * \
-	KPB_NUM_OF_CHANNELS))
 /**< Defines how much faster draining is in comparison to pipeline copy. */
 #define KPB_DRAIN_NUM_OF_PPL_PERIODS_AT_ONCE 2
 /**< Host buffer shall be at least two times bigger than history buffer. */
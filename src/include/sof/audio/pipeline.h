@@ -8,6 +8,7 @@
 #ifndef __SOF_AUDIO_PIPELINE_H__
 #define __SOF_AUDIO_PIPELINE_H__
 
+#include <sof/audio/comp_profile.h>
 #include <sof/lib/cpu.h>
 #include <sof/lib/mailbox.h>
 #include <sof/lib/memory.h>
@@ -22,6 +23,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+struct audio_stream;
 struct comp_buffer;
 struct comp_dev;
 struct ipc;
@@ -86,9 +88,41 @@ extern struct tr_ctx pipe_tr;
 #define PPL_DIR_DOWNSTREAM	0
 #define PPL_DIR_UPSTREAM	1
 
+/* frames per tile of fused component copy */
+#define PPL_FUSE_FRAMES		16
+
+/* tile size fitting PPL_FUSE_FRAMES of any stream format, so a tile
+ * follows format changes of the buffer it replaces
+ */
+#define PPL_FUSE_TILE_SIZE \
+	(PPL_FUSE_FRAMES * SOF_IPC_MAX_CHANNELS * sizeof(int32_t))
+
 #define PPL_POSN_OFFSETS \
 	(MAILBOX_STREAM_SIZE / sizeof(struct sof_ipc_stream_posn))
 
+/*
+ * Precompiled copy schedule entry. Entries are stored in the order in which
+ * components are copied, so a period is a flat loop instead of a graph walk.
+ */
+struct pipeline_copy_entry {
+	struct comp_dev *comp;		/**< component to copy */
+	struct comp_buffer *buffer;	/**< buffer the walk reached comp by */
+	uint32_t subtree;	/**< number of entries reached only via comp,
+				  *  they follow comp downstream and precede
+				  *  it upstream
+				  */
+	bool run;		/**< copy in current period (upstream only) */
+	uint32_t fused;		/**< number of following entries processed
+				  *  together with comp in tiles
+				  */
+	struct audio_stream *tile;	/**< tile between comp and the next
+					  *  fused entry
+					  */
+	struct comp_profile_stamp stamp;	/**< profile of comp during
+						  *  fused copy
+						  */
+};
+
 /*
  * Audio pipeline.
  */
@@ -112,6 +146,11 @@ struct pipeline {
 
 	struct list_item list;	/**< list in walk context */
 
+	/* copy schedule built at prepare time */
+	struct pipeline_copy_entry *copy_list;
+	uint32_t copy_count;
+	uint32_t copy_dir;		/* PPL_DIR_ the schedule runs in */
+
 	/* position update */
 	uint32_t posn_offset;		/* position update array offset*/
 	struct ipc_msg *msg;
@@ -219,6 +258,26 @@ int pipeline_connect(struct comp_dev *comp, struct comp_buffer *buffer,
 int pipeline_complete(struct pipeline *p, struct comp_dev *source,
 		      struct comp_dev *sink);
 
+/**
+ * \brief Places a chain of components on cores in contiguous segments.
+ * \param[in] load Estimated load of each component.
+ * \param[in] count Number of components in the chain.
+ * \param[in,out] core_load Load of each core, the chain is added to it.
+ * \param[in] core_mask Cores the chain may run on.
+ * \param[in] core Core the chain starts and ends on.
+ * \param[out] comp_core Core assigned to each component.
+ */
+void pipeline_partition_plan(const uint32_t *load, uint32_t count,
+			     uint32_t *core_load, uint32_t core_mask,
+			     uint32_t core, uint32_t *comp_core);
+
+/* spread the processing components of the pipeline over enabled cores */
+int pipeline_partition(struct pipeline *p, struct comp_dev *source,
+		       struct comp_dev *sink);
+
+/* checks whether core runs components partitioning moved from other cores */
+bool pipeline_partition_core_busy(uint32_t core);
+
 /* pipeline parameters */
 int pipeline_params(struct pipeline *p, struct comp_dev *cd,
 		    struct sof_ipc_pcm_params *params);
@@ -8,6 +8,7 @@
 #ifndef __SOF_AUDIO_SRC_SRC_H__
 #define __SOF_AUDIO_SRC_SRC_H__
 
+#include <sof/math/x86_simd.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -25,6 +26,8 @@ struct src_param {
 	int stage2_times;
 	int idx_in;
 	int idx_out;
+	int fs_in;
+	int fs_out;
 	int nch;
 };
 
@@ -39,6 +42,8 @@ struct src_stage {
 	const int halfband;
 	const int shift;
 	const void *coefs; /* Can be int16_t or int32_t depending on config */
+	const int symmetric; /* coefs has only the first half of the filter */
+	const int cached; /* copy with full coefs from the stage cache */
 };
 
 struct src_state {
@@ -115,6 +120,13 @@ void src_polyphase_stage_cir(struct src_stage_prm *s);
 void src_polyphase_stage_cir_s16(struct src_stage_prm *s);
 #endif /* CONFIG_FORMAT_S16LE */
 
+#if SOF_X86_SIMD
+/* AVX2 filter core for 1, 2, 4 or 8 channels */
+void src_fir_filter_avx2(int32_t *rp, const void *cp, int32_t *wp,
+			 int32_t *fir_start, int32_t *fir_end,
+			 const int taps_x_nch, const int shift, const int nch);
+#endif
+
 int src_buffer_lengths(struct src_param *a, int fs_in, int fs_out, int nch,
 		       int source_frames);
 
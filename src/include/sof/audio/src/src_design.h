@@ -0,0 +1,41 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2020 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __SOF_AUDIO_SRC_SRC_DESIGN_H__
+#define __SOF_AUDIO_SRC_SRC_DESIGN_H__
+
+#include <stdint.h>
+
+/* Longest filter designed at run time, in coefficients */
+#define SRC_DESIGN_MAX_LENGTH	8192
+
+/* Polyphase stage of a conversion designed at run time. A stage with
+ * filter_length of one is a 1:1 placeholder without coefficients.
+ */
+struct src_design_stage {
+	int l;			/* interpolation factor, number of subfilters */
+	int m;			/* decimation factor */
+	int idm;		/* input delay step, -idm * l + odm * m == 1 */
+	int odm;		/* output delay step */
+	int subfilter_length;
+	int filter_length;
+	int fs;			/* rate the filter runs at, l times input */
+	int f_pb;		/* passband edge in Hz */
+	int f_sb;		/* stopband edge in Hz */
+	int32_t gain;		/* DC gain of the stage, Q2.30 */
+};
+
+/* Splits a conversion into two polyphase stages and sizes the filters,
+ * returns -EINVAL if the ratio is outside the design limits.
+ */
+int src_design(int fs_in, int fs_out, struct src_design_stage *stage1,
+	       struct src_design_stage *stage2);
+
+/* Computes the Kaiser windowed sinc filter of a stage into coefs, int16_t
+ * or int32_t as SRC_SHORT selects, and returns the output shift.
+ */
+int src_design_coefs(const struct src_design_stage *s, void *coefs);
+
+#endif /* __SOF_AUDIO_SRC_SRC_DESIGN_H__ */
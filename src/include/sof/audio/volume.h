@@ -19,6 +19,7 @@
 #include <sof/audio/component.h>
 #include <sof/bit.h>
 #include <sof/common.h>
+#include <sof/math/x86_simd.h>
 #include <sof/trace/trace.h>
 #include <ipc/stream.h>
 #include <user/trace.h>
@@ -126,6 +127,14 @@ extern const struct comp_func_map func_map[];
 /** \brief Number of processing functions. */
 extern const size_t func_count;
 
+#if SOF_X86_SIMD
+/** \brief Map of formats with AVX2 processing functions. */
+extern const struct comp_func_map func_map_avx2[];
+
+/** \brief Number of AVX2 processing functions. */
+extern const size_t func_count_avx2;
+#endif
+
 /** \brief Volume zero crossing functions map. */
 struct comp_zc_func_map {
 	uint16_t frame_fmt;	/**< frame format */
@@ -144,6 +153,19 @@ static inline vol_scale_func vol_get_processing_function(struct comp_dev *dev)
 	sinkb = list_first_item(&dev->bsink_list, struct comp_buffer,
 				source_list);
 
+#if SOF_X86_SIMD
+	/* prefer the AVX2 version when the host CPU supports it */
+	if (x86_has_avx2()) {
+		for (i = 0; i < func_count_avx2; i++) {
+			if (sinkb->stream.frame_fmt !=
+			    func_map_avx2[i].frame_fmt)
+				continue;
+
+			return func_map_avx2[i].func;
+		}
+	}
+#endif
+
 	/* map the volume function for source and sink buffers */
 	for (i = 0; i < func_count; i++) {
 		if (sinkb->stream.frame_fmt != func_map[i].frame_fmt)
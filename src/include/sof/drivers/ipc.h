@@ -62,6 +62,14 @@ extern struct tr_ctx ipc_tr;
 	       (object).hdr.size, sizeof(object))
 
 /* IPC generic component device */
+/* number of buckets in the component lookup tables, must be a power of 2 */
+#define IPC_COMP_HASH_SIZE	64
+
+/* host IDs are allocated monotonically so the low bits spread well */
+#define IPC_COMP_HASH(id)	((id) & (IPC_COMP_HASH_SIZE - 1))
+#define IPC_PPL_HASH(type, ppl_id) \
+	IPC_COMP_HASH(((uint32_t)(ppl_id) << 2) ^ (type))
+
 struct ipc_comp_dev {
 	uint16_t type;	/* COMP_TYPE_ */
 	uint16_t core;
@@ -76,6 +84,8 @@ struct ipc_comp_dev {
 
 	/* lists */
 	struct list_item list;		/* list in components */
+	struct list_item hash_list;	/* list in ID hash bucket */
+	struct list_item ppl_list;	/* list in pipeline ID hash bucket */
 };
 
 struct ipc_msg {
@@ -97,6 +107,10 @@ struct ipc {
 
 	struct list_item comp_list;	/* list of component devices */
 
+	/* component devices hashed by ID and by pipeline ID and type */
+	struct list_item comp_hash[IPC_COMP_HASH_SIZE];
+	struct list_item ppl_hash[IPC_COMP_HASH_SIZE];
+
 	/* processing task */
 	struct task ipc_task;
 
@@ -314,6 +328,12 @@ struct ipc_comp_dev *ipc_get_comp_by_id(struct ipc *ipc, uint32_t id);
 struct ipc_comp_dev *ipc_get_comp_by_ppl_id(struct ipc *ipc, uint16_t type,
 					    uint32_t ppl_id);
 
+/*
+ * Add component to, or remove it from, the component list and lookup tables.
+ */
+void ipc_comp_dev_add(struct ipc *ipc, struct ipc_comp_dev *icd);
+void ipc_comp_dev_del(struct ipc_comp_dev *icd);
+
 /*
  * Configure all DAI components attached to DAI.
  */
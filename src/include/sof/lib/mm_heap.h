@@ -33,6 +33,11 @@ struct block_hdr {
 	void *unaligned_ptr;	/* align ptr */
 } __packed;
 
+/* free block bitmap words, blocks are stored MSB first */
+#define BLOCK_MAP_WORD_BITS	32
+#define BLOCK_MAP_WORDS(count) \
+	(((count) + BLOCK_MAP_WORD_BITS - 1) / BLOCK_MAP_WORD_BITS)
+
 struct block_map {
 	uint16_t block_size;	/* size of block in bytes */
 	uint16_t count;		/* number of blocks in map */
@@ -40,11 +45,12 @@ struct block_map {
 	uint16_t first_free;	/* index of first free block */
 	struct block_hdr *block;	/* base block header */
 	uint32_t base;		/* base address of space */
+	uint32_t *free_map;	/* bit set for each free block */
 };
 
-#define BLOCK_DEF(sz, cnt, hdr) \
+#define BLOCK_DEF(sz, cnt, hdr, bits) \
 	{.block_size = sz, .count = cnt, .free_count = cnt, .block = hdr, \
-	 .first_free = 0}
+	 .first_free = 0, .free_map = bits}
 
 struct mm_heap {
 	uint32_t blocks;
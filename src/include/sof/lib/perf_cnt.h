@@ -82,6 +82,27 @@ struct perf_cnt_data {
 		}							  \
 	} while (0)
 
+/** \brief Stops the measurement started by perf_cnt_init(), the time
+ *  elapsed so far is kept in pcd until perf_cnt_resume().
+ *
+ *  Allows measuring an operation done in parts, interleaved with other
+ *  work, e.g. a component copied in tiles together with other components.
+ *  \param pcd Performance counters data.
+ */
+#define perf_cnt_pause(pcd) do {					\
+		(pcd)->plat_ts = platform_timer_get(timer_get()) -	\
+			(pcd)->plat_ts;					\
+		(pcd)->cpu_ts = arch_timer_get_system(cpu_timer_get()) - \
+			(pcd)->cpu_ts;					\
+	} while (0)
+
+/** \brief Continues the measurement stopped by perf_cnt_pause(), start
+ *  timestamps are moved back by the time elapsed before the pause, so the
+ *  next perf_cnt_stamp() includes it.
+ *  \param pcd Performance counters data.
+ */
+#define perf_cnt_resume(pcd) perf_cnt_pause(pcd)
+
 /**
  * For simple performance measurement and optimization in development stage,
  * tic-toc api is provided. Performance data are traced at each tok call,
@@ -118,6 +139,8 @@ struct perf_cnt_data {
 #else
 #define perf_cnt_clear(pcd)
 #define perf_cnt_init(pcd)
+#define perf_cnt_pause(pcd)
+#define perf_cnt_resume(pcd)
 #define perf_cnt_stamp(pcd, trace_m, arg)
 #endif
 
@@ -16,6 +16,7 @@
 
 #include <sof/audio/audio_stream.h>
 #include <sof/audio/format.h>
+#include <sof/math/x86_simd.h>
 #include <user/fir.h>
 #include <stdint.h>
 
@@ -28,7 +29,7 @@ struct fir_state_32x16 {
 	int length; /* Number of FIR taps */
 	int out_shift; /* Amount of right shifts at output */
 	int16_t *coef; /* Pointer to FIR coefficients */
-	int32_t *delay; /* Pointer to FIR delay line */
+	int32_t *delay; /* Pointer to FIR delay line, 2x length mirrored */
 };
 
 void fir_reset(struct fir_state_32x16 *fir);
@@ -42,5 +43,22 @@ void fir_init_delay(struct fir_state_32x16 *fir, int32_t **data);
 
 int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x);
 
+void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1,
+		  int32_t *y0, int32_t *y1);
+
+/* Filter frames samples from x to y, the samples are stride apart in
+ * both. The in-place operation with x equal to y is allowed.
+ */
+void fir_32x16_block(struct fir_state_32x16 *fir, const int32_t *x,
+		     int32_t *y, int frames, int stride);
+
+#if SOF_X86_SIMD
+/* AVX2 version of four samples processing, the write index must not
+ * wrap within them.
+ */
+void fir_32x16_4x_avx2(struct fir_state_32x16 *fir, const int32_t *x,
+		       int32_t *y, int stride);
+#endif
+
 #endif
 #endif /* __SOF_MATH_FIR_GENERIC_H__ */
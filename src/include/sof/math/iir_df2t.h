@@ -10,6 +10,7 @@
 #ifndef __SOF_MATH_IIR_DF2T_H__
 #define __SOF_MATH_IIR_DF2T_H__
 
+#include <sof/math/x86_simd.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -49,6 +50,9 @@
 
 #define IIR_DF2T_NUM_DELAYS 2
 
+/* Number of channels processed in lockstep by iir_df2t_block_nch() */
+#define IIR_DF2T_LANES 4
+
 struct iir_state_df2t {
 	unsigned int biquads; /* Number of IIR 2nd order sections total */
 	unsigned int biquads_in_series; /* Number of IIR 2nd order sections
@@ -60,4 +64,25 @@ struct iir_state_df2t {
 
 int32_t iir_df2t(struct iir_state_df2t *iir, int32_t x);
 
+/* Filter frames samples from x to y, the samples are stride apart in
+ * both. The in-place operation with x equal to y is allowed.
+ */
+void iir_df2t_block(struct iir_state_df2t *iir, const int32_t *x, int32_t *y,
+		    int frames, int stride);
+
+/* Filter frames of nch interleaved channels with filters iir[0..nch - 1].
+ * Adjacent channels with the same number of biquads and biquads in
+ * series are processed in lockstep. The in-place operation is allowed.
+ */
+void iir_df2t_block_nch(struct iir_state_df2t iir[], const int32_t *x,
+			int32_t *y, int frames, int nch);
+
+#if SOF_X86_SIMD
+/* AVX2 version of one biquad for IIR_DF2T_LANES lanes of interleaved
+ * samples in buf, used by the lockstep processing.
+ */
+void iir_df2t_biquad_lanes_avx2(int32_t *coefp[], int64_t *delayp[],
+				int32_t *buf, int frames);
+#endif
+
 #endif /* __SOF_MATH_IIR_DF2T_H__ */
@@ -0,0 +1,34 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2020 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __SOF_MATH_X86_SIMD_H__
+#define __SOF_MATH_X86_SIMD_H__
+
+/* The x86 SIMD processing kernels are built into x86-64 host library
+ * builds with GCC compatible compilers. The kernels are compiled for their
+ * instruction set with the target attribute, so the rest of the library
+ * stays runnable on any x86 CPU, and the callers select them at run time
+ * from the CPU features.
+ */
+#if CONFIG_LIBRARY && defined(__x86_64__) && defined(__GNUC__)
+#define SOF_X86_SIMD	1
+#else
+#define SOF_X86_SIMD	0
+#endif
+
+#if SOF_X86_SIMD
+
+#include <stdbool.h>
+
+#define X86_TARGET_AVX2	__attribute__((target("avx2")))
+
+static inline bool x86_has_avx2(void)
+{
+	return __builtin_cpu_supports("avx2");
+}
+
+#endif /* SOF_X86_SIMD */
+
+#endif /* __SOF_MATH_X86_SIMD_H__ */
@@ -0,0 +1,144 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright(c) 2020 Intel Corporation. All rights reserved.
+ */
+
+#ifndef __SOF_PAIRING_HEAP_H__
+#define __SOF_PAIRING_HEAP_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Intrusive min-heap of items ordered by a 64 bit key. Insertion is O(1),
+ * removal of the first or of any other item is O(log n) amortized, and no
+ * memory is allocated. Items with equal keys leave in unspecified order.
+ */
+
+struct pheap_item {
+	uint64_t key;
+	struct pheap_item *child;	/* first child */
+	struct pheap_item *next;	/* next sibling */
+	struct pheap_item *prev;	/* previous sibling or parent */
+};
+
+struct pheap {
+	struct pheap_item *root;
+};
+
+static inline void pheap_init(struct pheap *heap)
+{
+	heap->root = NULL;
+}
+
+static inline int pheap_is_empty(const struct pheap *heap)
+{
+	return !heap->root;
+}
+
+/* item with the lowest key, NULL if the heap is empty */
+static inline struct pheap_item *pheap_first(const struct pheap *heap)
+{
+	return heap->root;
+}
+
+/* joins two roots, the one with higher key becomes first child */
+static inline struct pheap_item *pheap_link(struct pheap_item *a,
+					    struct pheap_item *b)
+{
+	struct pheap_item *tmp;
+
+	if (b->key < a->key) {
+		tmp = a;
+		a = b;
+		b = tmp;
+	}
+
+	b->prev = a;
+	b->next = a->child;
+	if (a->child)
+		a->child->prev = b;
+	a->child = b;
+
+	a->next = NULL;
+	a->prev = NULL;
+
+	return a;
+}
+
+/* joins a list of siblings to a single root, pairs left to right first
+ * and then the pairs right to left
+ */
+static inline struct pheap_item *pheap_merge_pairs(struct pheap_item *first)
+{
+	struct pheap_item *pairs = NULL;
+	struct pheap_item *root;
+	struct pheap_item *next;
+	struct pheap_item *a;
+
+	while (first) {
+		a = first;
+		first = a->next;
+		if (first) {
+			next = first->next;
+			a = pheap_link(a, first);
+			first = next;
+		}
+
+		/* pairs are stacked, so the second pass goes backwards */
+		a->next = pairs;
+		pairs = a;
+	}
+
+	if (!pairs)
+		return NULL;
+
+	root = pairs;
+	pairs = pairs->next;
+	while (pairs) {
+		next = pairs->next;
+		root = pheap_link(root, pairs);
+		pairs = next;
+	}
+
+	root->next = NULL;
+	root->prev = NULL;
+
+	return root;
+}
+
+/* adds item with the key set by the caller */
+static inline void pheap_insert(struct pheap *heap, struct pheap_item *item)
+{
+	item->child = NULL;
+	item->next = NULL;
+	item->prev = NULL;
+
+	heap->root = heap->root ? pheap_link(heap->root, item) : item;
+}
+
+/* removes item, which has to be in the heap */
+static inline void pheap_del(struct pheap *heap, struct pheap_item *item)
+{
+	struct pheap_item *sub = pheap_merge_pairs(item->child);
+
+	if (item == heap->root) {
+		heap->root = sub;
+	} else {
+		/* unlink from siblings, prev of the first child is parent */
+		if (item->prev->child == item)
+			item->prev->child = item->next;
+		else
+			item->prev->next = item->next;
+		if (item->next)
+			item->next->prev = item->prev;
+
+		if (sub)
+			heap->root = pheap_link(heap->root, sub);
+	}
+
+	item->child = NULL;
+	item->next = NULL;
+	item->prev = NULL;
+}
+
+#endif /* __SOF_PAIRING_HEAP_H__ */
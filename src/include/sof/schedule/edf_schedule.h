@@ -8,6 +8,7 @@
 #ifndef __SOF_SCHEDULE_EDF_SCHEDULE_H__
 #define __SOF_SCHEDULE_EDF_SCHEDULE_H__
 
+#include <sof/pairing_heap.h>
 #include <sof/schedule/task.h>
 #include <sof/trace/trace.h>
 #include <user/trace.h>
@@ -20,6 +21,8 @@
 
 struct edf_task_pdata {
 	void *ctx;
+	struct task *task;
+	struct pheap_item item;	/* keyed by deadline in the run queue */
 };
 
 int scheduler_init_edf(void);
@@ -50,6 +50,7 @@ struct ll_schedule_domain {
 	int type;			/**< domain type */
 	int clk;			/**< source clock */
 	bool synchronous;		/**< are tasks should be synchronous */
+	bool pending_at_start;		/**< task is pending once started */
 	void *priv_data;		/**< pointer to private data */
 	bool registered[PLATFORM_CORE_COUNT];		/**< registered cores */
 	bool enabled[PLATFORM_CORE_COUNT];		/**< enabled cores */
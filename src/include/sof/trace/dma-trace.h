@@ -8,7 +8,9 @@
 #ifndef __SOF_TRACE_DMA_TRACE_H__
 #define __SOF_TRACE_DMA_TRACE_H__
 
+#include <sof/compiler_attributes.h>
 #include <sof/lib/dma.h>
+#include <sof/lib/memory.h>
 #include <sof/schedule/task.h>
 #include <sof/sof.h>
 #include <sof/spinlock.h>
@@ -27,6 +29,23 @@ struct dma_trace_buf {
 	uint32_t avail;		/* avail bytes in buffer */
 };
 
+/* per core trace ring size in bytes */
+#define DMA_TRACE_RING_SIZE	(DMA_TRACE_LOCAL_SIZE / 2)
+
+/* Trace records of one core, written only by that core and merged into
+ * the DMA buffer by trace_work(). The producer and consumer offsets are
+ * in separate cache lines, so neither side writes back the other's.
+ */
+struct dma_trace_ring {
+	char *addr;		/* record area of DMA_TRACE_RING_SIZE bytes */
+	uint32_t w_off;		/* producer offset */
+	uint32_t dropped;	/* records lost to a full ring */
+
+	/* consumer side, from the next cache line */
+	__aligned(PLATFORM_DCACHE_ALIGN) uint32_t r_off;
+	uint32_t reported;	/* dropped records already reported */
+} __aligned(PLATFORM_DCACHE_ALIGN);
+
 struct dma_trace_data {
 	struct dma_sg_config config;
 	struct dma_trace_buf dmatb;
@@ -42,7 +61,7 @@ struct dma_trace_data {
 	uint32_t dma_copy_align; /**< Minimal chunk of data possible to be
 				   *  copied by dma connected to host
 				   */
-	uint32_t dropped_entries; /* amount of dropped entries */
+	struct dma_trace_ring *rings; /* per core trace rings */
 	spinlock_t lock; /* dma trace lock */
 };
 
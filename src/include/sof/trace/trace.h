@@ -22,6 +22,7 @@
 #include <sof/common.h>
 #include <sof/sof.h>
 #include <sof/trace/preproc.h>
+#include <user/trace.h>
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -87,6 +88,13 @@ static inline struct trace *trace_get(void)
 #define trace_unused(class, ctx, id_1, id_2, format, ...) \
 	UNUSED(ctx, id_1, id_2, ##__VA_ARGS__)
 
+/* trace calls of levels above this one are compiled out */
+#if CONFIG_TRACE_MAX_LEVEL
+#define TRACE_MAX_LEVEL CONFIG_TRACE_MAX_LEVEL
+#else
+#define TRACE_MAX_LEVEL LOG_LEVEL_VERBOSE
+#endif
+
 struct trace_filter {
 	uint32_t uuid_id;	/**< type id, or 0 when not important */
 	int32_t comp_id;	/**< component id or -1 when not important */
@@ -115,6 +123,7 @@ struct trace_filter {
  * image size. This way more elaborate log messages are possible and encouraged,
  * for better debugging experience, without worrying about runtime performance.
  */
+#if TRACE_MAX_LEVEL >= LOG_LEVEL_INFO
 #define trace_event_with_ids(class, ctx, id_1, id_2, format, ...)	\
 	_trace_event_with_ids(LOG_LEVEL_INFO, class, ctx, id_1, id_2,	\
 			      format, ##__VA_ARGS__)
@@ -122,7 +131,14 @@ struct trace_filter {
 #define trace_event_atomic_with_ids(class, ctx, id_1, id_2, format, ...)     \
 	_trace_event_atomic_with_ids(LOG_LEVEL_INFO, class, ctx, id_1, id_2, \
 				     format, ##__VA_ARGS__)
+#else /* TRACE_MAX_LEVEL >= LOG_LEVEL_INFO */
+#define trace_event_with_ids(class, ctx, id_1, id_2, format, ...)	\
+	trace_unused(class, ctx, id_1, id_2, format, ##__VA_ARGS__)
+#define trace_event_atomic_with_ids(class, ctx, id_1, id_2, format, ...) \
+	trace_unused(class, ctx, id_1, id_2, format, ##__VA_ARGS__)
+#endif /* TRACE_MAX_LEVEL >= LOG_LEVEL_INFO */
 
+#if TRACE_MAX_LEVEL >= LOG_LEVEL_WARNING
 #define trace_warn_with_ids(class, ctx, id_1, id_2, format, ...)	 \
 	_trace_event_with_ids(LOG_LEVEL_WARNING, class, ctx, id_1, id_2, \
 			      format, ##__VA_ARGS__)
@@ -131,6 +147,12 @@ struct trace_filter {
 	_trace_event_atomic_with_ids(LOG_LEVEL_WARNING, class,		\
 				     ctx, id_1, id_2,			\
 				     format, ##__VA_ARGS__)
+#else /* TRACE_MAX_LEVEL >= LOG_LEVEL_WARNING */
+#define trace_warn_with_ids(class, ctx, id_1, id_2, format, ...)	\
+	trace_unused(class, ctx, id_1, id_2, format, ##__VA_ARGS__)
+#define trace_warn_atomic_with_ids(class, ctx, id_1, id_2, format, ...)	\
+	trace_unused(class, ctx, id_1, id_2, format, ##__VA_ARGS__)
+#endif /* TRACE_MAX_LEVEL >= LOG_LEVEL_WARNING */
 
 void trace_flush(void);
 void trace_on(void);
@@ -250,7 +272,7 @@ static inline int trace_filter_update(const struct trace_filter *filter)
 #endif /* CONFIG_TRACE */
 
 /* verbose tracing */
-#if CONFIG_TRACEV
+#if CONFIG_TRACEV && TRACE_MAX_LEVEL >= LOG_LEVEL_VERBOSE
 #define tracev_event_with_ids(class, ctx, id_1, id_2, format, ...)	\
 	_trace_event_with_ids(LOG_LEVEL_VERBOSE, class,			\
 			      ctx, id_1, id_2,				\
@@ -267,7 +289,7 @@ static inline int trace_filter_update(const struct trace_filter *filter)
 #define tracev_event_atomic_with_ids(class, ctx, id_1, id_2, format, ...) \
 	trace_unused(class, ctx, id_1, id_2, format, ##__VA_ARGS__)
 
-#endif /* CONFIG_TRACEV */
+#endif /* CONFIG_TRACEV && TRACE_MAX_LEVEL >= LOG_LEVEL_VERBOSE */
 
 /* error tracing */
 #if CONFIG_TRACEE
@@ -278,9 +300,13 @@ static inline int trace_filter_update(const struct trace_filter *filter)
 	_trace_error_with_ids(class, ctx, id_1, id_2, format, ##__VA_ARGS__)
 #define trace_error_atomic_with_ids(...) trace_error_with_ids(__VA_ARGS__)
 #elif CONFIG_TRACE
-#define trace_error_with_ids(...) trace_event_with_ids(__VA_ARGS__)
-#define trace_error_atomic_with_ids(...) \
-	trace_event_atomic_with_ids(__VA_ARGS__)
+/* kept when info level is compiled out */
+#define trace_error_with_ids(class, ctx, id_1, id_2, format, ...)	\
+	_trace_event_with_ids(LOG_LEVEL_INFO, class, ctx, id_1, id_2,	\
+			      format, ##__VA_ARGS__)
+#define trace_error_atomic_with_ids(class, ctx, id_1, id_2, format, ...) \
+	_trace_event_atomic_with_ids(LOG_LEVEL_INFO, class, ctx, id_1, id_2, \
+				     format, ##__VA_ARGS__)
 #else /* CONFIG_TRACEE CONFIG_TRACE */
 #define trace_error_with_ids(class, ctx, id_1, id_2, format, ...)	\
 	trace_unused(class, ctx, id_1, id_2, format, ##__VA_ARGS__)
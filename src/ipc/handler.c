@@ -614,6 +614,7 @@ static int ipc_pm_context_restore(uint32_t header)
 static int ipc_pm_core_enable(uint32_t header)
 {
 	struct sof_ipc_pm_core_config pm_core_config;
+	int busy = 0;
 	int ret = 0;
 	int i = 0;
 
@@ -624,15 +625,28 @@ static int ipc_pm_core_enable(uint32_t header)
 		pm_core_config.enable_mask);
 
 	for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
-		if (i != PLATFORM_PRIMARY_CORE_ID) {
-			if (pm_core_config.enable_mask & (1 << i))
-				ret = cpu_enable_core(i);
-			else
-				cpu_disable_core(i);
+		if (i == PLATFORM_PRIMARY_CORE_ID)
+			continue;
+
+		if (pm_core_config.enable_mask & (1 << i)) {
+			ret = cpu_enable_core(i);
+			continue;
 		}
+
+#if CONFIG_PIPELINE_PARTITION
+		/* components moved there by the firmware still run */
+		if (pipeline_partition_core_busy(i)) {
+			tr_err(&ipc_tr, "ipc: pm core %d busy with partitioned pipeline",
+			       i);
+			busy = -EBUSY;
+			continue;
+		}
+#endif
+
+		cpu_disable_core(i);
 	}
 
-	return ret;
+	return ret < 0 ? ret : busy;
 }
 
 static int ipc_pm_gate(uint32_t header)
@@ -122,6 +122,23 @@ static void write_pattern(struct mm_heap *heap_map, int heap_depth,
 }
 #endif
 
+/* all blocks are free at boot */
+static void init_free_map(struct block_map *map)
+{
+	unsigned int words = BLOCK_MAP_WORDS(map->count);
+	unsigned int i;
+
+	for (i = 0; i < words; i++)
+		map->free_map[i] = UINT32_MAX;
+
+	/* blocks past the end of the map are never free */
+	if (map->count % BLOCK_MAP_WORD_BITS)
+		map->free_map[words - 1] = ~(UINT32_MAX >>
+					     (map->count % BLOCK_MAP_WORD_BITS));
+
+	platform_shared_commit(map->free_map, words * sizeof(*map->free_map));
+}
+
 static void init_heap_map(struct mm_heap *heap, int count)
 {
 	struct block_map *next_map;
@@ -133,6 +150,7 @@ static void init_heap_map(struct mm_heap *heap, int count)
 		/* init the map[0] */
 		current_map = &heap[i].map[0];
 		current_map->base = heap[i].heap;
+		init_free_map(current_map);
 		platform_shared_commit(current_map, sizeof(*current_map));
 
 		/* map[j]'s base is calculated based on map[j-1] */
@@ -141,6 +159,7 @@ static void init_heap_map(struct mm_heap *heap, int count)
 			next_map->base = current_map->base +
 				current_map->block_size *
 				current_map->count;
+			init_free_map(next_map);
 			platform_shared_commit(next_map, sizeof(*next_map));
 			platform_shared_commit(current_map,
 					       sizeof(*current_map));
@@ -211,6 +230,61 @@ static void *align_ptr(struct mm_heap *heap, uint32_t alignment,
 	return (char *)ptr + mod_align;
 }
 
+/*
+ * Returns first block at or after start that is free (or used, when free is
+ * false) or map->count if there is none. Whole words are skipped and clz
+ * finds the block within a word, so the cost does not depend on occupancy.
+ */
+static unsigned int block_map_find(struct block_map *map, unsigned int start,
+				   bool free)
+{
+	unsigned int words = BLOCK_MAP_WORDS(map->count);
+	unsigned int word = start / BLOCK_MAP_WORD_BITS;
+	uint32_t bits;
+
+	if (start >= map->count)
+		return map->count;
+
+	/* ignore blocks before start in the first word */
+	bits = free ? map->free_map[word] : ~map->free_map[word];
+	bits &= UINT32_MAX >> (start % BLOCK_MAP_WORD_BITS);
+
+	while (!bits) {
+		if (++word == words)
+			return map->count;
+
+		bits = free ? map->free_map[word] : ~map->free_map[word];
+	}
+
+	return MIN(word * BLOCK_MAP_WORD_BITS + clz(bits), map->count);
+}
+
+/* mark count blocks from start as free or used */
+static void block_map_set(struct block_map *map, unsigned int start,
+			  unsigned int count, bool free)
+{
+	unsigned int word = start / BLOCK_MAP_WORD_BITS;
+	unsigned int bit = start % BLOCK_MAP_WORD_BITS;
+	unsigned int n;
+	uint32_t mask;
+
+	while (count) {
+		n = MIN(count, BLOCK_MAP_WORD_BITS - bit);
+		mask = UINT32_MAX >> bit;
+		if (bit + n < BLOCK_MAP_WORD_BITS)
+			mask &= ~(UINT32_MAX >> (bit + n));
+
+		if (free)
+			map->free_map[word] |= mask;
+		else
+			map->free_map[word] &= ~mask;
+
+		count -= n;
+		bit = 0;
+		word++;
+	}
+}
+
 /* allocate single block */
 static void *alloc_block(struct mm_heap *heap, int level,
 			 uint32_t caps, uint32_t alignment)
@@ -218,7 +292,6 @@ static void *alloc_block(struct mm_heap *heap, int level,
 	struct block_map *map = &heap->map[level];
 	struct block_hdr *hdr;
 	void *ptr;
-	int i;
 
 	hdr = &map->block[map->first_free];
 
@@ -228,20 +301,16 @@ static void *alloc_block(struct mm_heap *heap, int level,
 
 	hdr->size = 1;
 	hdr->used = 1;
+	block_map_set(map, map->first_free, 1, false);
 
 	heap->info.used += map->block_size;
 	heap->info.free -= map->block_size;
 
 	/* find next free */
-	for (i = map->first_free; i < map->count; ++i) {
-		hdr = &map->block[i];
-
-		if (hdr->used == 0) {
-			map->first_free = i;
-			break;
-		}
-	}
+	map->first_free = block_map_find(map, map->first_free + 1, true);
 
+	platform_shared_commit(map->free_map, sizeof(*map->free_map) *
+			       BLOCK_MAP_WORDS(map->count));
 	platform_shared_commit(map->block, sizeof(*map->block) * map->count);
 	platform_shared_commit(map, sizeof(*map));
 	platform_shared_commit(heap, sizeof(*heap));
@@ -257,26 +326,23 @@ static void *alloc_cont_blocks(struct mm_heap *heap, int level,
 	struct block_hdr *hdr;
 	void *ptr = NULL;
 	void *unaligned_ptr;
-	unsigned int start = map->first_free;
+	unsigned int start;
+	unsigned int end = map->first_free;
 	unsigned int current;
 	unsigned int count = bytes / map->block_size;
-	unsigned int remaining = 0;
+	unsigned int remaining;
 
 	if (bytes % map->block_size)
 		count++;
 
 	/* check if we have enough consecutive blocks for requested
-	 * allocation size.
+	 * allocation size, jumping from one run of free blocks to the next.
 	 */
-	for (current = map->first_free; current < map->count &&
-	     remaining < count; current++) {
-		hdr = &map->block[current];
-
-		if (hdr->used)
-			remaining = 0;/* used, not suitable, reset */
-		else if (!remaining++)
-			start = current;/* new start */
-	}
+	do {
+		start = block_map_find(map, end, true);
+		end = block_map_find(map, start, false);
+		remaining = end - start;
+	} while (start < map->count && remaining < count);
 
 	if (count > map->count || remaining < count) {
 		tr_err(&mem_tr, "%d blocks needed for allocation but only %d blocks are remaining",
@@ -296,16 +362,12 @@ static void *alloc_cont_blocks(struct mm_heap *heap, int level,
 
 	heap->info.used += count * map->block_size;
 	heap->info.free -= count * map->block_size;
+	block_map_set(map, start, count, false);
+
 	/* update first_free if needed */
 	if (map->first_free == start)
 		/* find first available free block */
-		for (map->first_free += count; map->first_free < map->count;
-			map->first_free++) {
-			hdr = &map->block[map->first_free];
-
-			if (!hdr->used)
-				break;
-		}
+		map->first_free = block_map_find(map, start + count, true);
 
 	/* update each block */
 	for (current = start; current < start + count; current++) {
@@ -315,6 +377,8 @@ static void *alloc_cont_blocks(struct mm_heap *heap, int level,
 	}
 
 out:
+	platform_shared_commit(map->free_map, sizeof(*map->free_map) *
+			       BLOCK_MAP_WORDS(map->count));
 	platform_shared_commit(map->block, sizeof(*map->block) * map->count);
 	platform_shared_commit(map, sizeof(*map));
 	platform_shared_commit(heap, sizeof(*heap));
@@ -510,6 +574,8 @@ static void free_block(void *ptr)
 		heap->info.free += block_map->block_size;
 	}
 
+	block_map_set(block_map, block, used_blocks - block, true);
+
 	/* set first free block */
 	if (block < block_map->first_free || heap_is_full)
 		block_map->first_free = block;
@@ -525,6 +591,9 @@ static void free_block(void *ptr)
 		(i - block));
 #endif
 
+	platform_shared_commit(block_map->free_map,
+			       sizeof(*block_map->free_map) *
+			       BLOCK_MAP_WORDS(block_map->count));
 	platform_shared_commit(block_map->block, sizeof(*block_map->block) *
 			       block_map->count);
 	platform_shared_commit(block_map, sizeof(*block_map));
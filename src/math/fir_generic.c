@@ -42,7 +42,10 @@ int fir_delay_size(struct sof_fir_coef_data *config)
 	if (config->length > SOF_FIR_MAX_LENGTH || config->length < 1)
 		return -EINVAL;
 
-	return config->length * sizeof(int32_t);
+	/* The delay line is mirrored, each sample is stored twice with
+	 * length apart so that the taps of any output are contiguous.
+	 */
+	return 2 * config->length * sizeof(int32_t);
 }
 
 int fir_init_coef(struct fir_state_32x16 *fir,
@@ -59,63 +62,196 @@ int fir_init_coef(struct fir_state_32x16 *fir,
 void fir_init_delay(struct fir_state_32x16 *fir, int32_t **data)
 {
 	fir->delay = *data;
-	*data += fir->length; /* Point to next delay line start */
+	*data += 2 * fir->length; /* Point to next delay line start */
+}
+
+/* Write sample to both halves of the delay line and return pointer to
+ * the newest sample in the upper half. The length taps preceding it are
+ * then in linear order without circular wrap.
+ */
+static inline int32_t *fir_delay_write(struct fir_state_32x16 *fir, int32_t x)
+{
+	int32_t *data = &fir->delay[fir->rwi];
+
+	data[0] = x;
+	data[fir->length] = x;
+	return data + fir->length;
+}
+
+static inline void fir_delay_advance(struct fir_state_32x16 *fir, int n)
+{
+	fir->rwi += n;
+	if (fir->rwi == fir->length)
+		fir->rwi = 0;
 }
 
 int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x)
 {
 	int64_t y = 0;
-	int32_t *data = &fir->delay[fir->rwi];
+	int32_t *data;
 	int16_t *coef = &fir->coef[0];
-	int n1;
-	int n2;
 	int n;
 
 	/* Bypass is set with length set to zero. */
 	if (!fir->length)
 		return x;
 
-	/* Write sample to delay */
-	*data = x;
+	data = fir_delay_write(fir, x);
+	fir_delay_advance(fir, 1);
 
-	/* Advance write pointer and calculate into n1 max. number of taps
-	 * to process before circular wrap.
+	/* Data is Q1.31, coef is Q1.15, product is Q2.46 */
+	for (n = 0; n < fir->length; n++) {
+		y += (int64_t)(*coef) * (*data);
+		coef++;
+		data--;
+	}
+
+	/* Q2.46 -> Q2.31, saturate to Q1.31 */
+	return sat_int32(y >> (15 + fir->out_shift));
+}
+
+void fir_32x16_2x(struct fir_state_32x16 *fir, int32_t x0, int32_t x1,
+		  int32_t *y0, int32_t *y1)
+{
+	int64_t a0 = 0;
+	int64_t a1 = 0;
+	int32_t *data;
+	int16_t *coef = &fir->coef[0];
+	int32_t d0;
+	int32_t d1;
+	int c;
+	int n;
+
+	/* Both samples must fit before the delay line index wraps, the
+	 * single sample version handles the crossing.
 	 */
-	n1 = ++fir->rwi;
-	if (fir->rwi == fir->length)
-		fir->rwi = 0;
+	if (fir->rwi + 2 > fir->length) {
+		*y0 = fir_32x16(fir, x0);
+		*y1 = fir_32x16(fir, x1);
+		return;
+	}
 
-	/* Check if no need to un-wrap FIR data. */
-	if (n1 > fir->length) {
-		/* Data is Q1.31, coef is Q1.15, product is Q2.46 */
-		for (n = 0; n < fir->length; n++) {
-			y += (int64_t)(*coef) * (*data);
-			coef++;
-			data--;
-		}
+	/* Write the samples to the upper half of delay line first, the
+	 * lower half copy of x1 would overwrite the oldest tap of y0.
+	 */
+	data = &fir->delay[fir->rwi + fir->length];
+	data[0] = x0;
+	data[1] = x1;
 
-		/* Q2.46 -> Q2.31, saturate to Q1.31 */
-		return sat_int32(y >> (15 + fir->out_shift));
+	/* The tap data of the second output is the data of the first
+	 * output from previous round so each coefficient and data sample
+	 * is loaded once for the two outputs.
+	 */
+	d1 = x1;
+	for (n = 0; n < fir->length; n++) {
+		c = *coef++;
+		d0 = *data--;
+		a0 += (int64_t)c * d0;
+		a1 += (int64_t)c * d1;
+		d1 = d0;
 	}
 
-	/* Part 1, loop n1 times */
-	for (n = 0; n < n1; n++) {
-		y += (int64_t)(*coef) * (*data);
-		coef++;
-		data--;
+	fir->delay[fir->rwi] = x0;
+	fir->delay[fir->rwi + 1] = x1;
+	fir_delay_advance(fir, 2);
+
+	*y0 = sat_int32(a0 >> (15 + fir->out_shift));
+	*y1 = sat_int32(a1 >> (15 + fir->out_shift));
+}
+
+/* Process four samples, the write index must not wrap within them. */
+static void fir_32x16_4x(struct fir_state_32x16 *fir, const int32_t *x,
+			 int32_t *y, int stride)
+{
+	int64_t a0 = 0;
+	int64_t a1 = 0;
+	int64_t a2 = 0;
+	int64_t a3 = 0;
+	int32_t *data;
+	int16_t *coef = &fir->coef[0];
+	const int shift = 15 + fir->out_shift;
+	int32_t d0;
+	int32_t d1;
+	int32_t d2;
+	int32_t d3;
+	int c;
+	int n;
+
+	/* Write the four samples to the upper half of delay line. The
+	 * lower half copies would overwrite the oldest taps of the first
+	 * outputs so they are written after the MAC loop.
+	 */
+	data = &fir->delay[fir->rwi + fir->length];
+	for (n = 0; n < 4; n++)
+		data[n] = x[n * stride];
+
+	d1 = data[1];
+	d2 = data[2];
+	d3 = data[3];
+	for (n = 0; n < fir->length; n++) {
+		c = *coef++;
+		d0 = *data--;
+		a0 += (int64_t)c * d0;
+		a1 += (int64_t)c * d1;
+		a2 += (int64_t)c * d2;
+		a3 += (int64_t)c * d3;
+		d3 = d2;
+		d2 = d1;
+		d1 = d0;
 	}
 
-	/* Part 2, un-wrap data, continue n2 times */
-	n2 = fir->length - n1;
-	data = &fir->delay[fir->length - 1];
-	for (n = 0; n < n2; n++) {
-		y += (int64_t)(*coef) * (*data);
-		coef++;
-		data--;
+	data = &fir->delay[fir->rwi];
+	for (n = 0; n < 4; n++)
+		data[n] = data[n + fir->length];
+
+	y[0] = sat_int32(a0 >> shift);
+	y[stride] = sat_int32(a1 >> shift);
+	y[2 * stride] = sat_int32(a2 >> shift);
+	y[3 * stride] = sat_int32(a3 >> shift);
+}
+
+void fir_32x16_block(struct fir_state_32x16 *fir, const int32_t *x,
+		     int32_t *y, int frames, int stride)
+{
+	void (*fir_4x)(struct fir_state_32x16 *fir, const int32_t *x,
+		       int32_t *y, int stride) = fir_32x16_4x;
+	int i;
+
+	/* Bypass is set with length set to zero. */
+	if (!fir->length) {
+		if (x != y) {
+			for (i = 0; i < frames; i++)
+				y[i * stride] = x[i * stride];
+		}
+		return;
 	}
 
-	/* Q2.46 -> Q2.31, saturate to Q1.31 */
-	return sat_int32(y >> (15 + fir->out_shift));
+#if SOF_X86_SIMD
+	if (x86_has_avx2())
+		fir_4x = fir_32x16_4x_avx2;
+#endif
+
+	while (frames >= 4) {
+		if (fir->rwi + 4 <= fir->length) {
+			fir_4x(fir, x, y, stride);
+			fir_delay_advance(fir, 4);
+			x += 4 * stride;
+			y += 4 * stride;
+			frames -= 4;
+		} else {
+			/* Step single samples over the delay line wrap */
+			*y = fir_32x16(fir, *x);
+			x += stride;
+			y += stride;
+			frames--;
+		}
+	}
+
+	for (i = 0; i < frames; i++) {
+		*y = fir_32x16(fir, *x);
+		x += stride;
+		y += stride;
+	}
 }
 
 #endif
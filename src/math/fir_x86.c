@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+#include <sof/math/fir_config.h>
+
+#if FIR_GENERIC
+
+#include <sof/math/x86_simd.h>
+
+#if SOF_X86_SIMD
+
+#include <sof/audio/format.h>
+#include <sof/math/fir_generic.h>
+#include <immintrin.h>
+#include <stdint.h>
+
+/*
+ * EQ FIR x86 AVX2 code for the host library
+ */
+
+/* Multiply four taps of four outputs. The data is loaded in ascending
+ * delay line order so the coefficients are reversed to match.
+ */
+static inline X86_TARGET_AVX2 __m256i fir_avx2_mac(__m256i acc, __m256i c,
+						   const int32_t *data)
+{
+	__m256i d = _mm256_cvtepi32_epi64
+		(_mm_loadu_si128((const __m128i *)data));
+
+	return _mm256_add_epi64(acc, _mm256_mul_epi32(c, d));
+}
+
+static inline X86_TARGET_AVX2 int64_t fir_avx2_hsum(__m256i acc)
+{
+	__m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc),
+				  _mm256_extracti128_si256(acc, 1));
+
+	return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+}
+
+/* Process four samples, the write index must not wrap within them. The
+ * delay line handling is the same as in the generic fir_32x16_4x().
+ */
+X86_TARGET_AVX2 void fir_32x16_4x_avx2(struct fir_state_32x16 *fir,
+				       const int32_t *x, int32_t *y,
+				       int stride)
+{
+	__m256i acc0 = _mm256_setzero_si256();
+	__m256i acc1 = _mm256_setzero_si256();
+	__m256i acc2 = _mm256_setzero_si256();
+	__m256i acc3 = _mm256_setzero_si256();
+	__m256i c;
+	int64_t a[4];
+	int32_t *data = &fir->delay[fir->rwi + fir->length];
+	int16_t *coef = &fir->coef[0];
+	const int shift = 15 + fir->out_shift;
+	const int taps4 = fir->length & ~3;
+	int j;
+	int n;
+
+	for (j = 0; j < 4; j++)
+		data[j] = x[j * stride];
+
+	/* Data is Q1.31, coef is Q1.15, product is Q2.46 */
+	for (n = 0; n < taps4; n += 4) {
+		c = _mm256_cvtepi16_epi64
+			(_mm_loadl_epi64((const __m128i *)&coef[n]));
+		c = _mm256_permute4x64_epi64(c, 0x1b);
+		acc0 = fir_avx2_mac(acc0, c, data - n - 3);
+		acc1 = fir_avx2_mac(acc1, c, data - n - 2);
+		acc2 = fir_avx2_mac(acc2, c, data - n - 1);
+		acc3 = fir_avx2_mac(acc3, c, data - n);
+	}
+
+	a[0] = fir_avx2_hsum(acc0);
+	a[1] = fir_avx2_hsum(acc1);
+	a[2] = fir_avx2_hsum(acc2);
+	a[3] = fir_avx2_hsum(acc3);
+	for (; n < fir->length; n++) {
+		for (j = 0; j < 4; j++)
+			a[j] += (int64_t)coef[n] * data[j - n];
+	}
+
+	/* The lower half copies are written after the MAC, they would
+	 * overwrite the oldest taps of the first outputs.
+	 */
+	data = &fir->delay[fir->rwi];
+	for (j = 0; j < 4; j++)
+		data[j] = data[j + fir->length];
+
+	/* Q2.46 -> Q2.31, saturate to Q1.31 */
+	for (j = 0; j < 4; j++)
+		y[j * stride] = sat_int32(a[j] >> shift);
+}
+
+#endif /* SOF_X86_SIMD */
+
+#endif
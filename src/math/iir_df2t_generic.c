@@ -8,6 +8,7 @@
 
 #include <sof/audio/format.h>
 #include <sof/math/iir_df2t.h>
+#include <sof/math/numbers.h>
 #include <user/eq.h>
 #include <errno.h>
 #include <stddef.h>
@@ -104,4 +105,203 @@ int32_t iir_df2t(struct iir_state_df2t *iir, int32_t x)
 	return out;
 }
 
+/* Block processing DF2T IIR
+ *
+ * The block versions run each biquad over a chunk of frames before
+ * proceeding to the next one, so the coefficients and state of the
+ * biquad stay in local variables for the whole chunk. Channels with the
+ * same cascade layout are processed in lanes of IIR_DF2T_LANES
+ * channels that run in lockstep over the interleaved samples.
+ */
+
+/* Frames in the chunk buffers */
+#define IIR_DF2T_BLOCK_FRAMES	16
+
+/* Dummy filter for unused lanes, zero coefficients produce zero output */
+static int32_t iir_df2t_zero_coef[SOF_EQ_IIR_NBIQUAD_DF2T];
+
+static inline void iir_df2t_biquad_lanes(int32_t *coefp[], int64_t *delayp[],
+					 int32_t *buf, int frames,
+					 const int lanes)
+{
+	int64_t d0[IIR_DF2T_LANES];
+	int64_t d1[IIR_DF2T_LANES];
+	int32_t a2[IIR_DF2T_LANES];
+	int32_t a1[IIR_DF2T_LANES];
+	int32_t b2[IIR_DF2T_LANES];
+	int32_t b1[IIR_DF2T_LANES];
+	int32_t b0[IIR_DF2T_LANES];
+	int32_t shift[IIR_DF2T_LANES];
+	int32_t gain[IIR_DF2T_LANES];
+	int64_t acc;
+	int32_t in;
+	int32_t tmp;
+	int i;
+	int l;
+
+	/* Coefficients order in coef[] is {a2, a1, b2, b1, b0, shift, gain} */
+	for (l = 0; l < lanes; l++) {
+		a2[l] = coefp[l][0];
+		a1[l] = coefp[l][1];
+		b2[l] = coefp[l][2];
+		b1[l] = coefp[l][3];
+		b0[l] = coefp[l][4];
+		shift[l] = coefp[l][5];
+		gain[l] = coefp[l][6];
+		d0[l] = delayp[l][0];
+		d1[l] = delayp[l][1];
+	}
+
+	/* Same arithmetic as in iir_df2t() */
+	for (i = 0; i < frames; i++) {
+		for (l = 0; l < lanes; l++) {
+			in = buf[l];
+			acc = (int64_t)b0[l] * in + d0[l];
+			tmp = (int32_t)Q_SHIFT_RND(acc, 61, 31);
+			d0[l] = d1[l] + (int64_t)b1[l] * in +
+				(int64_t)a1[l] * tmp;
+			d1[l] = (int64_t)b2[l] * in + (int64_t)a2[l] * tmp;
+			acc = (int64_t)gain[l] * tmp;
+			acc = Q_SHIFT_RND(acc, 45 + shift[l], 31);
+			buf[l] = sat_int32(acc);
+		}
+		buf += lanes;
+	}
+
+	for (l = 0; l < lanes; l++) {
+		delayp[l][0] = d0[l];
+		delayp[l][1] = d1[l];
+	}
+}
+
+/* Filter frames of active channels x[0..active - 1] with stride apart
+ * frames using lanes wide processing. The filters must have equal
+ * number of biquads and biquads in series.
+ */
+static inline void iir_df2t_run(struct iir_state_df2t *iir[],
+				const int32_t *x, int32_t *y, int frames,
+				int stride, int active, const int lanes)
+{
+	int32_t buf[IIR_DF2T_BLOCK_FRAMES * IIR_DF2T_LANES];
+	int32_t out[IIR_DF2T_BLOCK_FRAMES * IIR_DF2T_LANES];
+	int64_t dummy_delay[IIR_DF2T_NUM_DELAYS] = { 0 };
+	int32_t *coefp[IIR_DF2T_LANES];
+	int64_t *delayp[IIR_DF2T_LANES];
+	int32_t *res;
+	int biquads = iir[0]->biquads;
+	int nseries = iir[0]->biquads_in_series;
+#if SOF_X86_SIMD
+	const bool avx2 = lanes == IIR_DF2T_LANES && x86_has_avx2();
+#endif
+	int i;
+	int j;
+	int k;
+	int l;
+	int n;
+
+	while (frames) {
+		n = MIN(frames, IIR_DF2T_BLOCK_FRAMES);
+
+		for (i = 0; i < n; i++) {
+			for (l = 0; l < lanes; l++)
+				buf[i * lanes + l] = l < active ?
+					x[i * stride + l] : 0;
+		}
+
+		/* With a single section its output is the filter output,
+		 * otherwise the outputs of sections are summed to out[].
+		 */
+		res = biquads == nseries ? buf : out;
+		for (j = 0; j < biquads; j += nseries) {
+			for (k = j; k < j + nseries; k++) {
+				for (l = 0; l < lanes; l++) {
+					if (l < active) {
+						coefp[l] = iir[l]->coef +
+							k * SOF_EQ_IIR_NBIQUAD_DF2T;
+						delayp[l] = iir[l]->delay +
+							k * IIR_DF2T_NUM_DELAYS;
+					} else {
+						coefp[l] = iir_df2t_zero_coef;
+						delayp[l] = dummy_delay;
+					}
+				}
+#if SOF_X86_SIMD
+				if (avx2) {
+					iir_df2t_biquad_lanes_avx2(coefp,
+								   delayp,
+								   buf, n);
+					continue;
+				}
+#endif
+				iir_df2t_biquad_lanes(coefp, delayp, buf, n,
+						      lanes);
+			}
+
+			if (res == buf)
+				break;
+
+			for (i = 0; i < n * lanes; i++)
+				out[i] = j ? sat_int32((int64_t)out[i] + buf[i]) :
+					buf[i];
+		}
+
+		for (i = 0; i < n; i++) {
+			for (l = 0; l < active; l++)
+				y[i * stride + l] = res[i * lanes + l];
+		}
+
+		frames -= n;
+		x += n * stride;
+		y += n * stride;
+	}
+}
+
+void iir_df2t_block(struct iir_state_df2t *iir, const int32_t *x, int32_t *y,
+		    int frames, int stride)
+{
+	int i;
+
+	/* Bypass is set with number of biquads set to zero. */
+	if (!iir->biquads) {
+		if (x != y) {
+			for (i = 0; i < frames; i++)
+				y[i * stride] = x[i * stride];
+		}
+		return;
+	}
+
+	iir_df2t_run(&iir, x, y, frames, stride, 1, 1);
+}
+
+void iir_df2t_block_nch(struct iir_state_df2t iir[], const int32_t *x,
+			int32_t *y, int frames, int nch)
+{
+	struct iir_state_df2t *lane[IIR_DF2T_LANES];
+	int ch = 0;
+	int n;
+
+	while (ch < nch) {
+		/* Collect following channels with the same cascade layout
+		 * as this one to lanes.
+		 */
+		lane[0] = &iir[ch];
+		n = 1;
+		while (lane[0]->biquads && n < IIR_DF2T_LANES && ch + n < nch &&
+		       iir[ch + n].biquads == lane[0]->biquads &&
+		       iir[ch + n].biquads_in_series ==
+		       lane[0]->biquads_in_series) {
+			lane[n] = &iir[ch + n];
+			n++;
+		}
+
+		if (n > 1)
+			iir_df2t_run(lane, x + ch, y + ch, frames, nch, n,
+				     IIR_DF2T_LANES);
+		else
+			iir_df2t_block(&iir[ch], x + ch, y + ch, frames, nch);
+
+		ch += n;
+	}
+}
+
 #endif
@@ -131,4 +131,25 @@ int32_t iir_df2t(struct iir_state_df2t *iir, int32_t x)
 	return out;
 }
 
+void iir_df2t_block(struct iir_state_df2t *iir, const int32_t *x, int32_t *y,
+		    int frames, int stride)
+{
+	int i;
+
+	for (i = 0; i < frames; i++) {
+		*y = iir_df2t(iir, *x);
+		x += stride;
+		y += stride;
+	}
+}
+
+void iir_df2t_block_nch(struct iir_state_df2t iir[], const int32_t *x,
+			int32_t *y, int frames, int nch)
+{
+	int ch;
+
+	for (ch = 0; ch < nch; ch++)
+		iir_df2t_block(&iir[ch], x + ch, y + ch, frames, nch);
+}
+
 #endif
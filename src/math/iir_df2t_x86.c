@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+#include <sof/math/iir_df2t.h>
+#include <sof/math/x86_simd.h>
+
+#if IIR_GENERIC && SOF_X86_SIMD
+
+#include <user/eq.h>
+#include <immintrin.h>
+#include <stdint.h>
+
+/*
+ * DF2T IIR x86 AVX2 code for the host library
+ *
+ * The IIR_DF2T_LANES lanes are kept in the 64 bit elements of one
+ * vector. The products of 32 bit operands are computed with the signed
+ * 32x32 -> 64 bit multiply that reads the low half of each element.
+ */
+
+/* Load one coefficient of the lanes, sign extended to 64 bits */
+static inline X86_TARGET_AVX2 __m256i iir_avx2_coef(int32_t *coefp[], int i)
+{
+	return _mm256_set_epi64x(coefp[3][i], coefp[2][i], coefp[1][i],
+				 coefp[0][i]);
+}
+
+/* Arithmetic right shift of 64 bit elements with per element amount */
+static inline X86_TARGET_AVX2 __m256i iir_avx2_srav(__m256i x, __m256i s)
+{
+	__m256i m = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+
+	return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(x, m), s),
+				m);
+}
+
+X86_TARGET_AVX2 void iir_df2t_biquad_lanes_avx2(int32_t *coefp[],
+						int64_t *delayp[],
+						int32_t *buf, int frames)
+{
+	const __m256i one = _mm256_set1_epi64x(1);
+	const __m256i max = _mm256_set1_epi64x(((int64_t)1 << 32) - 2);
+	const __m256i min = _mm256_set1_epi64x(-((int64_t)1 << 32) - 1);
+	const __m256i low = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+	int64_t delay0[IIR_DF2T_LANES];
+	int64_t delay1[IIR_DF2T_LANES];
+	__m256i a2;
+	__m256i a1;
+	__m256i b2;
+	__m256i b1;
+	__m256i b0;
+	__m256i shift;
+	__m256i gain;
+	__m256i d0;
+	__m256i d1;
+	__m256i in;
+	__m256i tmp;
+	__m256i acc;
+	int i;
+
+	/* Coefficients order in coef[] is {a2, a1, b2, b1, b0, shift, gain} */
+	a2 = iir_avx2_coef(coefp, 0);
+	a1 = iir_avx2_coef(coefp, 1);
+	b2 = iir_avx2_coef(coefp, 2);
+	b1 = iir_avx2_coef(coefp, 3);
+	b0 = iir_avx2_coef(coefp, 4);
+	shift = _mm256_add_epi64(iir_avx2_coef(coefp, 5),
+				 _mm256_set1_epi64x(45 - 31 - 1));
+	gain = iir_avx2_coef(coefp, 6);
+	d0 = _mm256_set_epi64x(delayp[3][0], delayp[2][0], delayp[1][0],
+			       delayp[0][0]);
+	d1 = _mm256_set_epi64x(delayp[3][1], delayp[2][1], delayp[1][1],
+			       delayp[0][1]);
+
+	/* Same arithmetic as in iir_df2t() */
+	for (i = 0; i < frames; i++) {
+		in = _mm256_cvtepi32_epi64
+			(_mm_loadu_si128((const __m128i *)buf));
+
+		/* Q3.61 to Q3.31 with rounding, only the low 32 bits of
+		 * tmp are used so the shifts need no sign extension.
+		 */
+		acc = _mm256_add_epi64(_mm256_mul_epi32(b0, in), d0);
+		tmp = _mm256_srli_epi64(_mm256_add_epi64
+					(_mm256_srli_epi64(acc, 29), one), 1);
+
+		d0 = _mm256_add_epi64(d1, _mm256_mul_epi32(b1, in));
+		d0 = _mm256_add_epi64(d0, _mm256_mul_epi32(a1, tmp));
+		d1 = _mm256_add_epi64(_mm256_mul_epi32(b2, in),
+				      _mm256_mul_epi32(a2, tmp));
+
+		/* Q3.45 to Q3.31 with the output shift and rounding. The
+		 * saturation to 32 bits is done before the last shift.
+		 */
+		acc = iir_avx2_srav(_mm256_mul_epi32(gain, tmp), shift);
+		acc = _mm256_blendv_epi8(acc, max,
+					 _mm256_cmpgt_epi64(acc, max));
+		acc = _mm256_blendv_epi8(acc, min,
+					 _mm256_cmpgt_epi64(min, acc));
+		acc = _mm256_srli_epi64(_mm256_add_epi64(acc, one), 1);
+		acc = _mm256_permutevar8x32_epi32(acc, low);
+		_mm_storeu_si128((__m128i *)buf, _mm256_castsi256_si128(acc));
+		buf += IIR_DF2T_LANES;
+	}
+
+	_mm256_storeu_si256((__m256i *)delay0, d0);
+	_mm256_storeu_si256((__m256i *)delay1, d1);
+	for (i = 0; i < IIR_DF2T_LANES; i++) {
+		delayp[i][0] = delay0[i];
+		delayp[i][1] = delay1[i];
+	}
+}
+
+#endif
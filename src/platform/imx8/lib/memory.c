@@ -13,44 +13,60 @@
 
 /* Heap blocks for system runtime */
 static SHARED_DATA struct block_hdr sys_rt_block64[HEAP_SYS_RT_COUNT64];
+static SHARED_DATA uint32_t sys_rt_free64[BLOCK_MAP_WORDS(HEAP_SYS_RT_COUNT64)];
 static SHARED_DATA struct block_hdr sys_rt_block512[HEAP_SYS_RT_COUNT512];
+static SHARED_DATA uint32_t
+	sys_rt_free512[BLOCK_MAP_WORDS(HEAP_SYS_RT_COUNT512)];
 static SHARED_DATA struct block_hdr sys_rt_block1024[HEAP_SYS_RT_COUNT1024];
+static SHARED_DATA uint32_t
+	sys_rt_free1024[BLOCK_MAP_WORDS(HEAP_SYS_RT_COUNT1024)];
 
 /* Heap memory for system runtime */
 static SHARED_DATA struct block_map sys_rt_heap_map[] = {
-	BLOCK_DEF(64, HEAP_SYS_RT_COUNT64, sys_rt_block64),
-	BLOCK_DEF(512, HEAP_SYS_RT_COUNT512, sys_rt_block512),
-	BLOCK_DEF(1024, HEAP_SYS_RT_COUNT1024, sys_rt_block1024),
+	BLOCK_DEF(64, HEAP_SYS_RT_COUNT64, sys_rt_block64, sys_rt_free64),
+	BLOCK_DEF(512, HEAP_SYS_RT_COUNT512, sys_rt_block512, sys_rt_free512),
+	BLOCK_DEF(1024, HEAP_SYS_RT_COUNT1024,
+		  sys_rt_block1024, sys_rt_free1024),
 };
 
 /* Heap blocks for modules */
 static SHARED_DATA struct block_hdr mod_block16[HEAP_RT_COUNT16];
+static SHARED_DATA uint32_t mod_free16[BLOCK_MAP_WORDS(HEAP_RT_COUNT16)];
 static SHARED_DATA struct block_hdr mod_block32[HEAP_RT_COUNT32];
+static SHARED_DATA uint32_t mod_free32[BLOCK_MAP_WORDS(HEAP_RT_COUNT32)];
 static SHARED_DATA struct block_hdr mod_block64[HEAP_RT_COUNT64];
+static SHARED_DATA uint32_t mod_free64[BLOCK_MAP_WORDS(HEAP_RT_COUNT64)];
 static SHARED_DATA struct block_hdr mod_block128[HEAP_RT_COUNT128];
+static SHARED_DATA uint32_t mod_free128[BLOCK_MAP_WORDS(HEAP_RT_COUNT128)];
 static SHARED_DATA struct block_hdr mod_block256[HEAP_RT_COUNT256];
+static SHARED_DATA uint32_t mod_free256[BLOCK_MAP_WORDS(HEAP_RT_COUNT256)];
 static SHARED_DATA struct block_hdr mod_block512[HEAP_RT_COUNT512];
+static SHARED_DATA uint32_t mod_free512[BLOCK_MAP_WORDS(HEAP_RT_COUNT512)];
 static SHARED_DATA struct block_hdr mod_block1024[HEAP_RT_COUNT1024];
+static SHARED_DATA uint32_t mod_free1024[BLOCK_MAP_WORDS(HEAP_RT_COUNT1024)];
 static SHARED_DATA struct block_hdr mod_block2048[HEAP_RT_COUNT2048];
+static SHARED_DATA uint32_t mod_free2048[BLOCK_MAP_WORDS(HEAP_RT_COUNT2048)];
 
 /* Heap memory map for modules */
 static SHARED_DATA struct block_map rt_heap_map[] = {
-	BLOCK_DEF(16, HEAP_RT_COUNT16, mod_block16),
-	BLOCK_DEF(32, HEAP_RT_COUNT32, mod_block32),
-	BLOCK_DEF(64, HEAP_RT_COUNT64, mod_block64),
-	BLOCK_DEF(128, HEAP_RT_COUNT128, mod_block128),
-	BLOCK_DEF(256, HEAP_RT_COUNT256, mod_block256),
-	BLOCK_DEF(512, HEAP_RT_COUNT512, mod_block512),
-	BLOCK_DEF(1024, HEAP_RT_COUNT1024, mod_block1024),
-	BLOCK_DEF(2048, HEAP_RT_COUNT2048, mod_block2048),
+	BLOCK_DEF(16, HEAP_RT_COUNT16, mod_block16, mod_free16),
+	BLOCK_DEF(32, HEAP_RT_COUNT32, mod_block32, mod_free32),
+	BLOCK_DEF(64, HEAP_RT_COUNT64, mod_block64, mod_free64),
+	BLOCK_DEF(128, HEAP_RT_COUNT128, mod_block128, mod_free128),
+	BLOCK_DEF(256, HEAP_RT_COUNT256, mod_block256, mod_free256),
+	BLOCK_DEF(512, HEAP_RT_COUNT512, mod_block512, mod_free512),
+	BLOCK_DEF(1024, HEAP_RT_COUNT1024, mod_block1024, mod_free1024),
+	BLOCK_DEF(2048, HEAP_RT_COUNT2048, mod_block2048, mod_free2048),
 };
 
 /* Heap blocks for buffers */
 static SHARED_DATA struct block_hdr buf_block[HEAP_BUFFER_COUNT];
+static SHARED_DATA uint32_t buf_free[BLOCK_MAP_WORDS(HEAP_BUFFER_COUNT)];
 
 /* Heap memory map for buffers */
 static SHARED_DATA struct block_map buf_heap_map[] = {
-	BLOCK_DEF(HEAP_BUFFER_BLOCK_SIZE, HEAP_BUFFER_COUNT, buf_block),
+	BLOCK_DEF(HEAP_BUFFER_BLOCK_SIZE, HEAP_BUFFER_COUNT,
+		  buf_block, buf_free),
 };
 
 static SHARED_DATA struct mm memmap = {
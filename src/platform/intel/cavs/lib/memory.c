@@ -17,92 +17,141 @@
 
 #define uncached_block_hdr(hdr)	cache_to_uncache((struct block_hdr *)(hdr))
 #define uncached_block_map(map)	cache_to_uncache((struct block_map *)(map))
+#define uncached_free_map(map)	cache_to_uncache((uint32_t *)(map))
 
 extern uintptr_t _system_heap, _system_runtime_heap, _module_heap;
 extern uintptr_t _buffer_heap, _sof_core_s_start;
 
 /* Heap blocks for system runtime for primary core */
 static SHARED_DATA struct block_hdr sys_rt_0_block64[HEAP_SYS_RT_0_COUNT64];
+static SHARED_DATA uint32_t
+	sys_rt_0_free64[BLOCK_MAP_WORDS(HEAP_SYS_RT_0_COUNT64)];
 static SHARED_DATA struct block_hdr sys_rt_0_block512[HEAP_SYS_RT_0_COUNT512];
+static SHARED_DATA uint32_t
+	sys_rt_0_free512[BLOCK_MAP_WORDS(HEAP_SYS_RT_0_COUNT512)];
 static SHARED_DATA struct block_hdr sys_rt_0_block1024[HEAP_SYS_RT_0_COUNT1024];
+static SHARED_DATA uint32_t
+	sys_rt_0_free1024[BLOCK_MAP_WORDS(HEAP_SYS_RT_0_COUNT1024)];
 
 /* Heap blocks for system runtime for secondary core */
 #if PLATFORM_CORE_COUNT > 1
 static SHARED_DATA struct block_hdr
 	sys_rt_x_block64[PLATFORM_CORE_COUNT - 1][HEAP_SYS_RT_X_COUNT64];
+static SHARED_DATA uint32_t sys_rt_x_free64[PLATFORM_CORE_COUNT - 1]
+	[BLOCK_MAP_WORDS(HEAP_SYS_RT_X_COUNT64)];
 static SHARED_DATA struct block_hdr
 	sys_rt_x_block512[PLATFORM_CORE_COUNT - 1][HEAP_SYS_RT_X_COUNT512];
+static SHARED_DATA uint32_t sys_rt_x_free512[PLATFORM_CORE_COUNT - 1]
+	[BLOCK_MAP_WORDS(HEAP_SYS_RT_X_COUNT512)];
 static SHARED_DATA struct block_hdr
 	sys_rt_x_block1024[PLATFORM_CORE_COUNT - 1][HEAP_SYS_RT_X_COUNT1024];
+static SHARED_DATA uint32_t sys_rt_x_free1024[PLATFORM_CORE_COUNT - 1]
+	[BLOCK_MAP_WORDS(HEAP_SYS_RT_X_COUNT1024)];
 #endif
 
 /* Heap memory for system runtime */
 static SHARED_DATA struct block_map sys_rt_heap_map[PLATFORM_CORE_COUNT][3] = {
 	{ BLOCK_DEF(64, HEAP_SYS_RT_0_COUNT64,
-		    uncached_block_hdr(sys_rt_0_block64)),
+		    uncached_block_hdr(sys_rt_0_block64),
+		    uncached_free_map(sys_rt_0_free64)),
 	  BLOCK_DEF(512, HEAP_SYS_RT_0_COUNT512,
-		    uncached_block_hdr(sys_rt_0_block512)),
+		    uncached_block_hdr(sys_rt_0_block512),
+		    uncached_free_map(sys_rt_0_free512)),
 	  BLOCK_DEF(1024, HEAP_SYS_RT_0_COUNT1024,
-		    uncached_block_hdr(sys_rt_0_block1024)), },
+		    uncached_block_hdr(sys_rt_0_block1024),
+		    uncached_free_map(sys_rt_0_free1024)), },
 #if PLATFORM_CORE_COUNT > 1
 	{ BLOCK_DEF(64, HEAP_SYS_RT_X_COUNT64,
-		    uncached_block_hdr(sys_rt_x_block64[0])),
+		    uncached_block_hdr(sys_rt_x_block64[0]),
+		    uncached_free_map(sys_rt_x_free64[0])),
 	  BLOCK_DEF(512, HEAP_SYS_RT_X_COUNT512,
-		    uncached_block_hdr(sys_rt_x_block512[0])),
+		    uncached_block_hdr(sys_rt_x_block512[0]),
+		    uncached_free_map(sys_rt_x_free512[0])),
 	  BLOCK_DEF(1024, HEAP_SYS_RT_X_COUNT1024,
-		    uncached_block_hdr(sys_rt_x_block1024[0])), },
+		    uncached_block_hdr(sys_rt_x_block1024[0]),
+		    uncached_free_map(sys_rt_x_free1024[0])), },
 #endif
 #if PLATFORM_CORE_COUNT > 2
 	{ BLOCK_DEF(64, HEAP_SYS_RT_X_COUNT64,
-		    uncached_block_hdr(sys_rt_x_block64[1])),
+		    uncached_block_hdr(sys_rt_x_block64[1]),
+		    uncached_free_map(sys_rt_x_free64[1])),
 	  BLOCK_DEF(512, HEAP_SYS_RT_X_COUNT512,
-		    uncached_block_hdr(sys_rt_x_block512[1])),
+		    uncached_block_hdr(sys_rt_x_block512[1]),
+		    uncached_free_map(sys_rt_x_free512[1])),
 	  BLOCK_DEF(1024, HEAP_SYS_RT_X_COUNT1024,
-		    uncached_block_hdr(sys_rt_x_block1024[1])), },
+		    uncached_block_hdr(sys_rt_x_block1024[1]),
+		    uncached_free_map(sys_rt_x_free1024[1])), },
 #endif
 #if PLATFORM_CORE_COUNT > 3
 	{ BLOCK_DEF(64, HEAP_SYS_RT_X_COUNT64,
-		    uncached_block_hdr(sys_rt_x_block64[2])),
+		    uncached_block_hdr(sys_rt_x_block64[2]),
+		    uncached_free_map(sys_rt_x_free64[2])),
 	  BLOCK_DEF(512, HEAP_SYS_RT_X_COUNT512,
-		    uncached_block_hdr(sys_rt_x_block512[2])),
+		    uncached_block_hdr(sys_rt_x_block512[2]),
+		    uncached_free_map(sys_rt_x_free512[2])),
 	  BLOCK_DEF(1024, HEAP_SYS_RT_X_COUNT1024,
-		    uncached_block_hdr(sys_rt_x_block1024[2])), },
+		    uncached_block_hdr(sys_rt_x_block1024[2]),
+		    uncached_free_map(sys_rt_x_free1024[2])), },
 #endif
 };
 
 /* Heap blocks for modules */
 static SHARED_DATA struct block_hdr mod_block64[HEAP_RT_COUNT64];
+static SHARED_DATA uint32_t mod_free64[BLOCK_MAP_WORDS(HEAP_RT_COUNT64)];
 static SHARED_DATA struct block_hdr mod_block128[HEAP_RT_COUNT128];
+static SHARED_DATA uint32_t mod_free128[BLOCK_MAP_WORDS(HEAP_RT_COUNT128)];
 static SHARED_DATA struct block_hdr mod_block256[HEAP_RT_COUNT256];
+static SHARED_DATA uint32_t mod_free256[BLOCK_MAP_WORDS(HEAP_RT_COUNT256)];
 static SHARED_DATA struct block_hdr mod_block512[HEAP_RT_COUNT512];
+static SHARED_DATA uint32_t mod_free512[BLOCK_MAP_WORDS(HEAP_RT_COUNT512)];
 static SHARED_DATA struct block_hdr mod_block1024[HEAP_RT_COUNT1024];
+static SHARED_DATA uint32_t mod_free1024[BLOCK_MAP_WORDS(HEAP_RT_COUNT1024)];
 static SHARED_DATA struct block_hdr mod_block2048[HEAP_RT_COUNT2048];
+static SHARED_DATA uint32_t mod_free2048[BLOCK_MAP_WORDS(HEAP_RT_COUNT2048)];
 static SHARED_DATA struct block_hdr mod_block4096[HEAP_RT_COUNT4096];
+static SHARED_DATA uint32_t mod_free4096[BLOCK_MAP_WORDS(HEAP_RT_COUNT4096)];
 
 /* Heap memory map for modules */
 static SHARED_DATA struct block_map rt_heap_map[] = {
-	BLOCK_DEF(64, HEAP_RT_COUNT64, uncached_block_hdr(mod_block64)),
-	BLOCK_DEF(128, HEAP_RT_COUNT128, uncached_block_hdr(mod_block128)),
-	BLOCK_DEF(256, HEAP_RT_COUNT256, uncached_block_hdr(mod_block256)),
-	BLOCK_DEF(512, HEAP_RT_COUNT512, uncached_block_hdr(mod_block512)),
-	BLOCK_DEF(1024, HEAP_RT_COUNT1024, uncached_block_hdr(mod_block1024)),
-	BLOCK_DEF(2048, HEAP_RT_COUNT2048, uncached_block_hdr(mod_block2048)),
-	BLOCK_DEF(4096, HEAP_RT_COUNT4096, uncached_block_hdr(mod_block4096)),
+	BLOCK_DEF(64, HEAP_RT_COUNT64,
+		  uncached_block_hdr(mod_block64),
+		  uncached_free_map(mod_free64)),
+	BLOCK_DEF(128, HEAP_RT_COUNT128,
+		  uncached_block_hdr(mod_block128),
+		  uncached_free_map(mod_free128)),
+	BLOCK_DEF(256, HEAP_RT_COUNT256,
+		  uncached_block_hdr(mod_block256),
+		  uncached_free_map(mod_free256)),
+	BLOCK_DEF(512, HEAP_RT_COUNT512,
+		  uncached_block_hdr(mod_block512),
+		  uncached_free_map(mod_free512)),
+	BLOCK_DEF(1024, HEAP_RT_COUNT1024,
+		  uncached_block_hdr(mod_block1024),
+		  uncached_free_map(mod_free1024)),
+	BLOCK_DEF(2048, HEAP_RT_COUNT2048,
+		  uncached_block_hdr(mod_block2048),
+		  uncached_free_map(mod_free2048)),
+	BLOCK_DEF(4096, HEAP_RT_COUNT4096,
+		  uncached_block_hdr(mod_block4096),
+		  uncached_free_map(mod_free4096)),
 };
 
 /* Heap blocks for buffers */
 static SHARED_DATA struct block_hdr buf_block[HEAP_BUFFER_COUNT];
+static SHARED_DATA uint32_t buf_free[BLOCK_MAP_WORDS(HEAP_BUFFER_COUNT)];
 static SHARED_DATA struct block_hdr lp_buf_block[HEAP_LP_BUFFER_COUNT];
+static SHARED_DATA uint32_t lp_buf_free[BLOCK_MAP_WORDS(HEAP_LP_BUFFER_COUNT)];
 
 /* Heap memory map for buffers */
 static SHARED_DATA struct block_map buf_heap_map[] = {
 	BLOCK_DEF(HEAP_BUFFER_BLOCK_SIZE, HEAP_BUFFER_COUNT,
-		  uncached_block_hdr(buf_block)),
+		  uncached_block_hdr(buf_block), uncached_free_map(buf_free)),
 };
 
 static SHARED_DATA struct block_map lp_buf_heap_map[] = {
 	BLOCK_DEF(HEAP_LP_BUFFER_BLOCK_SIZE, HEAP_LP_BUFFER_COUNT,
-		  uncached_block_hdr(lp_buf_block)),
+		  uncached_block_hdr(lp_buf_block),
+		  uncached_free_map(lp_buf_free)),
 };
 
 static SHARED_DATA struct mm memmap;
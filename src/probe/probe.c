@@ -1042,6 +1042,7 @@ int probe_point_add(uint32_t count, struct probe_point *probe)
 				  &probe_cb_produce, 0);
 		notifier_register(_probe, dev->cb, NOTIFIER_ID_BUFFER_FREE,
 				  &probe_cb_free, 0);
+		buffer_cb_enable(dev->cb, BUFF_CB_TYPE_PRODUCE);
 	}
 
 	return 0;
@@ -1106,6 +1107,8 @@ int probe_point_remove(uint32_t count, uint32_t *buffer_id)
 			    _probe->probe_points[j].buffer_id == buffer_id[i]) {
 				dev = ipc_get_comp_by_id(ipc_get(), buffer_id[i]);
 				if (dev) {
+					buffer_cb_disable(dev->cb,
+							  BUFF_CB_TYPE_PRODUCE);
 					notifier_unregister(_probe, dev->cb,
 							    NOTIFIER_ID_BUFFER_PRODUCE);
 					notifier_unregister(_probe, dev->cb,
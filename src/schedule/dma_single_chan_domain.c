@@ -576,6 +576,9 @@ struct ll_schedule_domain *dma_single_chan_domain_init(struct dma *dma_array,
 	domain = domain_init(SOF_SCHEDULE_LL_DMA, clk, false,
 			     &dma_single_chan_domain_ops);
 
+	/* pending check looks only at task start */
+	domain->pending_at_start = true;
+
 	dma_domain = rzalloc(SOF_MEM_ZONE_SYS, SOF_MEM_FLAG_SHARED,
 			     SOF_MEM_CAPS_RAM, sizeof(*dma_domain));
 	dma_domain->dma_array = dma_array;
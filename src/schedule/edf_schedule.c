@@ -12,7 +12,7 @@
 #include <sof/lib/alloc.h>
 #include <sof/lib/clk.h>
 #include <sof/lib/uuid.h>
-#include <sof/list.h>
+#include <sof/pairing_heap.h>
 #include <sof/platform.h>
 #include <sof/schedule/edf_schedule.h>
 #include <sof/schedule/schedule.h>
@@ -30,7 +30,7 @@ DECLARE_SOF_UUID("edf-schedule", edf_sched_uuid, 0x77de2074, 0x828c, 0x4044,
 DECLARE_TR_CTX(edf_tr, SOF_UUID(edf_sched_uuid), LOG_LEVEL_INFO);
 
 struct edf_schedule_data {
-	struct list_item list;	/* list of tasks in priority queue */
+	struct pheap queue;	/* queued and running tasks by deadline */
 	uint32_t clock;
 	int irq;
 };
@@ -44,7 +44,7 @@ static void schedule_edf(void *data);
 static void schedule_edf_task_run(struct task *task, void *data)
 {
 	while (1) {
-		/* execute task run function and remove task from the list
+		/* execute task run function and remove task from the queue
 		 * only if completed
 		 */
 		if (task_run(task) == SOF_TASK_STATE_COMPLETED)
@@ -58,38 +58,20 @@ static void schedule_edf_task_run(struct task *task, void *data)
 static void edf_scheduler_run(void *data)
 {
 	struct edf_schedule_data *edf_sch = data;
-	uint64_t deadline_next = SOF_TASK_DEADLINE_IDLE;
+	struct edf_task_pdata *edf_pdata;
 	struct task *task_next = NULL;
-	struct list_item *tlist;
-	struct task *task;
-	uint64_t deadline;
+	struct pheap_item *first;
 	uint32_t flags;
 
 	tr_dbg(&edf_tr, "edf_scheduler_run()");
 
 	irq_local_disable(flags);
 
-	/* find next task to run */
-	list_for_item(tlist, &edf_sch->list) {
-		task = container_of(tlist, struct task, list);
-
-		if (task->state != SOF_TASK_STATE_QUEUED &&
-		    task->state != SOF_TASK_STATE_RUNNING)
-			continue;
-
-		deadline = task_get_deadline(task);
-
-		if (deadline == SOF_TASK_DEADLINE_NOW) {
-			/* task needs to be scheduled ASAP */
-			task_next = task;
-			break;
-		}
-
-		/* get earliest deadline */
-		if (deadline <= deadline_next) {
-			deadline_next = deadline;
-			task_next = task;
-		}
+	/* next task to run has the earliest deadline */
+	first = pheap_first(&edf_sch->queue);
+	if (first) {
+		edf_pdata = container_of(first, struct edf_task_pdata, item);
+		task_next = edf_pdata->task;
 	}
 
 	irq_local_enable(flags);
@@ -104,6 +86,7 @@ static int schedule_edf_task(void *data, struct task *task, uint64_t start,
 			     uint64_t period)
 {
 	struct edf_schedule_data *edf_sch = data;
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
 	uint32_t flags;
 	(void) period; /* not used */
 	(void) start; /* not used */
@@ -119,8 +102,9 @@ static int schedule_edf_task(void *data, struct task *task, uint64_t start,
 		return -EALREADY;
 	}
 
-	/* add task to the list */
-	list_item_append(&task->list, &edf_sch->list);
+	/* add task to the queue, deadline is sampled only here */
+	edf_pdata->item.key = task_get_deadline(task);
+	pheap_insert(&edf_sch->queue, &edf_pdata->item);
 
 	task->state = SOF_TASK_STATE_QUEUED;
 
@@ -153,6 +137,7 @@ int schedule_task_init_edf(struct task *task, const struct sof_uuid_entry *uid,
 		return -ENOMEM;
 	}
 
+	edf_pdata->task = task;
 	edf_sch_set_pdata(task, edf_pdata);
 
 	task->ops.complete = ops->complete;
@@ -199,6 +184,8 @@ static int schedule_edf_task_running(void *data, struct task *task)
 
 static int schedule_edf_task_complete(void *data, struct task *task)
 {
+	struct edf_schedule_data *edf_sch = data;
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
 	uint32_t flags;
 
 	tr_dbg(&edf_tr, "schedule_edf_task_complete()");
@@ -208,7 +195,7 @@ static int schedule_edf_task_complete(void *data, struct task *task)
 	task_complete(task);
 
 	task->state = SOF_TASK_STATE_COMPLETED;
-	list_item_del(&task->list);
+	pheap_del(&edf_sch->queue, &edf_pdata->item);
 
 	irq_local_enable(flags);
 
@@ -217,6 +204,8 @@ static int schedule_edf_task_complete(void *data, struct task *task)
 
 static int schedule_edf_task_cancel(void *data, struct task *task)
 {
+	struct edf_schedule_data *edf_sch = data;
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
 	uint32_t flags;
 
 	tr_dbg(&edf_tr, "schedule_edf_task_cancel()");
@@ -226,7 +215,7 @@ static int schedule_edf_task_cancel(void *data, struct task *task)
 	/* cancel and delete only if queued */
 	if (task->state == SOF_TASK_STATE_QUEUED) {
 		task->state = SOF_TASK_STATE_CANCEL;
-		list_item_del(&task->list);
+		pheap_del(&edf_sch->queue, &edf_pdata->item);
 	}
 
 	irq_local_enable(flags);
@@ -236,11 +225,17 @@ static int schedule_edf_task_cancel(void *data, struct task *task)
 
 static int schedule_edf_task_free(void *data, struct task *task)
 {
+	struct edf_schedule_data *edf_sch = data;
 	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
 	uint32_t flags;
 
 	irq_local_disable(flags);
 
+	/* queue item is part of the private data freed below */
+	if (task->state == SOF_TASK_STATE_QUEUED ||
+	    task->state == SOF_TASK_STATE_RUNNING)
+		pheap_del(&edf_sch->queue, &edf_pdata->item);
+
 	task->state = SOF_TASK_STATE_FREE;
 
 	task_context_free(edf_pdata->ctx);
@@ -261,7 +256,7 @@ int scheduler_init_edf(void)
 
 	edf_sch = rzalloc(SOF_MEM_ZONE_SYS, 0, SOF_MEM_CAPS_RAM,
 			  sizeof(*edf_sch));
-	list_init(&edf_sch->list);
+	pheap_init(&edf_sch->queue);
 	edf_sch->clock = PLATFORM_DEFAULT_CLOCK;
 
 	scheduler_init(SOF_SCHEDULE_EDF, &schedule_edf_ops, edf_sch);
@@ -295,8 +290,6 @@ static void scheduler_free_edf(void *data)
 	/* free main task context */
 	task_main_free();
 
-	list_item_del(&edf_sch->list);
-
 	irq_local_enable(flags);
 }
 
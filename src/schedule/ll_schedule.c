@@ -40,7 +40,8 @@ DECLARE_TR_CTX(ll_tr, SOF_UUID(ll_sched_uuid), LOG_LEVEL_INFO);
 
 /* one instance of data allocated per core */
 struct ll_schedule_data {
-	struct list_item tasks;			/* list of ll tasks */
+	struct list_item tasks;			/* ll tasks by start time */
+	struct list_item pending;		/* due ll tasks by priority */
 	atomic_t num_tasks;			/* number of ll tasks */
 #if CONFIG_PERFORMANCE_COUNTERS
 	struct perf_cnt_data pcd;
@@ -55,28 +56,95 @@ const struct scheduler_ops schedule_ll_ops;
 		(uint32_t)((pcd)->plat_delta_peak),		\
 		(uint32_t)((pcd)->cpu_delta_peak))
 
+static void schedule_ll_task_insert(struct task *task, struct list_item *tasks)
+{
+	struct list_item *tlist;
+	struct task *curr_task;
+
+	/* tasks are added into the list from highest to lowest priority
+	 * and tasks with the same priority should be served on
+	 * a first-come-first-serve basis
+	 */
+	list_for_item(tlist, tasks) {
+		curr_task = container_of(tlist, struct task, list);
+		if (task->priority < curr_task->priority) {
+			list_item_append(&task->list, &curr_task->list);
+			return;
+		}
+	}
+
+	/* if task has not been added, means that it has the lowest
+	 * priority and should be added at the end of the list
+	 */
+	list_item_append(&task->list, tasks);
+}
+
+static void schedule_ll_task_insert_start(struct task *task,
+					  struct list_item *tasks)
+{
+	struct list_item *tlist;
+	struct task *curr_task;
+
+	/* tasks are kept from the earliest to the latest start and then
+	 * by priority, a new start is usually among the latest ones so
+	 * the search goes from the end of the list
+	 */
+	list_for_item_prev(tlist, tasks) {
+		curr_task = container_of(tlist, struct task, list);
+		if (curr_task->start < task->start ||
+		    (curr_task->start == task->start &&
+		     curr_task->priority <= task->priority)) {
+			list_item_prepend(&task->list, &curr_task->list);
+			return;
+		}
+	}
+
+	/* task starts before all others */
+	list_item_prepend(&task->list, tasks);
+}
+
+static bool schedule_ll_task_is_queued(struct ll_schedule_data *sch,
+				       struct task *task)
+{
+	struct list_item *tlist;
+
+	list_for_item(tlist, &sch->tasks)
+		if (container_of(tlist, struct task, list) == task)
+			return true;
+
+	list_for_item(tlist, &sch->pending)
+		if (container_of(tlist, struct task, list) == task)
+			return true;
+
+	return false;
+}
+
 static bool schedule_ll_is_pending(struct ll_schedule_data *sch)
 {
+	struct list_item *wlist;
 	struct list_item *tlist;
 	struct task *task;
-	uint32_t pending_count = 0;
 	struct comp_dev *sched_comp;
 
 	do {
 		sched_comp = NULL;
 
-		/* mark each valid task as pending */
-		list_for_item(tlist, &sch->tasks) {
-			task = container_of(tlist, struct task, list);
+		/* move each valid task to the pending list */
+		list_for_item_safe(wlist, tlist, &sch->tasks) {
+			task = container_of(wlist, struct task, list);
 
 			if (domain_is_pending(sch->domain, task, &sched_comp)) {
 				task->state = SOF_TASK_STATE_PENDING;
-				pending_count++;
+				list_item_del(&task->list);
+				schedule_ll_task_insert(task, &sch->pending);
+			} else if (sch->domain->pending_at_start) {
+				/* all following tasks start even later */
+				break;
 			}
 		}
 	} while (sched_comp);
 
-	return pending_count > 0;
+	return !list_is_empty(&sch->pending);
 }
 
 static void schedule_ll_task_update_start(struct ll_schedule_data *sch,
@@ -102,14 +170,10 @@ static void schedule_ll_tasks_execute(struct ll_schedule_data *sch,
 	int cpu = cpu_get_id();
 	int count;
 
-	/* check each task in the list for pending */
-	list_for_item_safe(wlist, tlist, &sch->tasks) {
+	/* run each pending task in priority order */
+	list_for_item_safe(wlist, tlist, &sch->pending) {
 		task = container_of(wlist, struct task, list);
 
-		/* run task if its pending and remove from the list */
-		if (task->state != SOF_TASK_STATE_PENDING)
-			continue;
-
 		task->state = task_run(task);
 
 		/* do we need to reschedule this task */
@@ -128,6 +192,13 @@ static void schedule_ll_tasks_execute(struct ll_schedule_data *sch,
 		} else {
 			/* update task's start time */
 			schedule_ll_task_update_start(sch, task, last_tick);
+
+			/* requeue unless cancelled while running */
+			if (!list_is_empty(&task->list)) {
+				list_item_del(&task->list);
+				schedule_ll_task_insert_start(task,
+							      &sch->tasks);
+			}
 		}
 	}
 
@@ -296,49 +367,19 @@ static void schedule_ll_domain_clear(struct ll_schedule_data *sch,
 	domain_unregister(sch->domain, task, atomic_read(&sch->num_tasks));
 }
 
-static void schedule_ll_task_insert(struct task *task, struct list_item *tasks)
-{
-	struct list_item *tlist;
-	struct task *curr_task;
-
-	/* tasks are added into the list from highest to lowest priority
-	 * and tasks with the same priority should be served on
-	 * a first-come-first-serve basis
-	 */
-	list_for_item(tlist, tasks) {
-		curr_task = container_of(tlist, struct task, list);
-		if (task->priority < curr_task->priority) {
-			list_item_append(&task->list, &curr_task->list);
-			return;
-		}
-	}
-
-	/* if task has not been added, means that it has the lowest
-	 * priority and should be added at the end of the list
-	 */
-	list_item_append(&task->list, tasks);
-}
-
 static int schedule_ll_task(void *data, struct task *task, uint64_t start,
 			    uint64_t period)
 {
 	struct ll_schedule_data *sch = data;
 	struct ll_task_pdata *pdata;
-	struct list_item *tlist;
-	struct task *curr_task;
 	uint32_t flags;
 	int ret = 0;
 
 	irq_local_disable(flags);
 
-	/* check if task is already scheduled */
-	list_for_item(tlist, &sch->tasks) {
-		curr_task = container_of(tlist, struct task, list);
-
-		/* keep original start */
-		if (curr_task == task)
-			goto out;
-	}
+	/* check if task is already scheduled, keep original start */
+	if (schedule_ll_task_is_queued(sch, task))
+		goto out;
 
 	pdata = ll_sch_get_pdata(task);
 
@@ -353,15 +394,10 @@ static int schedule_ll_task(void *data, struct task *task, uint64_t start,
 
 	pdata->period = period;
 
-	/* insert task into the list */
-	schedule_ll_task_insert(task, &sch->tasks);
-
 	/* set schedule domain */
 	ret = schedule_ll_domain_set(sch, task, period);
-	if (ret < 0) {
-		list_item_del(&task->list);
+	if (ret < 0)
 		goto out;
-	}
 
 	task->start = sch->domain->ticks_per_ms * start / 1000;
 
@@ -370,6 +406,9 @@ static int schedule_ll_task(void *data, struct task *task, uint64_t start,
 	else
 		task->start += sch->domain->last_tick;
 
+	/* insert task into the list */
+	schedule_ll_task_insert_start(task, &sch->tasks);
+
 	platform_shared_commit(sch->domain, sizeof(*sch->domain));
 
 out:
@@ -428,8 +467,6 @@ static int schedule_ll_task_free(void *data, struct task *task)
 static int schedule_ll_task_cancel(void *data, struct task *task)
 {
 	struct ll_schedule_data *sch = data;
-	struct list_item *tlist;
-	struct task *curr_task;
 	uint32_t flags;
 
 	irq_local_disable(flags);
@@ -437,15 +474,8 @@ static int schedule_ll_task_cancel(void *data, struct task *task)
 	tr_info(&ll_tr, "task cancel %p %pU", task, task->uid);
 
 	/* check to see if we are scheduled */
-	list_for_item(tlist, &sch->tasks) {
-		curr_task = container_of(tlist, struct task, list);
-
-		/* found it */
-		if (curr_task == task) {
-			schedule_ll_domain_clear(sch, task);
-			break;
-		}
-	}
+	if (schedule_ll_task_is_queued(sch, task))
+		schedule_ll_domain_clear(sch, task);
 
 	/* remove work from list */
 	task->state = SOF_TASK_STATE_CANCEL;
@@ -459,8 +489,6 @@ static int schedule_ll_task_cancel(void *data, struct task *task)
 static int reschedule_ll_task(void *data, struct task *task, uint64_t start)
 {
 	struct ll_schedule_data *sch = data;
-	struct list_item *tlist;
-	struct task *curr_task;
 	uint32_t flags;
 	uint64_t time;
 
@@ -474,14 +502,16 @@ static int reschedule_ll_task(void *data, struct task *task, uint64_t start)
 	irq_local_disable(flags);
 
 	/* check to see if we are already scheduled */
-	list_for_item(tlist, &sch->tasks) {
-		curr_task = container_of(tlist, struct task, list);
-		/* found it */
-		if (curr_task == task) {
-			/* set start time */
-			task->start = time;
-			goto out;
+	if (schedule_ll_task_is_queued(sch, task)) {
+		/* set start time */
+		task->start = time;
+
+		/* running task is requeued after it returns */
+		if (task->state != SOF_TASK_STATE_PENDING) {
+			list_item_del(&task->list);
+			schedule_ll_task_insert_start(task, &sch->tasks);
 		}
+		goto out;
 	}
 
 	tr_err(&ll_tr, "reschedule_ll_task(): task not found");
@@ -505,6 +535,7 @@ static void scheduler_free_ll(void *data)
 			    NOTIFIER_CLK_CHANGE_ID(sch->domain->clk));
 
 	list_item_del(&sch->tasks);
+	list_item_del(&sch->pending);
 
 	platform_shared_commit(sch->domain, sizeof(*sch->domain));
 
@@ -515,18 +546,28 @@ static void ll_scheduler_recalculate_tasks(struct ll_schedule_data *sch,
 					   struct clock_notify_data *clk_data)
 {
 	uint64_t current = platform_timer_get(timer_get());
+	struct list_item *wlist;
 	struct list_item *tlist;
+	struct list_item tasks;
 	struct task *task;
 	uint64_t delta_ms;
 
-	list_for_item(tlist, &sch->tasks) {
-		task = container_of(tlist, struct task, list);
+	/* requeue all tasks, new start times may change their order */
+	tasks = sch->tasks;
+	list_relink(&tasks, &sch->tasks);
+	list_init(&sch->tasks);
+
+	list_for_item_safe(wlist, tlist, &tasks) {
+		task = container_of(wlist, struct task, list);
 		delta_ms = (task->start - current) /
 			clk_data->old_ticks_per_msec;
 
 		task->start = delta_ms ?
 			current + sch->domain->ticks_per_ms * delta_ms :
 			current + (sch->domain->ticks_per_ms >> 3);
+
+		list_item_del(&task->list);
+		schedule_ll_task_insert_start(task, &sch->tasks);
 	}
 }
 
@@ -556,6 +597,7 @@ int scheduler_init_ll(struct ll_schedule_domain *domain)
 	/* initialize scheduler private data */
 	sch = rzalloc(SOF_MEM_ZONE_SYS, 0, SOF_MEM_CAPS_RAM, sizeof(*sch));
 	list_init(&sch->tasks);
+	list_init(&sch->pending);
 	atomic_init(&sch->num_tasks, 0);
 	sch->domain = domain;
 
@@ -294,6 +294,9 @@ struct ll_schedule_domain *timer_domain_init(struct timer *timer, int clk,
 	domain = domain_init(SOF_SCHEDULE_LL_TIMER, clk, false,
 			     &timer_domain_ops);
 
+	/* tasks are due only by their start time */
+	domain->pending_at_start = true;
+
 	timer_domain = rzalloc(SOF_MEM_ZONE_SYS, SOF_MEM_FLAG_SHARED,
 			       SOF_MEM_CAPS_RAM, sizeof(*timer_domain));
 	timer_domain->timer = timer;
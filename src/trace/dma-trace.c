@@ -7,6 +7,7 @@
 #include <sof/audio/buffer.h>
 #include <sof/common.h>
 #include <sof/debug/panic.h>
+#include <sof/drivers/interrupt.h>
 #include <sof/drivers/ipc.h>
 #include <sof/lib/alloc.h>
 #include <sof/lib/cache.h>
@@ -14,6 +15,7 @@
 #include <sof/lib/dma.h>
 #include <sof/lib/memory.h>
 #include <sof/lib/uuid.h>
+#include <sof/math/numbers.h>
 #include <sof/platform.h>
 #include <sof/schedule/ll_schedule.h>
 #include <sof/schedule/schedule.h>
@@ -26,6 +28,7 @@
 #include <ipc/trace.h>
 #include <kernel/abi.h>
 #include <user/abi_dbg.h>
+#include <user/trace.h>
 #include <version.h>
 
 #include <errno.h>
@@ -42,9 +45,16 @@ DECLARE_TR_CTX(dt_tr, SOF_UUID(dma_trace_uuid), LOG_LEVEL_INFO);
 DECLARE_SOF_UUID("dma-trace-task", dma_trace_task_uuid, 0x2b972272, 0xc5b1,
 		 0x4b7e, 0x92, 0x6f, 0x0f, 0xc5, 0xcb, 0x4c, 0x46, 0x90);
 
+/* longest record trace_log() produces */
+#define DTRACE_RECORD_MAX_SIZE	(sizeof(struct log_entry_header) + \
+				 _TRACE_EVENT_MAX_ARGUMENT_COUNT * \
+				 sizeof(uint32_t))
+
 static int dma_trace_get_avail_data(struct dma_trace_data *d,
 				    struct dma_trace_buf *buffer,
 				    int avail);
+static void dtrace_merge_rings(struct dma_trace_data *d);
+static void dtrace_report_drops(struct dma_trace_data *d);
 
 static enum task_state trace_work(void *data)
 {
@@ -52,10 +62,15 @@ static enum task_state trace_work(void *data)
 	struct dma_trace_buf *buffer = &d->dmatb;
 	struct dma_sg_config *config = &d->config;
 	unsigned long flags;
-	uint32_t avail = buffer->avail;
+	uint32_t avail;
 	int32_t size;
 	uint32_t overflow;
 
+	dtrace_merge_rings(d);
+	dtrace_report_drops(d);
+
+	avail = buffer->avail;
+
 	/* make sure we don't write more than buffer */
 	if (avail > DMA_TRACE_LOCAL_SIZE) {
 		overflow = avail - DMA_TRACE_LOCAL_SIZE;
@@ -184,11 +199,46 @@ int dma_trace_host_buffer(struct dma_trace_data *d,
 }
 #endif
 
+static int dma_trace_rings_init(struct dma_trace_data *d)
+{
+	struct dma_trace_ring *rings;
+	char *buf;
+	int i;
+
+	rings = rballoc(0, SOF_MEM_CAPS_RAM,
+			sizeof(*rings) * PLATFORM_CORE_COUNT);
+	buf = rballoc(0, SOF_MEM_CAPS_RAM,
+		      DMA_TRACE_RING_SIZE * PLATFORM_CORE_COUNT);
+	if (!rings || !buf) {
+		tr_err(&dt_tr, "dma_trace_rings_init(): alloc failed");
+		rfree(rings);
+		rfree(buf);
+		return -ENOMEM;
+	}
+
+	bzero(rings, sizeof(*rings) * PLATFORM_CORE_COUNT);
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++)
+		rings[i].addr = buf + i * DMA_TRACE_RING_SIZE;
+	dcache_writeback_region(rings, sizeof(*rings) * PLATFORM_CORE_COUNT);
+
+	d->rings = rings;
+
+	return 0;
+}
+
 static int dma_trace_buffer_init(struct dma_trace_data *d)
 {
 	struct dma_trace_buf *buffer = &d->dmatb;
 	void *buf;
 	unsigned int flags;
+	int ret;
+
+	/* per core rings are kept across trace reconfiguration */
+	if (!d->rings) {
+		ret = dma_trace_rings_init(d);
+		if (ret < 0)
+			return ret;
+	}
 
 	/* allocate new buffer */
 	buf = rballoc(0, SOF_MEM_CAPS_RAM | SOF_MEM_CAPS_DMA,
@@ -369,6 +419,11 @@ void dma_trace_flush(void *t)
 		return;
 	}
 
+	/* Pull in what the cores traced since the last trace_work(). This
+	 * may run on a secondary core, but only on the panic path.
+	 */
+	dtrace_merge_rings(trace_data);
+
 	buffer = &trace_data->dmatb;
 	avail = buffer->avail;
 
@@ -469,104 +524,235 @@ static void dtrace_add_event(const char *e, uint32_t length)
 	struct dma_trace_data *trace_data = dma_trace_data_get();
 	struct dma_trace_buf *buffer = &trace_data->dmatb;
 	uint32_t margin;
-	uint32_t overflow;
 	int ret;
 
 	margin = dtrace_calc_buf_margin(buffer);
-	overflow = dtrace_calc_buf_overflow(buffer, length);
-
-	/* tracing dropped entries */
-	if (trace_data->dropped_entries) {
-		if (!overflow) {
-			/*
-			 * if any dropped entries have appeared and there
-			 * is not any overflow, their amount will be logged
-			 */
-			uint32_t tmp_dropped_entries =
-				trace_data->dropped_entries;
-			trace_data->dropped_entries = 0;
-			/*
-			 * this trace_error invocation causes recursion,
-			 * so after it we have to recalculate margin and
-			 * overflow
-			 */
-			tr_err(&dt_tr, "dtrace_add_event(): number of dropped logs = %u",
-			       tmp_dropped_entries);
-			margin = dtrace_calc_buf_margin(buffer);
-			overflow = dtrace_calc_buf_overflow(buffer, length);
-		}
+
+	/* check for buffer wrap */
+	if (margin > length) {
+		/* no wrap */
+		dcache_invalidate_region(buffer->w_ptr, length);
+		ret = memcpy_s(buffer->w_ptr, length, e, length);
+		assert(!ret);
+		dcache_writeback_region(buffer->w_ptr, length);
+		buffer->w_ptr = (char *)buffer->w_ptr + length;
+	} else {
+		/* data is bigger than remaining margin so we wrap */
+		dcache_invalidate_region(buffer->w_ptr, margin);
+		ret = memcpy_s(buffer->w_ptr, margin, e, margin);
+		assert(!ret);
+		dcache_writeback_region(buffer->w_ptr, margin);
+		buffer->w_ptr = buffer->addr;
+
+		dcache_invalidate_region(buffer->w_ptr, length - margin);
+		ret = memcpy_s(buffer->w_ptr, length - margin,
+			       e + margin, length - margin);
+		assert(!ret);
+		dcache_writeback_region(buffer->w_ptr, length - margin);
+		buffer->w_ptr = (char *)buffer->w_ptr + length - margin;
 	}
 
-	/* checking overflow */
-	if (!overflow) {
-		/* check for buffer wrap */
-		if (margin > length) {
-			/* no wrap */
-			dcache_invalidate_region(buffer->w_ptr, length);
-			ret = memcpy_s(buffer->w_ptr, length, e, length);
-			assert(!ret);
-			dcache_writeback_region(buffer->w_ptr, length);
-			buffer->w_ptr = (char *)buffer->w_ptr + length;
-		} else {
-			/* data is bigger than remaining margin so we wrap */
-			dcache_invalidate_region(buffer->w_ptr, margin);
-			ret = memcpy_s(buffer->w_ptr, margin, e, margin);
-			assert(!ret);
-			dcache_writeback_region(buffer->w_ptr, margin);
-			buffer->w_ptr = buffer->addr;
-
-			dcache_invalidate_region(buffer->w_ptr,
-						 length - margin);
-			ret = memcpy_s(buffer->w_ptr, length - margin,
-				       e + margin, length - margin);
-			assert(!ret);
-			dcache_writeback_region(buffer->w_ptr,
-						length - margin);
-			buffer->w_ptr = (char *)buffer->w_ptr + length - margin;
-		}
+	buffer->avail += length;
+	trace_data->posn.messages++;
+
+	platform_shared_commit(trace_data, sizeof(*trace_data));
+}
+
+static uint32_t dtrace_ring_offset(uint32_t off, uint32_t bytes)
+{
+	off += bytes;
 
-		buffer->avail += length;
-		trace_data->posn.messages++;
+	return off >= DMA_TRACE_RING_SIZE ? off - DMA_TRACE_RING_SIZE : off;
+}
+
+static uint32_t dtrace_ring_used(const struct dma_trace_ring *ring)
+{
+	if (ring->w_off >= ring->r_off)
+		return ring->w_off - ring->r_off;
+
+	return DMA_TRACE_RING_SIZE - ring->r_off + ring->w_off;
+}
+
+static void dtrace_ring_write(struct dma_trace_ring *ring, uint32_t off,
+			      const void *src, uint32_t bytes)
+{
+	uint32_t head = MIN(bytes, DMA_TRACE_RING_SIZE - off);
+	int ret;
+
+	ret = memcpy_s(ring->addr + off, head, src, head);
+	assert(!ret);
+	dcache_writeback_region(ring->addr + off, head);
+
+	if (bytes > head) {
+		ret = memcpy_s(ring->addr, bytes - head,
+			       (const char *)src + head, bytes - head);
+		assert(!ret);
+		dcache_writeback_region(ring->addr, bytes - head);
+	}
+}
+
+static void dtrace_ring_read(const struct dma_trace_ring *ring, uint32_t off,
+			     void *dst, uint32_t bytes)
+{
+	uint32_t head = MIN(bytes, DMA_TRACE_RING_SIZE - off);
+	int ret;
+
+	dcache_invalidate_region(ring->addr + off, head);
+	ret = memcpy_s(dst, head, ring->addr + off, head);
+	assert(!ret);
+
+	if (bytes > head) {
+		dcache_invalidate_region(ring->addr, bytes - head);
+		ret = memcpy_s((char *)dst + head, bytes - head, ring->addr,
+			       bytes - head);
+		assert(!ret);
+	}
+}
+
+/* Called only by the core owning the ring, with its interrupts off */
+static void dtrace_ring_add(struct dma_trace_ring *ring, const char *e,
+			    uint32_t length)
+{
+	uint32_t w_off = ring->w_off;
+
+	dcache_invalidate_region(&ring->r_off, sizeof(ring->r_off));
+
+	/* one byte stays free to tell a full ring from an empty one */
+	if (DMA_TRACE_RING_SIZE - dtrace_ring_used(ring) <=
+	    sizeof(length) + length) {
+		ring->dropped++;
 	} else {
-		/* if there is not enough memory for new log, we drop it */
-		trace_data->dropped_entries++;
+		dtrace_ring_write(ring, w_off, &length, sizeof(length));
+		w_off = dtrace_ring_offset(w_off, sizeof(length));
+		dtrace_ring_write(ring, w_off, e, length);
+		ring->w_off = dtrace_ring_offset(w_off, length);
 	}
 
-	platform_shared_commit(trace_data, sizeof(*trace_data));
+	/* publish the record after its data has been written back */
+	dcache_writeback_region(ring, offsetof(struct dma_trace_ring, r_off));
+}
+
+/* Moves records from the per core rings to the DMA buffer in timestamp
+ * order, for as long as the DMA buffer has room for them.
+ */
+static void dtrace_merge_rings(struct dma_trace_data *d)
+{
+	char e[DTRACE_RECORD_MAX_SIZE];
+	struct log_entry_header hdr;
+	struct dma_trace_ring *ring;
+	struct dma_trace_ring *next;
+	uint64_t next_ts = 0;
+	uint32_t next_length = 0;
+	uint32_t length;
+	int i;
+
+	if (!d->rings)
+		return;
+
+	dcache_invalidate_region(d->rings,
+				 sizeof(*d->rings) * PLATFORM_CORE_COUNT);
+
+	for (;;) {
+		/* find the oldest record at the head of the rings */
+		next = NULL;
+		for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
+			ring = &d->rings[i];
+			if (ring->r_off == ring->w_off)
+				continue;
+
+			dtrace_ring_read(ring, ring->r_off, &length,
+					 sizeof(length));
+			dtrace_ring_read(ring, dtrace_ring_offset(ring->r_off,
+								  sizeof(length)),
+					 &hdr, sizeof(hdr));
+			if (!next || hdr.timestamp < next_ts) {
+				next = ring;
+				next_ts = hdr.timestamp;
+				next_length = length;
+			}
+		}
+
+		if (!next || dtrace_calc_buf_overflow(&d->dmatb, next_length))
+			break;
+
+		dtrace_ring_read(next, dtrace_ring_offset(next->r_off,
+							  sizeof(next_length)),
+				 e, next_length);
+		next->r_off = dtrace_ring_offset(next->r_off,
+						 sizeof(next_length) +
+						 next_length);
+		dcache_writeback_region(&next->r_off, sizeof(next->r_off));
+
+		dtrace_add_event(e, next_length);
+	}
+}
+
+static void dtrace_report_drops(struct dma_trace_data *d)
+{
+	struct dma_trace_ring *ring;
+	uint32_t dropped;
+	int i;
+
+	if (!d->rings)
+		return;
+
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
+		ring = &d->rings[i];
+		dropped = ring->dropped - ring->reported;
+		if (!dropped)
+			continue;
+
+		ring->reported = ring->dropped;
+		dcache_writeback_region(&ring->r_off, sizeof(ring->r_off));
+
+		tr_err(&dt_tr, "dtrace_report_drops(): core %d dropped %u logs",
+		       i, dropped);
+	}
+}
+
+/* fill level of the fullest ring, as seen from the primary core */
+static uint32_t dtrace_rings_used(struct dma_trace_data *d)
+{
+	uint32_t used = 0;
+	int i;
+
+	dcache_invalidate_region(d->rings,
+				 sizeof(*d->rings) * PLATFORM_CORE_COUNT);
+
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++)
+		used = MAX(used, dtrace_ring_used(&d->rings[i]));
+
+	return used;
 }
 
 void dtrace_event(const char *e, uint32_t length)
 {
 	struct dma_trace_data *trace_data = dma_trace_data_get();
-	struct dma_trace_buf *buffer = NULL;
-	unsigned long flags;
+	uint32_t flags;
 
-	if (!trace_data || !trace_data->dmatb.addr ||
-	    length > DMA_TRACE_LOCAL_SIZE / 8 || length == 0) {
+	if (!trace_data || !trace_data->rings ||
+	    length > DTRACE_RECORD_MAX_SIZE || length == 0) {
 		platform_shared_commit(trace_data, sizeof(*trace_data));
 		return;
 	}
 
-	buffer = &trace_data->dmatb;
-
-	spin_lock_irq(&trace_data->lock, flags);
-	dtrace_add_event(e, length);
+	/* only interrupts on this core can race for its ring */
+	irq_local_disable(flags);
+	dtrace_ring_add(&trace_data->rings[cpu_get_id()], e, length);
+	irq_local_enable(flags);
 
 	/* if DMA trace copying is working or secondary core
-	 * don't check if local buffer is half full
+	 * don't check if the rings are half full
 	 */
 	if (trace_data->copy_in_progress ||
 	    cpu_get_id() != PLATFORM_PRIMARY_CORE_ID) {
 		platform_shared_commit(trace_data, sizeof(*trace_data));
-		spin_unlock_irq(&trace_data->lock, flags);
 		return;
 	}
 
-	spin_unlock_irq(&trace_data->lock, flags);
-
-	/* schedule copy now if buffer > 50% full */
+	/* schedule copy now if any ring > 50% full */
 	if (trace_data->enabled &&
-	    buffer->avail >= (DMA_TRACE_LOCAL_SIZE / 2)) {
+	    dtrace_rings_used(trace_data) >= (DMA_TRACE_RING_SIZE / 2)) {
 		reschedule_task(&trace_data->dmat_work,
 				DMA_TRACE_RESCHEDULE_TIME);
 		/* reschedule should not be interrupted
@@ -582,11 +768,11 @@ void dtrace_event_atomic(const char *e, uint32_t length)
 {
 	struct dma_trace_data *trace_data = dma_trace_data_get();
 
-	if (!trace_data || !trace_data->dmatb.addr ||
-	    length > DMA_TRACE_LOCAL_SIZE / 8 || length == 0) {
+	if (!trace_data || !trace_data->rings ||
+	    length > DTRACE_RECORD_MAX_SIZE || length == 0) {
 		platform_shared_commit(trace_data, sizeof(*trace_data));
 		return;
 	}
 
-	dtrace_add_event(e, length);
+	dtrace_ring_add(&trace_data->rings[cpu_get_id()], e, length);
 }
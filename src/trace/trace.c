@@ -11,6 +11,7 @@
 #include <sof/drivers/timer.h>
 #include <sof/lib/alloc.h>
 #include <sof/lib/cache.h>
+#include <sof/lib/clk.h>
 #include <sof/lib/cpu.h>
 #include <sof/lib/mailbox.h>
 #include <sof/lib/memory.h>
@@ -29,9 +30,34 @@
 struct trace {
 	uint32_t pos ;	/* trace position */
 	uint32_t enable;
+#if CONFIG_TRACE_RATE_LIMIT
+	uint64_t rate_period; /* rate limiting period in timer ticks */
+#endif
 	spinlock_t lock; /* locking mechanism */
 };
 
+#if CONFIG_TRACE_RATE_LIMIT
+/* trace contexts rate limited at the same time on each core */
+#define TRACE_RATE_SLOTS	16
+
+/* rate limiting state of single trace context */
+struct trace_rate_slot {
+	const struct tr_ctx *ctx;	/* context using the slot */
+	uint32_t count;			/* messages sent in period */
+	uint32_t dropped;		/* messages dropped in period */
+	uint64_t start;			/* period start timestamp */
+};
+
+/* rate limiting state of one core, in its own cache lines so the trace
+ * contexts stay read mostly and cores don't write each other's lines
+ */
+struct trace_rate {
+	struct trace_rate_slot slot[TRACE_RATE_SLOTS];
+} __aligned(PLATFORM_DCACHE_ALIGN);
+
+static struct trace_rate trace_rate[PLATFORM_CORE_COUNT];
+#endif /* CONFIG_TRACE_RATE_LIMIT */
+
 /* calculates total message size, both header and payload in bytes */
 #define MESSAGE_SIZE(args_num)	\
 	(sizeof(struct log_entry_header) + args_num * sizeof(uint32_t))
@@ -109,6 +135,82 @@ static inline bool trace_filter_pass(uint32_t lvl,
 	return lvl <= ctx->level;
 }
 
+#if CONFIG_TRACE_RATE_LIMIT
+/* returns slot of the context on this core, the least recently started
+ * one is taken over when the context has none
+ */
+static struct trace_rate_slot *trace_rate_slot_get(const struct tr_ctx *ctx)
+{
+	struct trace_rate *rate = &trace_rate[cpu_get_id()];
+	struct trace_rate_slot *oldest = &rate->slot[0];
+	int i;
+
+	for (i = 0; i < TRACE_RATE_SLOTS; i++) {
+		if (rate->slot[i].ctx == ctx)
+			return &rate->slot[i];
+
+		if (rate->slot[i].start < oldest->start)
+			oldest = &rate->slot[i];
+	}
+
+	oldest->ctx = ctx;
+	oldest->count = 0;
+	oldest->dropped = 0;
+	oldest->start = 0;
+
+	return oldest;
+}
+
+/**
+ * \brief Runtime trace rate limiting
+ * \param trace global trace data
+ * \param ctx trace context
+ * \param time current timer value
+ * \param dropped set to the number of messages dropped in the previous
+ *	  period when this message starts a new one
+ * \return false when the context has used up its messages in this period
+ *
+ * Token bucket of CONFIG_TRACE_RATE_LIMIT_BURST messages, refilled every
+ * CONFIG_TRACE_RATE_LIMIT_PERIOD milliseconds, for each context on each
+ * core. Dropped messages are only reported when the context traces again
+ * in a later period, and not at all when more than TRACE_RATE_SLOTS
+ * contexts trace on the core in the meantime.
+ */
+static bool trace_rate_pass(struct trace *trace, const struct tr_ctx *ctx,
+			    uint64_t time, uint32_t *dropped)
+{
+	struct trace_rate_slot *slot;
+
+	/* timer rate is known once platform clocks are initialized */
+	if (!trace->rate_period) {
+		if (!clocks_get())
+			return true;
+
+		trace->rate_period =
+			clock_ms_to_ticks(PLATFORM_DEFAULT_CLOCK,
+					  CONFIG_TRACE_RATE_LIMIT_PERIOD);
+	}
+
+	slot = trace_rate_slot_get(ctx);
+
+	if (time - slot->start >= trace->rate_period) {
+		*dropped = slot->dropped;
+		slot->start = time;
+		slot->count = 0;
+		slot->dropped = 0;
+	}
+
+	if (slot->count >= CONFIG_TRACE_RATE_LIMIT_BURST) {
+		slot->dropped++;
+		return false;
+	}
+
+	slot->count++;
+
+	return true;
+}
+#endif /* CONFIG_TRACE_RATE_LIMIT */
+
 void trace_log(bool send_atomic, const void *log_entry,
 	       const struct tr_ctx *ctx, uint32_t lvl, uint32_t id_1,
 	       uint32_t id_2, int arg_count, ...)
@@ -116,20 +218,32 @@ void trace_log(bool send_atomic, const void *log_entry,
 	uint32_t data[MESSAGE_SIZE_DWORDS(_TRACE_EVENT_MAX_ARGUMENT_COUNT)];
 	const int message_size = MESSAGE_SIZE(arg_count);
 	struct trace *trace = trace_get();
+	uint64_t time;
 	va_list vl;
 	int i;
 #if CONFIG_TRACEM
 	unsigned long flags;
 #endif /* CONFIG_TRACEM */
+#if CONFIG_TRACE_RATE_LIMIT
+	uint32_t dropped = 0;
+#endif /* CONFIG_TRACE_RATE_LIMIT */
 
 	if (!trace->enable || !trace_filter_pass(lvl, ctx)) {
 		platform_shared_commit(trace, sizeof(*trace));
 		return;
 	}
 
+	time = platform_timer_get(timer_get());
+
+#if CONFIG_TRACE_RATE_LIMIT
+	if (!trace_rate_pass(trace, ctx, time, &dropped)) {
+		platform_shared_commit(trace, sizeof(*trace));
+		return;
+	}
+#endif /* CONFIG_TRACE_RATE_LIMIT */
+
 	/* fill log content */
-	put_header(data, ctx->uuid_p, id_1, id_2, (uint32_t)log_entry,
-		   platform_timer_get(timer_get()));
+	put_header(data, ctx->uuid_p, id_1, id_2, (uint32_t)log_entry, time);
 	va_start(vl, arg_count);
 	for (i = 0; i < arg_count; ++i)
 		data[PAYLOAD_OFFSET(i)] = va_arg(vl, uint32_t);
@@ -155,6 +269,15 @@ void trace_log(bool send_atomic, const void *log_entry,
 	if (lvl == LOG_LEVEL_CRITICAL)
 		mtrace_event((const char *)data, MESSAGE_SIZE(arg_count));
 #endif /* CONFIG_TRACEM */
+
+#if CONFIG_TRACE_RATE_LIMIT
+	/* summary of the previous period, after its first new message */
+	if (dropped)
+		_log_message(send_atomic, LOG_LEVEL_WARNING, _TRACE_INV_CLASS,
+			     ctx, id_1, id_2,
+			     "trace_log(): %u messages dropped by rate limit",
+			     dropped);
+#endif /* CONFIG_TRACE_RATE_LIMIT */
 }
 
 struct sof_ipc_trace_filter_elem *trace_filter_fill(struct sof_ipc_trace_filter_elem *elem,
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+#include <sof/drivers/ipc.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+static void test_audio_buffer_alias_shares_data(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 256
+	};
+
+	struct comp_buffer *src = buffer_new(&test_buf_desc);
+	struct comp_buffer *snk = buffer_new(&test_buf_desc);
+	struct comp_buffer *other = buffer_new(&test_buf_desc);
+
+	assert_non_null(src);
+	assert_non_null(snk);
+	assert_non_null(other);
+
+	assert_int_equal(buffer_alias(snk, src), 0);
+	assert_ptr_equal(snk->stream.addr, src->stream.addr);
+	assert_ptr_equal(snk->stream.w_ptr, src->stream.r_ptr);
+	assert_int_equal(snk->stream.size, src->stream.size);
+
+	/* source can have only one buffer aliasing it */
+	assert_int_equal(buffer_alias(other, src), -EINVAL);
+
+	buffer_free(src);
+	buffer_free(snk);
+	buffer_free(other);
+}
+
+static void test_audio_buffer_alias_free_space(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 256
+	};
+
+	struct comp_buffer *src = buffer_new(&test_buf_desc);
+	struct comp_buffer *snk = buffer_new(&test_buf_desc);
+
+	assert_non_null(src);
+	assert_non_null(snk);
+	assert_int_equal(buffer_alias(snk, src), 0);
+
+	/* 64 bytes written, 48 of them processed in place */
+	comp_update_buffer_produce(src, 64);
+	comp_update_buffer_consume(src, 48);
+	comp_update_buffer_produce(snk, 48);
+
+	assert_int_equal(audio_stream_get_avail_bytes(&src->stream), 16);
+	assert_int_equal(audio_stream_get_avail_bytes(&snk->stream), 48);
+	assert_int_equal(audio_stream_get_free_bytes(&src->stream), 192);
+
+	comp_update_buffer_consume(snk, 48);
+
+	assert_int_equal(audio_stream_get_free_bytes(&src->stream), 240);
+
+	buffer_free(src);
+	buffer_free(snk);
+}
+
+static void test_audio_buffer_unalias(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer src_buf_desc = {
+		.size = 256
+	};
+
+	struct sof_ipc_buffer snk_buf_desc = {
+		.size = 128
+	};
+
+	struct comp_buffer *src = buffer_new(&src_buf_desc);
+	struct comp_buffer *snk = buffer_new(&snk_buf_desc);
+
+	assert_non_null(src);
+	assert_non_null(snk);
+	assert_int_equal(buffer_alias(snk, src), 0);
+	assert_int_equal(snk->stream.size, 256);
+
+	assert_int_equal(buffer_unalias(snk), 0);
+	assert_ptr_not_equal(snk->stream.addr, src->stream.addr);
+	assert_int_equal(snk->stream.size, 128);
+	assert_null(snk->alias_src);
+	assert_null(src->alias_sink);
+
+	buffer_free(src);
+	buffer_free(snk);
+}
+
+static void test_audio_buffer_alias_set_size(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 256
+	};
+
+	struct comp_buffer *src = buffer_new(&test_buf_desc);
+	struct comp_buffer *snk = buffer_new(&test_buf_desc);
+
+	assert_non_null(src);
+	assert_non_null(snk);
+	assert_int_equal(buffer_alias(snk, src), 0);
+
+	assert_int_equal(buffer_set_size(src, 128), 0);
+	assert_null(snk->alias_src);
+	assert_ptr_not_equal(snk->stream.addr, src->stream.addr);
+	assert_int_equal(src->stream.size, 128);
+	assert_int_equal(snk->stream.size, 256);
+
+	buffer_free(src);
+	buffer_free(snk);
+}
+
+static void test_audio_buffer_alias_chain_free(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 256
+	};
+
+	struct comp_buffer *buf1 = buffer_new(&test_buf_desc);
+	struct comp_buffer *buf2 = buffer_new(&test_buf_desc);
+	struct comp_buffer *buf3 = buffer_new(&test_buf_desc);
+
+	assert_non_null(buf1);
+	assert_non_null(buf2);
+	assert_non_null(buf3);
+	assert_int_equal(buffer_alias(buf2, buf1), 0);
+	assert_int_equal(buffer_alias(buf3, buf2), 0);
+	assert_ptr_equal(buf3->stream.addr, buf1->stream.addr);
+
+	/* data area is passed to the rest of the chain */
+	buffer_free(buf1);
+	assert_null(buf2->alias_src);
+	assert_ptr_equal(buf3->alias_src, buf2);
+	assert_ptr_equal(buf3->stream.addr, buf2->stream.addr);
+
+	buffer_free(buf2);
+	assert_null(buf3->alias_src);
+
+	buffer_free(buf3);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_buffer_alias_shares_data),
+		cmocka_unit_test(test_audio_buffer_alias_free_space),
+		cmocka_unit_test(test_audio_buffer_unalias),
+		cmocka_unit_test(test_audio_buffer_alias_set_size),
+		cmocka_unit_test(test_audio_buffer_alias_chain_free)
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -152,6 +152,46 @@ static void test_audio_buffer_copy_fit_no_space_constraint(void **state)
 	buffer_free(snk);
 }
 
+static void test_audio_buffer_copy_inter_core(void **state)
+{
+	int i;
+
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 256
+	};
+
+	struct comp_buffer *buf = buffer_new(&test_buf_desc);
+
+	assert_non_null(buf);
+
+	buf->inter_core = true;
+	assert_true(buffer_is_lock_free(buf));
+
+	/* positions wrap many times, avail and free follow the counters */
+	for (i = 0; i < 100; i++) {
+		comp_update_buffer_produce(buf, 96);
+		assert_int_equal(audio_stream_get_avail_bytes(&buf->stream),
+				 96);
+		assert_int_equal(audio_stream_get_free_bytes(&buf->stream),
+				 160);
+
+		comp_update_buffer_consume(buf, 96);
+		assert_int_equal(audio_stream_get_avail_bytes(&buf->stream), 0);
+		assert_int_equal(audio_stream_get_free_bytes(&buf->stream),
+				 256);
+	}
+
+	assert_ptr_equal(buf->stream.w_ptr, buf->stream.r_ptr);
+
+	/* buffers the source may overrun keep the lock */
+	buf->stream.overrun_permitted = 1;
+	assert_false(buffer_is_lock_free(buf));
+
+	buffer_free(buf);
+}
+
 int main(void)
 {
 	const struct CMUnitTest tests[] = {
@@ -159,7 +199,8 @@ int main(void)
 		cmocka_unit_test(test_audio_buffer_copy_overrun),
 		cmocka_unit_test(test_audio_buffer_copy_success),
 		cmocka_unit_test(test_audio_buffer_copy_fit_space_constraint),
-		cmocka_unit_test(test_audio_buffer_copy_fit_no_space_constraint)
+		cmocka_unit_test(test_audio_buffer_copy_fit_no_space_constraint),
+		cmocka_unit_test(test_audio_buffer_copy_inter_core)
 	};
 
 	cmocka_set_message_output(CM_OUTPUT_TAP);
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+#include <sof/drivers/ipc.h>
+#include <sof/lib/notifier.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+struct notify_result {
+	int count;
+	enum notify_id type;
+	void *begin;
+	uint32_t amount;
+};
+
+static void buffer_notify_cb(void *arg, enum notify_id type, void *data)
+{
+	struct notify_result *result = arg;
+	struct buffer_cb_transact *cb_data = data;
+
+	result->count++;
+	result->type = type;
+	result->begin = cb_data->transaction_begin_address;
+	result->amount = cb_data->transaction_amount;
+}
+
+static void test_audio_buffer_notify_produce_only_if_enabled(void **state)
+{
+	struct notify_result result = { 0 };
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 256
+	};
+	struct comp_buffer *buf = buffer_new(&test_buf_desc);
+	void *begin;
+
+	(void)state;
+
+	assert_non_null(buf);
+	assert_int_equal(buf->cb_type, 0);
+
+	notifier_register(&result, buf, NOTIFIER_ID_BUFFER_PRODUCE,
+			  buffer_notify_cb, 0);
+
+	/* nobody enabled produce events, listener is not called */
+	comp_update_buffer_produce(buf, 10);
+	assert_int_equal(result.count, 0);
+
+	buffer_cb_enable(buf, BUFF_CB_TYPE_PRODUCE);
+
+	begin = buf->stream.w_ptr;
+	comp_update_buffer_produce(buf, 20);
+	assert_int_equal(result.count, 1);
+	assert_int_equal(result.type, NOTIFIER_ID_BUFFER_PRODUCE);
+	assert_ptr_equal(result.begin, begin);
+	assert_int_equal(result.amount, 20);
+
+	/* consume events are still disabled */
+	comp_update_buffer_consume(buf, 30);
+	assert_int_equal(result.count, 1);
+
+	buffer_cb_disable(buf, BUFF_CB_TYPE_PRODUCE);
+
+	comp_update_buffer_produce(buf, 10);
+	assert_int_equal(result.count, 1);
+
+	notifier_unregister(&result, buf, NOTIFIER_ID_BUFFER_PRODUCE);
+	buffer_free(buf);
+}
+
+static void test_audio_buffer_notify_consume(void **state)
+{
+	struct notify_result result = { 0 };
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 256
+	};
+	struct comp_buffer *buf = buffer_new(&test_buf_desc);
+	void *begin;
+
+	(void)state;
+
+	assert_non_null(buf);
+
+	notifier_register(&result, buf, NOTIFIER_ID_BUFFER_CONSUME,
+			  buffer_notify_cb, 0);
+	buffer_cb_enable(buf, BUFF_CB_TYPE_CONSUME);
+
+	comp_update_buffer_produce(buf, 40);
+	assert_int_equal(result.count, 0);
+
+	begin = buf->stream.r_ptr;
+	comp_update_buffer_consume(buf, 40);
+	assert_int_equal(result.count, 1);
+	assert_int_equal(result.type, NOTIFIER_ID_BUFFER_CONSUME);
+	assert_ptr_equal(result.begin, begin);
+	assert_int_equal(result.amount, 40);
+
+	notifier_unregister(&result, buf, NOTIFIER_ID_BUFFER_CONSUME);
+	buffer_free(buf);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test
+			(test_audio_buffer_notify_produce_only_if_enabled),
+		cmocka_unit_test(test_audio_buffer_notify_consume),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+#include <stdint.h>
+#include <sof/audio/buffer.h>
+#include <sof/audio/component_ext.h>
+#include <sof/audio/pipeline.h>
+#include <sof/list.h>
+#include "pipeline_mocks.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <malloc.h>
+#include <cmocka.h>
+
+/* host -> A -> B -> C -> dai, A to C can process in place */
+#define TEST_COMPS		5
+#define TEST_CHANNELS		2
+#define TEST_PERIOD_FRAMES	40
+#define TEST_BUFFER_FRAMES	48
+#define TEST_RUNS		4
+
+struct test_chain {
+	struct pipeline *p;
+	struct comp_dev *dev[TEST_COMPS];
+	struct comp_buffer *buffer[TEST_COMPS - 1];
+	int32_t next;		/* next sample written by host */
+	int32_t expected;	/* next sample expected by dai */
+	uint32_t received;	/* samples received by dai */
+	uint32_t tile_frames;	/* most frames of a single process */
+	bool tiled;		/* processed into a tile instead of a buffer */
+};
+
+static struct test_chain chain;
+
+static int test_host_copy(struct comp_dev *dev)
+{
+	struct comp_buffer *sink = chain.buffer[0];
+	uint32_t frames = MIN(TEST_PERIOD_FRAMES,
+			      audio_stream_get_free_frames(&sink->stream));
+	int32_t *dst;
+	uint32_t i;
+
+	for (i = 0; i < frames * TEST_CHANNELS; i++) {
+		dst = audio_stream_write_frag_s32(&sink->stream, i);
+		*dst = chain.next++;
+	}
+
+	comp_update_buffer_produce(sink,
+				   frames * audio_stream_frame_bytes(&sink->stream));
+
+	return 0;
+}
+
+static int test_dai_copy(struct comp_dev *dev)
+{
+	struct comp_buffer *source = chain.buffer[TEST_COMPS - 2];
+	uint32_t samples = audio_stream_get_avail_samples(&source->stream);
+	int32_t *src;
+	uint32_t i;
+
+	for (i = 0; i < samples; i++) {
+		src = audio_stream_read_frag_s32(&source->stream, i);
+		assert_int_equal(*src, chain.expected);
+		chain.expected++;
+	}
+
+	chain.received += samples;
+	comp_update_buffer_consume(source,
+				   samples * sizeof(int32_t));
+
+	return 0;
+}
+
+/* adds one to each sample */
+static int test_process(struct comp_dev *dev, struct audio_stream *source,
+			struct audio_stream *sink, uint32_t frames)
+{
+	struct comp_buffer *buffer;
+	int32_t *src;
+	int32_t *dst;
+	uint32_t i;
+
+	buffer = list_first_item(&dev->bsink_list, struct comp_buffer,
+				 source_list);
+	if (sink != &buffer->stream)
+		chain.tiled = true;
+
+	chain.tile_frames = MAX(chain.tile_frames, frames);
+
+	for (i = 0; i < frames * TEST_CHANNELS; i++) {
+		src = audio_stream_read_frag_s32(source, i);
+		dst = audio_stream_write_frag_s32(sink, i);
+		*dst = *src + 1;
+	}
+
+	audio_stream_produce(sink, frames * audio_stream_frame_bytes(sink));
+	audio_stream_consume(source, frames * audio_stream_frame_bytes(source));
+
+	return 0;
+}
+
+static int test_copy(struct comp_dev *dev)
+{
+	struct comp_buffer *source;
+	struct comp_buffer *sink;
+	struct comp_copy_limits cl;
+
+	source = list_first_item(&dev->bsource_list, struct comp_buffer,
+				 sink_list);
+	sink = list_first_item(&dev->bsink_list, struct comp_buffer,
+			       source_list);
+
+	comp_get_copy_limits(source, sink, &cl);
+
+	return test_process(dev, &source->stream, &sink->stream, cl.frames);
+}
+
+static const struct comp_driver test_host_drv = {
+	.ops = { .copy = test_host_copy },
+};
+
+static const struct comp_driver test_dai_drv = {
+	.ops = { .copy = test_dai_copy },
+};
+
+static const struct comp_driver test_process_drv = {
+	.ops = { .copy = test_copy, .process = test_process },
+};
+
+static const struct comp_driver test_copy_drv = {
+	.ops = { .copy = test_copy },
+};
+
+static struct comp_buffer *test_buffer_new(struct comp_dev *source,
+					   struct comp_dev *sink)
+{
+	uint32_t size = TEST_BUFFER_FRAMES * TEST_CHANNELS * sizeof(int32_t);
+	struct comp_buffer *buffer = calloc(1, sizeof(*buffer));
+
+	audio_stream_init(&buffer->stream, calloc(1, size), size);
+	buffer->stream.frame_fmt = SOF_IPC_FRAME_S32_LE;
+	buffer->stream.channels = TEST_CHANNELS;
+	buffer->stream.rate = 48000;
+	buffer->pipeline_id = chain.p->ipc_pipe.pipeline_id;
+	buffer->source = source;
+	buffer->sink = sink;
+
+	list_item_append(&buffer->source_list, &source->bsink_list);
+	list_item_append(&buffer->sink_list, &sink->bsource_list);
+
+	return buffer;
+}
+
+/* connects the chain, middle component uses middle_drv */
+static void test_chain_new(const struct comp_driver *middle_drv)
+{
+	struct sof_ipc_pipe_new pipe_desc = { .pipeline_id = 1 };
+	struct comp_dev *dev;
+	int i;
+
+	memset(&chain, 0, sizeof(chain));
+
+	chain.p = pipeline_new(&pipe_desc, NULL);
+	assert_non_null(chain.p);
+
+	for (i = 0; i < TEST_COMPS; i++) {
+		dev = calloc(1, sizeof(*dev));
+		dev->comp.id = i;
+		dev->comp.pipeline_id = pipe_desc.pipeline_id;
+		dev->pipeline = chain.p;
+		dev->state = COMP_STATE_READY;
+		dev->inplace = i > 0 && i < TEST_COMPS - 1;
+		dev->direction = SOF_IPC_STREAM_PLAYBACK;
+		list_init(&dev->bsource_list);
+		list_init(&dev->bsink_list);
+		chain.dev[i] = dev;
+	}
+
+	chain.dev[0]->drv = &test_host_drv;
+	chain.dev[1]->drv = &test_process_drv;
+	chain.dev[2]->drv = middle_drv;
+	chain.dev[3]->drv = &test_process_drv;
+	chain.dev[4]->drv = &test_dai_drv;
+
+	for (i = 0; i < TEST_COMPS - 1; i++)
+		chain.buffer[i] = test_buffer_new(chain.dev[i],
+						  chain.dev[i + 1]);
+
+	chain.p->source_comp = chain.dev[0];
+	chain.p->sink_comp = chain.dev[TEST_COMPS - 1];
+	chain.p->sched_comp = chain.dev[TEST_COMPS - 1];
+}
+
+/* prepares and runs the pipeline task, the dai gets what the host sent
+ * with one added by each of the three processing components
+ */
+static void test_chain_run(void)
+{
+	int i;
+
+	assert_int_equal(pipeline_prepare(chain.p, chain.dev[0]), 0);
+
+	for (i = 0; i < TEST_COMPS; i++)
+		chain.dev[i]->state = COMP_STATE_ACTIVE;
+
+	chain.expected = 3;
+
+	for (i = 0; i < TEST_RUNS; i++)
+		chain.p->pipe_task->ops.run(chain.p->pipe_task->data);
+
+	assert_true(chain.received >= TEST_PERIOD_FRAMES * TEST_CHANNELS);
+}
+
+static void test_audio_pipeline_fuse_inplace_chain(void **state)
+{
+	int i;
+
+	(void)state;
+
+	test_chain_new(&test_process_drv);
+	test_chain_run();
+
+	/* the whole in place capable chain runs in tiles */
+	assert_true(chain.tiled);
+	assert_true(chain.tile_frames <= PPL_FUSE_FRAMES);
+
+	for (i = 0; i < TEST_COMPS - 1; i++) {
+		assert_null(chain.buffer[i]->alias_src);
+		assert_null(chain.buffer[i]->alias_sink);
+	}
+}
+
+static void test_audio_pipeline_fuse_inplace_fallback(void **state)
+{
+	(void)state;
+
+	/* without the process operation in the middle nothing fuses, the
+	 * sink buffers of the in place components are aliased instead
+	 */
+	test_chain_new(&test_copy_drv);
+	test_chain_run();
+
+	assert_false(chain.tiled);
+	assert_ptr_equal(chain.buffer[1]->alias_src, chain.buffer[0]);
+	assert_ptr_equal(chain.buffer[2]->alias_src, chain.buffer[1]);
+	assert_ptr_equal(chain.buffer[3]->alias_src, chain.buffer[2]);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_pipeline_fuse_inplace_chain),
+		cmocka_unit_test(test_audio_pipeline_fuse_inplace_fallback),
+	};
+
+	pipeline_posn_init(sof_get());
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -52,6 +52,10 @@ int schedule_task_init_ll(struct task *task,
 			  uint16_t priority, enum task_state (*run)(void *data),
 			  void *data, uint16_t core, uint32_t flags)
 {
+	/* lets tests run the pipeline task */
+	task->ops.run = run;
+	task->data = data;
+
 	return 0;
 }
 
@@ -130,3 +134,41 @@ int comp_verify_params(struct comp_dev *dev, uint32_t flag,
 	(void)params;
 	return 0;
 }
+
+int buffer_alias(struct comp_buffer *buffer, struct comp_buffer *source)
+{
+	buffer->alias_src = source;
+	source->alias_sink = buffer;
+
+	return 0;
+}
+
+int buffer_unalias(struct comp_buffer *buffer)
+{
+	if (buffer->alias_src)
+		buffer->alias_src->alias_sink = NULL;
+	buffer->alias_src = NULL;
+
+	return 0;
+}
+
+void comp_get_copy_limits(struct comp_buffer *source,
+			  struct comp_buffer *sink,
+			  struct comp_copy_limits *cl)
+{
+	cl->frames = audio_stream_avail_frames(&source->stream, &sink->stream);
+	cl->source_frame_bytes = audio_stream_frame_bytes(&source->stream);
+	cl->sink_frame_bytes = audio_stream_frame_bytes(&sink->stream);
+	cl->source_bytes = cl->frames * cl->source_frame_bytes;
+	cl->sink_bytes = cl->frames * cl->sink_frame_bytes;
+}
+
+void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
+{
+	audio_stream_produce(&buffer->stream, bytes);
+}
+
+void comp_update_buffer_consume(struct comp_buffer *buffer, uint32_t bytes)
+{
+	audio_stream_consume(&buffer->stream, bytes);
+}
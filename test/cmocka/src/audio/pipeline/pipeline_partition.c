@@ -0,0 +1,167 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+#include <stdint.h>
+#include <sof/audio/component_ext.h>
+#include <sof/audio/pipeline.h>
+#include <sof/bit.h>
+#include <sof/drivers/ipc.h>
+#include "pipeline_mocks.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+struct comp_dev *comp_make_shared(struct comp_dev *dev)
+{
+	dev->is_shared = true;
+
+	return dev;
+}
+
+static void test_audio_pipeline_partition_single_core(void **state)
+{
+	uint32_t load[] = { 25, 12, 20 };
+	uint32_t core_load[PLATFORM_CORE_COUNT] = { 2 };
+	uint32_t comp_core[ARRAY_SIZE(load)];
+
+	(void)state;
+
+	pipeline_partition_plan(load, ARRAY_SIZE(load), core_load, BIT(0), 0,
+				comp_core);
+
+	assert_int_equal(comp_core[0], 0);
+	assert_int_equal(comp_core[1], 0);
+	assert_int_equal(comp_core[2], 0);
+	assert_int_equal(core_load[0], 59);
+}
+
+#if PLATFORM_CORE_COUNT > 1
+static void test_audio_pipeline_partition_two_cores(void **state)
+{
+	uint32_t load[] = { 25, 12, 20 };
+	uint32_t core_load[PLATFORM_CORE_COUNT] = { 2 };
+	uint32_t comp_core[ARRAY_SIZE(load)];
+
+	(void)state;
+
+	pipeline_partition_plan(load, ARRAY_SIZE(load), core_load,
+				BIT(0) | BIT(1), 0, comp_core);
+
+	/* one cut, the rest of the chain stays on the second core */
+	assert_int_equal(comp_core[0], 0);
+	assert_int_equal(comp_core[1], 1);
+	assert_int_equal(comp_core[2], 1);
+	assert_int_equal(core_load[0], 27);
+	assert_int_equal(core_load[1], 32);
+}
+
+static void test_audio_pipeline_partition_light_chain(void **state)
+{
+	uint32_t load[] = { 1, 2, 1 };
+	uint32_t core_load[PLATFORM_CORE_COUNT] = { 2, 30 };
+	uint32_t comp_core[ARRAY_SIZE(load)];
+
+	(void)state;
+
+	/* the other core is busier, nothing moves there */
+	pipeline_partition_plan(load, ARRAY_SIZE(load), core_load,
+				BIT(0) | BIT(1), 0, comp_core);
+
+	assert_int_equal(comp_core[0], 0);
+	assert_int_equal(comp_core[1], 0);
+	assert_int_equal(comp_core[2], 0);
+	assert_int_equal(core_load[1], 30);
+}
+#endif
+
+#if PLATFORM_CORE_COUNT > 2
+static void test_audio_pipeline_partition_return_to_start(void **state)
+{
+	uint32_t load[] = { 25, 12, 20 };
+	uint32_t core_load[PLATFORM_CORE_COUNT] = { 2 };
+	uint32_t comp_core[ARRAY_SIZE(load)];
+
+	(void)state;
+
+	pipeline_partition_plan(load, ARRAY_SIZE(load), core_load,
+				BIT(0) | BIT(1) | BIT(2), 0, comp_core);
+
+	/* last segment goes back to the core running the sink */
+	assert_int_equal(comp_core[0], 1);
+	assert_int_equal(comp_core[1], 2);
+	assert_int_equal(comp_core[2], 0);
+	assert_int_equal(core_load[0], 22);
+	assert_int_equal(core_load[1], 25);
+	assert_int_equal(core_load[2], 12);
+}
+#endif
+
+#if PLATFORM_CORE_COUNT > 2
+/* adds component of pipeline p running on core to the ipc list */
+static void test_audio_pipeline_partition_add(struct ipc *ipc,
+					      struct ipc_comp_dev *icd,
+					      struct comp_dev *dev,
+					      struct pipeline *p,
+					      uint32_t core)
+{
+	dev->pipeline = p;
+	icd->type = COMP_TYPE_COMPONENT;
+	icd->core = core;
+	icd->cd = dev;
+	list_item_append(&icd->list, &ipc->comp_list);
+}
+
+static void test_audio_pipeline_partition_core_busy(void **state)
+{
+	struct ipc ipc = { 0 };
+	struct pipeline p0 = { 0 };
+	struct pipeline p2 = { 0 };
+	struct comp_dev dev[3] = { 0 };
+	struct ipc_comp_dev icd[3] = { 0 };
+
+	(void)state;
+
+	list_init(&ipc.comp_list);
+	sof_get()->ipc = &ipc;
+
+	p2.ipc_pipe.core = 2;
+
+	/* second component of p0 moved to core 1, p2 placed on core 2 */
+	test_audio_pipeline_partition_add(&ipc, &icd[0], &dev[0], &p0, 0);
+	test_audio_pipeline_partition_add(&ipc, &icd[1], &dev[1], &p0, 1);
+	test_audio_pipeline_partition_add(&ipc, &icd[2], &dev[2], &p2, 2);
+
+	/* host may power down only cores it placed everything on */
+	assert_false(pipeline_partition_core_busy(0));
+	assert_true(pipeline_partition_core_busy(1));
+	assert_false(pipeline_partition_core_busy(2));
+	assert_false(pipeline_partition_core_busy(3));
+
+	/* core is released with the moved component */
+	list_item_del(&icd[1].list);
+	assert_false(pipeline_partition_core_busy(1));
+
+	sof_get()->ipc = NULL;
+}
+#endif
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_pipeline_partition_single_core),
+#if PLATFORM_CORE_COUNT > 1
+		cmocka_unit_test(test_audio_pipeline_partition_two_cores),
+		cmocka_unit_test(test_audio_pipeline_partition_light_chain),
+#endif
+#if PLATFORM_CORE_COUNT > 2
+		cmocka_unit_test(test_audio_pipeline_partition_return_to_start),
+		cmocka_unit_test(test_audio_pipeline_partition_core_busy),
+#endif
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
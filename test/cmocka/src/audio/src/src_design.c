@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <errno.h>
+#include <math.h>
+#include <cmocka.h>
+
+#include <sof/audio/src/src.h>
+#include <sof/audio/src/src_config.h>
+#include <sof/audio/src/src_design.h>
+
+#if SRC_SHORT
+static int16_t coefs[SRC_DESIGN_MAX_LENGTH];
+#define COEF_ONE	32768.0
+#else
+static int32_t coefs[SRC_DESIGN_MAX_LENGTH];
+#define COEF_ONE	2147483648.0
+#endif
+
+static void test_audio_src_design_stages(void **state)
+{
+	struct src_design_stage s1;
+	struct src_design_stage s2;
+
+	(void)state;
+
+	assert_int_equal(src_design(44100, 16000, &s1, &s2), 0);
+
+	/* 160/441 as 10/21 x 16/21 */
+	assert_int_equal(s1.l, 10);
+	assert_int_equal(s1.m, 21);
+	assert_int_equal(s2.l, 16);
+	assert_int_equal(s2.m, 21);
+	assert_int_equal(s1.filter_length % (4 * s1.l), 0);
+	assert_int_equal(s2.filter_length % (4 * s2.l), 0);
+	assert_int_equal(s1.subfilter_length * s1.l, s1.filter_length);
+	assert_int_equal(s2.subfilter_length * s2.l, s2.filter_length);
+	assert_int_equal(-s1.idm * s1.l + s1.odm * s1.m, 1);
+	assert_int_equal(-s2.idm * s2.l + s2.odm * s2.m, 1);
+}
+
+static void test_audio_src_design_single_stage(void **state)
+{
+	struct src_design_stage s1;
+	struct src_design_stage s2;
+
+	(void)state;
+
+	assert_int_equal(src_design(48000, 16000, &s1, &s2), 0);
+
+	assert_int_equal(s1.l, 1);
+	assert_int_equal(s1.m, 3);
+	assert_int_equal(s2.filter_length, 1);
+}
+
+static void test_audio_src_design_coefs(void **state)
+{
+	struct src_design_stage s1;
+	struct src_design_stage s2;
+	double dc = 0;
+	double peak = 0;
+	int shift;
+	int i;
+
+	(void)state;
+
+	assert_int_equal(src_design(37800, 48000, &s1, &s2), 0);
+
+	shift = src_design_coefs(&s1, coefs);
+	assert_true(shift >= -1);
+
+	for (i = 0; i < s1.filter_length; i++) {
+		assert_int_equal(coefs[i], coefs[s1.filter_length - 1 - i]);
+		dc += coefs[i];
+		peak = fmax(peak, fabs(coefs[i]));
+	}
+
+	/* DC gain of l with the -0.5 dB of a stage in a two stage design */
+	dc = dc / COEF_ONE / ldexp(1.0, shift);
+	assert_true(fabs(dc / s1.l - pow(10, -0.5 / 20)) < 0.001);
+	assert_true(peak < COEF_ONE);
+}
+
+static void test_audio_src_design_invalid(void **state)
+{
+	struct src_design_stage s1;
+	struct src_design_stage s2;
+
+	(void)state;
+
+	/* Subfilter count beyond the length limit */
+	assert_int_equal(src_design(48000, 47999, &s1, &s2), -EINVAL);
+	assert_int_equal(src_design(0, 48000, &s1, &s2), -EINVAL);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_src_design_stages),
+		cmocka_unit_test(test_audio_src_design_single_stage),
+		cmocka_unit_test(test_audio_src_design_coefs),
+		cmocka_unit_test(test_audio_src_design_invalid),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
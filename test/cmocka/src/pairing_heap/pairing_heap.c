@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+#include <sof/pairing_heap.h>
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+#define TEST_ITEMS	64
+
+static uint64_t test_key(int i)
+{
+	/* all keys distinct, visited out of order */
+	return (i * 37) % TEST_ITEMS;
+}
+
+static void test_pheap_empty(void **state)
+{
+	struct pheap heap;
+
+	(void)state;
+
+	pheap_init(&heap);
+
+	assert_true(pheap_is_empty(&heap));
+	assert_null(pheap_first(&heap));
+}
+
+static void test_pheap_insert_first(void **state)
+{
+	struct pheap_item items[TEST_ITEMS];
+	struct pheap heap;
+	int i;
+
+	(void)state;
+
+	pheap_init(&heap);
+
+	for (i = 0; i < TEST_ITEMS; i++) {
+		items[i].key = test_key(i);
+		pheap_insert(&heap, &items[i]);
+	}
+
+	assert_false(pheap_is_empty(&heap));
+
+	/* items leave in key order */
+	for (i = 0; i < TEST_ITEMS; i++) {
+		assert_int_equal(pheap_first(&heap)->key, i);
+		pheap_del(&heap, pheap_first(&heap));
+	}
+
+	assert_true(pheap_is_empty(&heap));
+}
+
+static void test_pheap_del_any(void **state)
+{
+	struct pheap_item items[TEST_ITEMS];
+	struct pheap heap;
+	int i;
+
+	(void)state;
+
+	pheap_init(&heap);
+
+	for (i = 0; i < TEST_ITEMS; i++) {
+		items[i].key = test_key(i);
+		pheap_insert(&heap, &items[i]);
+	}
+
+	/* pop the first item, so the rest are linked below the root */
+	pheap_del(&heap, pheap_first(&heap));
+
+	/* remove items with odd keys from inside the heap */
+	for (i = 0; i < TEST_ITEMS; i++)
+		if (items[i].key & 1)
+			pheap_del(&heap, &items[i]);
+
+	for (i = 2; i < TEST_ITEMS; i += 2) {
+		assert_int_equal(pheap_first(&heap)->key, i);
+		pheap_del(&heap, pheap_first(&heap));
+	}
+
+	assert_true(pheap_is_empty(&heap));
+}
+
+static void test_pheap_equal_keys(void **state)
+{
+	struct pheap_item items[TEST_ITEMS];
+	struct pheap heap;
+	int i;
+
+	(void)state;
+
+	pheap_init(&heap);
+
+	for (i = 0; i < TEST_ITEMS; i++) {
+		items[i].key = i & 3;
+		pheap_insert(&heap, &items[i]);
+	}
+
+	for (i = 0; i < TEST_ITEMS; i++) {
+		assert_int_equal(pheap_first(&heap)->key, i / (TEST_ITEMS / 4));
+		pheap_del(&heap, pheap_first(&heap));
+	}
+
+	assert_true(pheap_is_empty(&heap));
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_pheap_empty),
+		cmocka_unit_test(test_pheap_insert_first),
+		cmocka_unit_test(test_pheap_del_any),
+		cmocka_unit_test(test_pheap_equal_keys),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -13,6 +13,8 @@
 #include <errno.h>
 #include <unistd.h>
 #include <math.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sof/lib/uuid.h>
 #include <user/abi_dbg.h>
 #include <user/trace.h>
@@ -29,6 +31,10 @@
 #define TRACE_IDS_MASK			((1 << TRACE_ID_LENGTH) - 1)
 #define INVALID_TRACE_ID		(-1 & TRACE_IDS_MASK)
 
+/* number of buckets in the decoded ldc entry cache, must be a power of 2 */
+#define LDC_CACHE_HASH_BITS		12
+#define LDC_CACHE_HASH_SIZE		(1 << LDC_CACHE_HASH_BITS)
+
 struct ldc_entry_header {
 	uint32_t level;
 	uint32_t component_class;
@@ -38,21 +44,25 @@ struct ldc_entry_header {
 	uint32_t text_len;
 };
 
+/* dictionary entry decoded once and cached by its log entry address */
 struct ldc_entry {
 	struct ldc_entry_header header;
-	char *file_name;
-	char *text;
-	uint32_t *params;
+	uint32_t address;
+	char *file_name;	/* location shortened for printing */
+	char *text;		/* format with %pU rewritten to %s */
+	unsigned int subst_mask;	/* params to print as uuid */
+	unsigned int be;		/* big endian uuid params */
+	unsigned int upper;		/* upper case uuid params */
+	struct ldc_entry *next;		/* next entry in hash bucket */
 };
 
 struct proc_ldc_entry {
 	int subst_mask;
-	struct ldc_entry_header header;
-	char *file_name;
-	char *text;
 	uintptr_t params[TRACE_MAX_PARAMS_COUNT];
 };
 
+static struct ldc_entry *ldc_cache[LDC_CACHE_HASH_SIZE];
+
 static const char *BAD_PTR_STR = "<bad uid ptr %x>";
 
 #define UUID_LOWER "%s%s%s<%08x-%04x-%04x-%02x%02x-%02x%02x%02x%02x%02x%02x>%s%s%s"
@@ -131,19 +141,12 @@ static const char *format_uid(uint32_t uid_ptr, int use_colors, bool be, bool up
 	return str;
 }
 
-static void process_params(struct proc_ldc_entry *pe,
-			   const struct ldc_entry *e,
-			   int use_colors)
+/* find %pU uuid conversions once, when the entry is decoded */
+static void parse_format(struct ldc_entry *e)
 {
 	char *p = e->text;
 	const char *t_end = p + strlen(e->text);
-	unsigned int par_bit = 1, be = 0, upper = 0;
-	int i;
-
-	pe->subst_mask = 0;
-	pe->header =  e->header;
-	pe->file_name = e->file_name;
-	pe->text = e->text;
+	unsigned int par_bit = 1;
 
 	/*
 	 * Scan the text for possible replacements. We follow the Linux kernel
@@ -155,23 +158,23 @@ static void process_params(struct proc_ldc_entry *pe,
 			unsigned int skip;
 			char *s = p + 2;
 
-			pe->subst_mask += par_bit;
+			e->subst_mask += par_bit;
 			p[1] = 's';
 			switch (p[2]) {
 			case 'b':
-				be |= par_bit;
+				e->be |= par_bit;
 				skip = 2;
 				break;
 			case 'B':
-				be |= par_bit;
-				upper |= par_bit;
+				e->be |= par_bit;
+				e->upper |= par_bit;
 				skip = 2;
 				break;
 			case 'l':
 				skip = 2;
 				break;
 			case 'L':
-				upper |= par_bit;
+				e->upper |= par_bit;
 				skip = 2;
 				break;
 			default:
@@ -191,13 +194,23 @@ static void process_params(struct proc_ldc_entry *pe,
 			par_bit <<= 1;
 		}
 	}
+}
+
+static void process_params(struct proc_ldc_entry *pe,
+			   const struct ldc_entry *e,
+			   const uint32_t *params,
+			   int use_colors)
+{
+	int i;
+
+	pe->subst_mask = e->subst_mask;
 
 	for (i = 0; i < e->header.params_num; i++) {
-		pe->params[i] = e->params[i];
+		pe->params[i] = params[i];
 		if (pe->subst_mask & (1 << i))
-			pe->params[i] = (uintptr_t)format_uid(e->params[i], use_colors,
-							      (be >> i) & 1,
-							      (upper >> i) & 1);
+			pe->params[i] = (uintptr_t)format_uid(params[i], use_colors,
+							      (e->be >> i) & 1,
+							      (e->upper >> i) & 1);
 	}
 }
 
@@ -311,7 +324,8 @@ static char *format_file_name(char *file_name_raw, int full_name)
 }
 
 static void print_entry_params(const struct log_entry_header *dma_log,
-			       const struct ldc_entry *entry, uint64_t last_timestamp)
+			       const struct ldc_entry *entry, const uint32_t *params,
+			       uint64_t last_timestamp)
 {
 	FILE *out_fd = global_config->out_fd;
 	int use_colors = global_config->use_colors;
@@ -356,8 +370,7 @@ static void print_entry_params(const struct log_entry_header *dma_log,
 			fprintf(out_fd, time_fmt, to_usecs(dma_log->timestamp), dt);
 		if (!hide_location)
 			fprintf(out_fd, "(%s:%u) ",
-				format_file_name(entry->file_name, raw_output),
-				entry->header.line_idx);
+				entry->file_name, entry->header.line_idx);
 	} else {
 		/* timestamp */
 		/* 64bits yields less than 20 digits precision. As
@@ -388,8 +401,7 @@ static void print_entry_params(const struct log_entry_header *dma_log,
 		/* location */
 		if (!hide_location)
 			fprintf(out_fd, "%24s:%-4u ",
-				format_file_name(entry->file_name, raw_output),
-				entry->header.line_idx);
+				entry->file_name, entry->header.line_idx);
 
 		/* level name */
 		fprintf(out_fd, "%s%s",
@@ -397,24 +409,24 @@ static void print_entry_params(const struct log_entry_header *dma_log,
 			get_level_name(entry->header.level));
 	}
 
-	process_params(&proc_entry, entry, use_colors);
+	process_params(&proc_entry, entry, params, use_colors);
 
-	switch (proc_entry.header.params_num) {
+	switch (entry->header.params_num) {
 	case 0:
-		fprintf(out_fd, "%s", proc_entry.text);
+		fprintf(out_fd, "%s", entry->text);
 		break;
 	case 1:
-		fprintf(out_fd, proc_entry.text, proc_entry.params[0]);
+		fprintf(out_fd, entry->text, proc_entry.params[0]);
 		break;
 	case 2:
-		fprintf(out_fd, proc_entry.text, proc_entry.params[0], proc_entry.params[1]);
+		fprintf(out_fd, entry->text, proc_entry.params[0], proc_entry.params[1]);
 		break;
 	case 3:
-		fprintf(out_fd, proc_entry.text, proc_entry.params[0], proc_entry.params[1],
+		fprintf(out_fd, entry->text, proc_entry.params[0], proc_entry.params[1],
 			proc_entry.params[2]);
 		break;
 	case 4:
-		fprintf(out_fd, proc_entry.text, proc_entry.params[0], proc_entry.params[1],
+		fprintf(out_fd, entry->text, proc_entry.params[0], proc_entry.params[1],
 			proc_entry.params[2], proc_entry.params[3]);
 		break;
 	}
@@ -423,139 +435,166 @@ static void print_entry_params(const struct log_entry_header *dma_log,
 	fflush(out_fd);
 }
 
-static int read_entry_from_ldc_file(struct ldc_entry *entry, uint32_t log_entry_address)
+static inline uint32_t ldc_cache_hash(uint32_t log_entry_address)
+{
+	/* Fibonacci hashing spreads the variable sized entry offsets */
+	return (log_entry_address * 2654435761u) >> (32 - LDC_CACHE_HASH_BITS);
+}
+
+static void free_ldc_entry(struct ldc_entry *entry)
+{
+	free(entry->text);
+	free(entry->file_name);
+	free(entry);
+}
+
+static int read_entry_from_ldc_file(struct ldc_entry **entry, uint32_t log_entry_address)
 {
 	uint32_t base_address = global_config->logs_header->base_address;
 	uint32_t data_offset = global_config->logs_header->data_offset;
+	const char *ldc_map = global_config->ldc_map;
+	struct ldc_entry *e;
+	const char *name;
+	char *file_name;
 
-	int ret;
+	/* evaluate entry offset in mapped input file */
+	size_t entry_offset = (size_t)(log_entry_address - base_address) + data_offset;
 
-	/* evaluate entry offset in input file */
-	uint32_t entry_offset = (log_entry_address - base_address) + data_offset;
+	if (entry_offset + sizeof(e->header) > global_config->ldc_map_size) {
+		log_err("Invalid log entry address 0x%x\n", log_entry_address);
+		return -EINVAL;
+	}
 
-	entry->file_name = NULL;
-	entry->text = NULL;
-	entry->params = NULL;
+	e = calloc(1, sizeof(*e));
+	if (!e) {
+		log_err("can't allocate %d byte for ldc entry\n", (int)sizeof(*e));
+		return -ENOMEM;
+	}
+	e->address = log_entry_address;
 
-	/* set file position to beginning of processed entry */
-	fseek(global_config->ldc_fd, entry_offset, SEEK_SET);
+	/* fetching elf header params, entries are 32-bit aligned */
+	e->header = *(const struct ldc_entry_header *)(ldc_map + entry_offset);
+	entry_offset += sizeof(e->header);
 
-	/* fetching elf header params */
-	ret = fread(&entry->header, sizeof(entry->header), 1, global_config->ldc_fd);
-	if (!ret) {
-		ret = -ferror(global_config->ldc_fd);
-		goto out;
-	}
-	if (entry->header.file_name_len > TRACE_MAX_FILENAME_LEN) {
+	if (e->header.file_name_len > TRACE_MAX_FILENAME_LEN) {
 		log_err("Invalid filename length or ldc file does not match firmware\n");
-		ret = -EINVAL;
-		goto out;
+		goto err;
 	}
-	entry->file_name = (char *)malloc(entry->header.file_name_len);
-
-	if (!entry->file_name) {
-		log_err("can't allocate %d byte for entry.file_name\n",
-			entry->header.file_name_len);
-		ret = -ENOMEM;
-		goto out;
+	if (e->header.text_len > TRACE_MAX_TEXT_LEN) {
+		log_err("Invalid text length.\n");
+		goto err;
 	}
-
-	ret = fread(entry->file_name, sizeof(char), entry->header.file_name_len,
-		    global_config->ldc_fd);
-	if (ret != entry->header.file_name_len) {
-		ret = -ferror(global_config->ldc_fd);
-		goto out;
+	if (e->header.params_num > TRACE_MAX_PARAMS_COUNT) {
+		log_err("Invalid number of parameters.\n");
+		goto err;
+	}
+	if (entry_offset + e->header.file_name_len + e->header.text_len >
+	    global_config->ldc_map_size) {
+		log_err("Log entry at 0x%x exceeds ldc file\n", log_entry_address);
+		goto err;
 	}
 
+	/* location is formatted once, the mapping itself is read only */
+	file_name = strndup(ldc_map + entry_offset, e->header.file_name_len);
+	entry_offset += e->header.file_name_len;
+	if (!file_name)
+		goto err_mem;
+	name = format_file_name(file_name, global_config->raw_output);
+	e->file_name = strdup(name);
+	free(file_name);
+
 	/* fetching text */
-	if (entry->header.text_len > TRACE_MAX_TEXT_LEN) {
-		log_err("Invalid text length.\n");
-		ret = -EINVAL;
-		goto out;
-	}
-	entry->text = (char *)malloc(entry->header.text_len);
-	if (!entry->text) {
-		log_err("can't allocate %d byte for entry.text\n", entry->header.text_len);
-		ret = -ENOMEM;
-		goto out;
-	}
-	ret = fread(entry->text, sizeof(char), entry->header.text_len, global_config->ldc_fd);
-	if (ret != entry->header.text_len) {
-		ret = -ferror(global_config->ldc_fd);
-		goto out;
+	e->text = strndup(ldc_map + entry_offset, e->header.text_len);
+	if (!e->file_name || !e->text)
+		goto err_mem;
+
+	parse_format(e);
+
+	*entry = e;
+	return 0;
+
+err_mem:
+	log_err("can't allocate memory for ldc entry at 0x%x\n", log_entry_address);
+	free_ldc_entry(e);
+	return -ENOMEM;
+err:
+	free_ldc_entry(e);
+	return -EINVAL;
+}
+
+/* decoded entries are looked up by address, the dictionary is parsed once */
+static int get_ldc_entry(const struct ldc_entry **entry, uint32_t log_entry_address)
+{
+	uint32_t hash = ldc_cache_hash(log_entry_address);
+	struct ldc_entry *e;
+	int ret;
+
+	for (e = ldc_cache[hash]; e; e = e->next) {
+		if (e->address == log_entry_address) {
+			*entry = e;
+			return 0;
+		}
 	}
 
+	ret = read_entry_from_ldc_file(&e, log_entry_address);
+	if (ret < 0)
+		return ret;
+
+	e->next = ldc_cache[hash];
+	ldc_cache[hash] = e;
+	*entry = e;
+
 	return 0;
+}
 
-out:
-	free(entry->text);
-	entry->text = NULL;
-	free(entry->file_name);
-	entry->file_name = NULL;
+static void free_ldc_cache(void)
+{
+	struct ldc_entry *e;
+	int i;
 
-	return ret;
+	for (i = 0; i < LDC_CACHE_HASH_SIZE; i++) {
+		while (ldc_cache[i]) {
+			e = ldc_cache[i];
+			ldc_cache[i] = e->next;
+			free_ldc_entry(e);
+		}
+	}
 }
 
 static int fetch_entry(const struct log_entry_header *dma_log, uint64_t *last_timestamp)
 {
-	struct ldc_entry entry;
+	uint32_t params[TRACE_MAX_PARAMS_COUNT];
+	const struct ldc_entry *entry;
 	int ret;
 
-	ret = read_entry_from_ldc_file(&entry, dma_log->log_entry_address);
+	ret = get_ldc_entry(&entry, dma_log->log_entry_address);
 	if (ret < 0)
-		goto out;
+		return ret;
 
 	/* fetching entry params from dma dump */
-	if (entry.header.params_num > TRACE_MAX_PARAMS_COUNT) {
-		log_err("Invalid number of parameters.\n");
-		ret = -EINVAL;
-		goto out;
-	}
-	entry.params = (uint32_t *)malloc(sizeof(uint32_t) * entry.header.params_num);
-	if (!entry.params) {
-		log_err("can't allocate %d byte for entry.params\n",
-			(int)(sizeof(uint32_t) * entry.header.params_num));
-		ret = -ENOMEM;
-		goto out;
-	}
-
 	if (global_config->serial_fd < 0) {
-		ret = fread(entry.params, sizeof(uint32_t), entry.header.params_num,
+		ret = fread(params, sizeof(uint32_t), entry->header.params_num,
 			    global_config->in_fd);
-		if (ret != entry.header.params_num) {
-			ret = -ferror(global_config->in_fd);
-			goto out;
-		}
+		if (ret != entry->header.params_num)
+			return -ferror(global_config->in_fd);
 	} else {
-		size_t size = sizeof(uint32_t) * entry.header.params_num;
+		size_t size = sizeof(uint32_t) * entry->header.params_num;
 		uint8_t *n;
 
-		for (n = (uint8_t *)entry.params; size; n += ret, size -= ret) {
+		for (n = (uint8_t *)params; size; n += ret, size -= ret) {
 			ret = read(global_config->serial_fd, n, size);
-			if (ret < 0) {
-				ret = -errno;
-				goto out;
-			}
+			if (ret < 0)
+				return -errno;
 			if (ret != size)
 				log_err("Partial read of %u bytes of %lu.\n", ret, size);
 		}
 	}
 
 	/* printing entry content */
-	print_entry_params(dma_log, &entry, *last_timestamp);
+	print_entry_params(dma_log, entry, params, *last_timestamp);
 	*last_timestamp = dma_log->timestamp;
 
-	/* set f_ldc file position to the beginning */
-	rewind(global_config->ldc_fd);
-
-	ret = 0;
-out:
-	/* free alocated memory */
-	free(entry.params);
-	free(entry.text);
-	free(entry.file_name);
-
-	return ret;
+	return 0;
 }
 
 static int serial_read(uint64_t *last_timestamp)
@@ -746,6 +785,7 @@ int convert(struct convert_config *config)
 {
 	struct snd_sof_logs_header snd;
 	struct snd_sof_uids_header uids_hdr;
+	struct stat st;
 	int count, ret = 0;
 
 	config->logs_header = &snd;
@@ -818,5 +858,25 @@ int convert(struct convert_config *config)
 		}
 	}
 
-	return logger_read();
+	/* map the dictionary once, log entries are decoded from the mapping */
+	if (fstat(fileno(config->ldc_fd), &st) < 0) {
+		log_err("failed to stat %s.\n", config->ldc_file);
+		return -errno;
+	}
+	config->ldc_map_size = st.st_size;
+	config->ldc_map = mmap(NULL, config->ldc_map_size, PROT_READ, MAP_PRIVATE,
+			       fileno(config->ldc_fd), 0);
+	if (config->ldc_map == MAP_FAILED) {
+		log_err("failed to map %s.\n", config->ldc_file);
+		config->ldc_map = NULL;
+		return -errno;
+	}
+
+	ret = logger_read();
+
+	free_ldc_cache();
+	munmap(config->ldc_map, config->ldc_map_size);
+	config->ldc_map = NULL;
+
+	return ret;
 }
@@ -30,6 +30,8 @@ struct convert_config {
 	int trace;
 	const char *ldc_file;
 	FILE* ldc_fd;
+	void *ldc_map;
+	size_t ldc_map_size;
 	char *filter_config;
 	int input_std;
 	int version_fw;
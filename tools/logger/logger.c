@@ -175,6 +175,8 @@ int main(int argc, char *argv[])
 	config.in_fd = NULL;
 	config.ldc_file = NULL;
 	config.ldc_fd = NULL;
+	config.ldc_map = NULL;
+	config.ldc_map_size = 0;
 	config.input_std = 0;
 	/* checking fw version is disabled by default */
 	config.version_file = "/sys/kernel/debug/sof/fw_version";
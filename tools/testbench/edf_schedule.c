@@ -9,7 +9,10 @@
 #include <stdint.h>
 #include <sof/schedule/edf_schedule.h>
 #include <sof/lib/wait.h>
+#include <sof/pairing_heap.h>
+#include <errno.h>
 #include <stdlib.h>
+#include <pthread.h>
 
  /* scheduler testbench definition */
 
@@ -20,8 +23,9 @@ DECLARE_SOF_UUID("edf-schedule", edf_sched_uuid, 0x77de2074, 0x828c, 0x4044,
 DECLARE_TR_CTX(edf_tr, SOF_UUID(edf_sched_uuid), LOG_LEVEL_INFO);
 
 struct edf_schedule_data {
-	struct list_item list; /* list of tasks in priority queue */
+	struct pheap queue; /* queued tasks by deadline */
 	uint32_t clock;
+	pthread_mutex_t lock; /* tasks may be scheduled from worker threads */
 };
 
 struct scheduler_ops schedule_edf_ops;
@@ -30,8 +34,14 @@ static struct edf_schedule_data *sch;
 
 static int schedule_edf_task_complete(struct task *task)
 {
-	list_item_del(&task->list);
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
+
+	pthread_mutex_lock(&sch->lock);
+	/* task may have been cancelled while running */
+	if (task->state == SOF_TASK_STATE_QUEUED)
+		pheap_del(&sch->queue, &edf_pdata->item);
 	task->state = SOF_TASK_STATE_COMPLETED;
+	pthread_mutex_unlock(&sch->lock);
 
 	return 0;
 }
@@ -41,9 +51,14 @@ static int schedule_edf_task(void *data, struct task *task, uint64_t start,
 			      uint64_t period)
 {
 	struct edf_schedule_data *sch = data;
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
 	(void)period;
-	list_item_prepend(&task->list, &sch->list);
+	pthread_mutex_lock(&sch->lock);
+	edf_pdata->item.key = task->ops.get_deadline ?
+		task_get_deadline(task) : SOF_TASK_DEADLINE_IDLE;
+	pheap_insert(&sch->queue, &edf_pdata->item);
 	task->state = SOF_TASK_STATE_QUEUED;
+	pthread_mutex_unlock(&sch->lock);
 
 	if (task->ops.run)
 		task->ops.run(task->data);
@@ -57,18 +72,16 @@ int schedule_task_init_edf(struct task *task, const struct sof_uuid_entry *uid,
 			   const struct task_ops *ops, void *data,
 			   uint16_t core, uint32_t flags)
 {
-	struct edf_task_pdata *edf_pdata;
 	int ret = 0;
 
+	/* allocates EDF private data of the task */
 	ret = schedule_task_init(task, uid, SOF_SCHEDULE_EDF, 0, ops->run,
 				 data, core, flags);
 	if (ret < 0)
 		return ret;
 
-	edf_pdata = malloc(sizeof(*edf_pdata));
-	edf_sch_set_pdata(task, edf_pdata);
-
 	task->ops.complete = ops->complete;
+	task->ops.get_deadline = ops->get_deadline;
 
 	return 0;
 }
@@ -78,7 +91,8 @@ int scheduler_init_edf(void)
 {
 	tr_info(&edf_tr, "edf_scheduler_init()");
 	sch = malloc(sizeof(*sch));
-	list_init(&sch->list);
+	pheap_init(&sch->queue);
+	pthread_mutex_init(&sch->lock, NULL);
 
 	scheduler_init(SOF_SCHEDULE_EDF, &schedule_edf_ops, sch);
 
@@ -87,6 +101,9 @@ int scheduler_init_edf(void)
 
 static void edf_scheduler_free(void *data)
 {
+	struct edf_schedule_data *sch = data;
+
+	pthread_mutex_destroy(&sch->lock);
 	free(data);
 }
 
@@ -97,11 +114,15 @@ static void schedule_edf(void *data)
 
 static int schedule_edf_task_cancel(void *data, struct task *task)
 {
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
+
+	pthread_mutex_lock(&sch->lock);
 	if (task->state == SOF_TASK_STATE_QUEUED) {
 		/* delete task */
 		task->state = SOF_TASK_STATE_CANCEL;
-		list_item_del(&task->list);
+		pheap_del(&sch->queue, &edf_pdata->item);
 	}
+	pthread_mutex_unlock(&sch->lock);
 
 	return 0;
 }
@@ -7,8 +7,12 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sof/sof.h>
 #include <sof/list.h>
 #include <sof/audio/stream.h>
@@ -29,310 +33,340 @@ DECLARE_TR_CTX(file_tr, SOF_UUID(file_uuid), LOG_LEVEL_INFO);
 static const struct comp_driver comp_file_dai;
 static const struct comp_driver comp_file_host;
 
-static inline void buffer_check_wrap_32(int32_t **ptr, int32_t *end,
-					size_t size)
+/* size of stdio read buffer for text input files */
+#define FILE_TEXT_BUF_SIZE	65536
+
+/* longest text sample is "-2147483648\n" */
+#define FILE_TEXT_SAMPLE_MAX	12
+
+/* samples converted at once when writing text or 24-bit raw output */
+#define FILE_WRITE_CHUNK	256
+
+/* initial size and minimum growth of memory mapped output file */
+#define FILE_MAP_GROW_SIZE	(1024 * 1024)
+
+/* reads up to size bytes of raw data from input file */
+static size_t file_read_bytes(struct file_state *fs, void *data, size_t size)
 {
-	if (*ptr >= end)
-		*ptr = (int32_t *)((size_t)*ptr - size);
+	if (!fs->map)
+		return fread(data, 1, size, fs->rfh);
+
+	size = MIN(size, fs->map_size - fs->map_pos);
+	if (memcpy_s(data, size, (char *)fs->map + fs->map_pos, size))
+		return 0;
+	fs->map_pos += size;
+
+	return size;
 }
 
-static inline void buffer_check_wrap_16(int16_t **ptr, int16_t *end,
-					size_t size)
+/* grows memory mapped output file to fit at least size more bytes */
+static int file_map_grow(struct file_state *fs, size_t size)
 {
-	if (*ptr >= end)
-		*ptr = (int16_t *)((size_t)*ptr - size);
+	size_t map_size = MAX(fs->map_size * 2, fs->map_pos + size);
+	int fd = fileno(fs->wfh);
+	void *map;
+
+	map_size = MAX(map_size, FILE_MAP_GROW_SIZE);
+
+	if (ftruncate(fd, map_size) < 0)
+		return -errno;
+
+	map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED)
+		return -errno;
+
+	if (fs->map)
+		munmap(fs->map, fs->map_size);
+
+	fs->map = map;
+	fs->map_size = map_size;
+
+	return 0;
+}
+
+/* writes size bytes of data to output file */
+static int file_write_bytes(struct file_state *fs, const void *data,
+			    size_t size)
+{
+	if (!fs->map)
+		return fwrite(data, 1, size, fs->wfh) == size ? 0 : -EIO;
+
+	if (fs->map_pos + size > fs->map_size && file_map_grow(fs, size) < 0)
+		return -EIO;
+
+	if (memcpy_s((char *)fs->map + fs->map_pos,
+		     fs->map_size - fs->map_pos, data, size))
+		return -EIO;
+	fs->map_pos += size;
+
+	return 0;
 }
 
 /*
- * Read 32-bit samples from file
- * currently only supports txt files
+ * Makes sure at least one whole text sample is in the text buffer unless
+ * the end of file is reached. Mapped input is entirely in the buffer.
  */
-static int read_samples_32(struct comp_dev *dev,
-			   const struct audio_stream *sink,
-			   int n, int fmt, int nch)
+static void file_text_refill(struct file_state *fs)
 {
-	struct file_comp_data *cd = comp_get_drvdata(dev);
-	int32_t *dest = (int32_t *)sink->w_ptr;
+	size_t left = fs->text_len - fs->text_pos;
+
+	if (fs->map || left >= FILE_TEXT_SAMPLE_MAX * 2)
+		return;
+
+	memmove(fs->text_buf, fs->text_buf + fs->text_pos, left);
+	fs->text_len = left + fread(fs->text_buf + left, 1,
+				    FILE_TEXT_BUF_SIZE - left, fs->rfh);
+	fs->text_pos = 0;
+}
+
+/*
+ * Parses next decimal integer from text input, same as fscanf("%d") but
+ * without the locale and format string handling.
+ * Returns -ENODATA at end of file or when no number is found.
+ */
+static int file_text_parse(struct file_state *fs, int32_t *value)
+{
+	const char *p;
+	const char *end;
+	uint32_t v = 0;
+	bool negative = false;
+
+	/* skip white space, refilling buffer as needed */
+	for (;;) {
+		file_text_refill(fs);
+		p = fs->text_buf + fs->text_pos;
+		end = fs->text_buf + fs->text_len;
+		while (p < end && (*p == ' ' || (*p >= '\t' && *p <= '\r')))
+			p++;
+
+		fs->text_pos = p - fs->text_buf;
+		if (p < end)
+			break;
+
+		if (fs->map || !fs->text_len)
+			return -ENODATA;
+	}
+
+	file_text_refill(fs);
+	p = fs->text_buf + fs->text_pos;
+	end = fs->text_buf + fs->text_len;
+
+	if (*p == '-' || *p == '+')
+		negative = *p++ == '-';
+
+	if (p == end || *p < '0' || *p > '9')
+		return -ENODATA;
+
+	while (p < end && *p >= '0' && *p <= '9')
+		v = v * 10 + (*p++ - '0');
+
+	fs->text_pos = p - fs->text_buf;
+	*value = negative ? -v : v;
+
+	return 0;
+}
+
+/* formats value as decimal text line, returns pointer after the text */
+static char *file_text_format(char *p, int32_t value)
+{
+	char digits[FILE_TEXT_SAMPLE_MAX];
+	uint32_t v = value < 0 ? -(uint32_t)value : value;
+	int n = 0;
+
+	do {
+		digits[n++] = '0' + v % 10;
+		v /= 10;
+	} while (v);
+
+	if (value < 0)
+		*p++ = '-';
+
+	while (n)
+		*p++ = digits[--n];
+
+	*p++ = '\n';
+
+	return p;
+}
+
+/*
+ * Reads up to n samples into linear part of sink buffer
+ * returns the number of samples read
+ */
+static int read_span(struct file_state *fs, void *dest, int n, int fmt)
+{
+	int16_t *dest16 = dest;
+	int32_t *dest32 = dest;
 	int32_t sample;
-	int n_wrap;
-	int n_min;
 	int i;
-	int n_samples = 0;
-	int ret = 0;
 
-	while (n > 0) {
-		n_wrap = (int32_t *)sink->end_addr - dest;
-
-		/* check for buffer wrap and copy to the end of the buffer */
-		n_min = (n < n_wrap) ? n : n_wrap;
-		while (n_min > 0) {
-			n -= nch;
-			n_min -= nch;
-
-			/* copy sample per channel */
-			for (i = 0; i < nch; i++) {
-				/* read sample from file */
-				switch (cd->fs.f_format) {
-				/* text input file */
-				case FILE_TEXT:
-					if (fmt == SOF_IPC_FRAME_S32_LE)
-						ret = fscanf(cd->fs.rfh, "%d",
-							     dest);
-
-					/* mask bits if 24-bit samples */
-					if (fmt == SOF_IPC_FRAME_S24_4LE) {
-						ret = fscanf(cd->fs.rfh, "%d",
-							     &sample);
-						*dest = sample & 0x00ffffff;
-					}
-					/* quit if eof is reached */
-					if (ret == EOF) {
-						cd->fs.reached_eof = 1;
-						goto quit;
-					}
-					break;
-
-				/* raw input file */
-				default:
-					if (fmt == SOF_IPC_FRAME_S32_LE)
-						ret = fread(dest,
-							    sizeof(int32_t),
-							    1, cd->fs.rfh);
-
-					/* mask bits if 24-bit samples */
-					if (fmt == SOF_IPC_FRAME_S24_4LE) {
-						ret = fread(&sample,
-							    sizeof(int32_t),
-							    1, cd->fs.rfh);
-						*dest = sample & 0x00ffffff;
-					}
-					/* quit if eof is reached */
-					if (ret != 1) {
-						cd->fs.reached_eof = 1;
-						goto quit;
-					}
-					break;
-				}
-				dest++;
-				n_samples++;
-			}
+	switch (fs->f_format) {
+	/* text input file */
+	case FILE_TEXT:
+		for (i = 0; i < n; i++) {
+			if (file_text_parse(fs, &sample) < 0)
+				break;
+
+			if (fmt == SOF_IPC_FRAME_S16_LE)
+				dest16[i] = sample;
+			else
+				dest32[i] = sample;
 		}
-		/* check for buffer wrap and update pointer */
-		buffer_check_wrap_32(&dest, sink->end_addr,
-				     sink->size);
+		break;
+
+	/* raw input file */
+	default:
+		i = file_read_bytes(fs, dest, n * get_sample_bytes(fmt)) /
+			get_sample_bytes(fmt);
+		break;
 	}
-quit:
-	return n_samples;
+
+	/* mask bits if 24-bit samples */
+	if (fmt == SOF_IPC_FRAME_S24_4LE)
+		for (n = 0; n < i; n++)
+			dest32[n] &= 0x00ffffff;
+
+	return i;
 }
 
 /*
- * Read 16-bit samples from file
- * currently only supports txt files
+ * Writes n samples from linear part of source buffer
+ * returns the number of samples written
  */
-static int read_samples_16(struct comp_dev *dev,
-			   const struct audio_stream *sink,
-			   int n, int nch)
+static int write_span(struct file_state *fs, const void *src, int n, int fmt)
 {
-	struct file_comp_data *cd = comp_get_drvdata(dev);
-	int16_t *dest = (int16_t *)sink->w_ptr;
-	int i, n_wrap, n_min, ret;
-	int n_samples = 0;
+	const int16_t *src16 = src;
+	const int32_t *src32 = src;
+	int32_t samples[FILE_WRITE_CHUNK];
+	char text[FILE_WRITE_CHUNK * FILE_TEXT_SAMPLE_MAX];
+	char *p;
+	int chunk;
+	int i;
+	int j;
+
+	/* raw 16-bit and 32-bit samples go out as they are */
+	if (fs->f_format != FILE_TEXT && fmt != SOF_IPC_FRAME_S24_4LE)
+		return file_write_bytes(fs, src, n * get_sample_bytes(fmt)) ?
+			0 : n;
+
+	for (i = 0; i < n; i += chunk) {
+		chunk = MIN(n - i, FILE_WRITE_CHUNK);
+
+		/* convert to 32-bit, sign extend 24-bit samples */
+		for (j = 0; j < chunk; j++) {
+			if (fmt == SOF_IPC_FRAME_S16_LE)
+				samples[j] = src16[i + j];
+			else if (fmt == SOF_IPC_FRAME_S24_4LE)
+				samples[j] = sign_extend_s24(src32[i + j]);
+			else
+				samples[j] = src32[i + j];
+		}
 
-	/* copy samples */
-	while (n > 0) {
-		n_wrap = (int16_t *)sink->end_addr - dest;
-
-		/* check for buffer wrap and copy to the end of the buffer */
-		n_min = (n < n_wrap) ? n : n_wrap;
-		while (n_min > 0) {
-			n -= nch;
-			n_min -= nch;
-
-			/* copy sample per channel */
-			for (i = 0; i < nch; i++) {
-				switch (cd->fs.f_format) {
-				/* text input file */
-				case FILE_TEXT:
-					ret = fscanf(cd->fs.rfh, "%hd", dest);
-					if (ret == EOF) {
-						cd->fs.reached_eof = 1;
-						goto quit;
-					}
-					break;
-
-				/* rw pcm input file */
-				default:
-					ret = fread(dest, sizeof(int16_t), 1,
-						    cd->fs.rfh);
-					if (ret != 1) {
-						cd->fs.reached_eof = 1;
-						goto quit;
-					}
-					break;
-				}
-
-				dest++;
-				n_samples++;
-			}
+		switch (fs->f_format) {
+		/* text output file */
+		case FILE_TEXT:
+			p = text;
+			for (j = 0; j < chunk; j++)
+				p = file_text_format(p, samples[j]);
+
+			if (file_write_bytes(fs, text, p - text) < 0)
+				return i;
+			break;
+
+		/* raw pcm output file */
+		default:
+			if (file_write_bytes(fs, samples,
+					     chunk * sizeof(int32_t)) < 0)
+				return i;
+			break;
 		}
-		/* check for buffer wrap and update pointer */
-		buffer_check_wrap_16(&dest, sink->end_addr,
-				     sink->size);
 	}
 
-quit:
-	return n_samples;
+	return n;
 }
 
 /*
- * Write 16-bit samples from file
- * currently only supports txt files
+ * Read samples from file into sink buffer, in spans without buffer wrap
+ * sets reached_eof if less than n samples were available
  */
-static int write_samples_16(struct comp_dev *dev, struct audio_stream *source,
-			    int n, int nch)
+static int read_samples(struct comp_dev *dev,
+			const struct audio_stream *sink, int n, int fmt)
 {
 	struct file_comp_data *cd = comp_get_drvdata(dev);
-	int16_t *src = (int16_t *)source->r_ptr;
-	int i, n_wrap, n_min, ret;
+	int sample_bytes = get_sample_bytes(fmt);
+	void *dest = sink->w_ptr;
 	int n_samples = 0;
+	int n_wrap;
+	int ret;
 
-	/* copy samples */
 	while (n > 0) {
-		n_wrap = (int16_t *)source->end_addr - src;
-
-		/* check for buffer wrap and copy to the end of the buffer */
-		n_min = (n < n_wrap) ? n : n_wrap;
-		while (n_min > 0) {
-			n -= nch;
-			n_min -= nch;
-
-			/* copy sample per channel */
-			for (i = 0; i < nch; i++) {
-				switch (cd->fs.f_format) {
-				/* text output file */
-				case FILE_TEXT:
-					ret = fprintf(cd->fs.wfh,
-						      "%d\n", *src);
-					if (ret < 0)
-						goto quit;
-					break;
-
-				/* raw pcm output file */
-				default:
-					ret = fwrite(src,
-						     sizeof(int16_t),
-						     1, cd->fs.wfh);
-					if (ret != 1)
-						goto quit;
-					break;
-				}
-
-				src++;
-				n_samples++;
-			}
+		n_wrap = audio_stream_bytes_without_wrap(sink, dest) /
+			sample_bytes;
+		n_wrap = MIN(n, n_wrap);
+
+		ret = read_span(&cd->fs, dest, n_wrap, fmt);
+		n_samples += ret;
+		if (ret < n_wrap) {
+			cd->fs.reached_eof = 1;
+			break;
 		}
-		/* check for buffer wrap and update pointer */
-		buffer_check_wrap_16(&src, source->end_addr,
-				     source->size);
+
+		n -= n_wrap;
+		dest = audio_stream_wrap(sink, (char *)dest +
+					 n_wrap * sample_bytes);
 	}
-quit:
+
 	return n_samples;
 }
 
 /*
- * Write 32-bit samples from file
- * currently only supports txt files
+ * Write samples from source buffer into file, in spans without buffer wrap
  */
-static int write_samples_32(struct comp_dev *dev, struct audio_stream *source,
-			    int n, int fmt, int nch)
+static int write_samples(struct comp_dev *dev, struct audio_stream *source,
+			 int n, int fmt)
 {
 	struct file_comp_data *cd = comp_get_drvdata(dev);
-	int32_t *src = (int32_t *)source->r_ptr;
-	int i, n_wrap, n_min, ret;
+	int sample_bytes = get_sample_bytes(fmt);
+	void *src = source->r_ptr;
 	int n_samples = 0;
-	int32_t sample;
+	int n_wrap;
+	int ret;
 
-	/* copy samples */
 	while (n > 0) {
-		n_wrap = (int32_t *)source->end_addr - src;
-
-		/* check for buffer wrap and copy to the end of the buffer */
-		n_min = (n < n_wrap) ? n : n_wrap;
-		while (n_min > 0) {
-			n -= nch;
-			n_min -= nch;
-
-			/* copy sample per channel */
-			for (i = 0; i < nch; i++) {
-				switch (cd->fs.f_format) {
-				/* text output file */
-				case FILE_TEXT:
-					if (fmt == SOF_IPC_FRAME_S32_LE)
-						ret = fprintf(cd->fs.wfh,
-							      "%d\n", *src);
-					if (fmt == SOF_IPC_FRAME_S24_4LE) {
-						sample = *src << 8;
-						ret = fprintf(cd->fs.wfh,
-							      "%d\n",
-							      sample >> 8);
-					}
-					if (ret < 0)
-						goto quit;
-					break;
-
-				/* raw pcm output file */
-				default:
-					if (fmt == SOF_IPC_FRAME_S32_LE)
-						ret = fwrite(src,
-							     sizeof(int32_t),
-							     1, cd->fs.wfh);
-					if (fmt == SOF_IPC_FRAME_S24_4LE) {
-						sample = *src << 8;
-						sample >>= 8;
-						ret = fwrite(&sample,
-							     sizeof(int32_t),
-							     1, cd->fs.wfh);
-					}
-					if (ret != 1)
-						goto quit;
-					break;
-				}
-
-				/* increment read pointer */
-				src++;
-
-				/* increment number of samples written */
-				n_samples++;
-			}
-		}
-		/* check for buffer wrap and update pointer */
-		buffer_check_wrap_32(&src, source->end_addr,
-				     source->size);
+		n_wrap = audio_stream_bytes_without_wrap(source, src) /
+			sample_bytes;
+		n_wrap = MIN(n, n_wrap);
+
+		ret = write_span(&cd->fs, src, n_wrap, fmt);
+		n_samples += ret;
+		if (ret < n_wrap)
+			break;
+
+		n -= n_wrap;
+		src = audio_stream_wrap(source, (char *)src +
+					n_wrap * sample_bytes);
 	}
-quit:
+
 	return n_samples;
 }
 
-/* function for processing 32-bit samples */
-static int file_s32_default(struct comp_dev *dev, struct audio_stream *sink,
-			    struct audio_stream *source, uint32_t frames)
+/* function for processing samples of the given format */
+static int file_process(struct comp_dev *dev, struct audio_stream *sink,
+			struct audio_stream *source, uint32_t frames, int fmt)
 {
 	struct file_comp_data *cd = comp_get_drvdata(dev);
-	int nch;
 	int n_samples = 0;
 
 	switch (cd->fs.mode) {
 	case FILE_READ:
 		/* read samples */
-		nch = sink->channels;
-		n_samples = read_samples_32(dev, sink, frames * nch,
-					    SOF_IPC_FRAME_S32_LE, nch);
+		n_samples = read_samples(dev, sink, frames * sink->channels,
+					 fmt);
 		break;
 	case FILE_WRITE:
 		/* write samples */
-		nch = source->channels;
-		n_samples = write_samples_32(dev, source, frames * nch,
-					     SOF_IPC_FRAME_S32_LE, nch);
+		n_samples = write_samples(dev, source,
+					  frames * source->channels, fmt);
 		break;
 	default:
 		/* TODO: duplex mode */
@@ -343,62 +377,97 @@ static int file_s32_default(struct comp_dev *dev, struct audio_stream *sink,
 	return n_samples;
 }
 
+/* function for processing 32-bit samples */
+static int file_s32_default(struct comp_dev *dev, struct audio_stream *sink,
+			    struct audio_stream *source, uint32_t frames)
+{
+	return file_process(dev, sink, source, frames, SOF_IPC_FRAME_S32_LE);
+}
+
 /* function for processing 16-bit samples */
 static int file_s16(struct comp_dev *dev, struct audio_stream *sink,
 		    struct audio_stream *source, uint32_t frames)
 {
-	struct file_comp_data *cd = comp_get_drvdata(dev);
-	int nch;
-	int n_samples = 0;
-
-	switch (cd->fs.mode) {
-	case FILE_READ:
-		/* read samples */
-		nch = sink->channels;
-		n_samples = read_samples_16(dev, sink, frames * nch, nch);
-		break;
-	case FILE_WRITE:
-		/* write samples */
-		nch = source->channels;
-		n_samples = write_samples_16(dev, source, frames * nch, nch);
-		break;
-	default:
-		/* TODO: duplex mode */
-		break;
-	}
-
-	cd->fs.n += n_samples;
-	return n_samples;
+	return file_process(dev, sink, source, frames, SOF_IPC_FRAME_S16_LE);
 }
 
 /* function for processing 24-bit samples */
 static int file_s24(struct comp_dev *dev, struct audio_stream *sink,
 		    struct audio_stream *source, uint32_t frames)
 {
-	struct file_comp_data *cd = comp_get_drvdata(dev);
-	int nch;
-	int n_samples = 0;
+	return file_process(dev, sink, source, frames, SOF_IPC_FRAME_S24_4LE);
+}
 
-	switch (cd->fs.mode) {
-	case FILE_READ:
-		/* read samples */
-		nch = sink->channels;
-		n_samples = read_samples_32(dev, sink, frames * nch,
-					    SOF_IPC_FRAME_S24_4LE, nch);
-		break;
-	case FILE_WRITE:
-		/* write samples */
-		nch = source->channels;
-		n_samples = write_samples_32(dev, source, frames * nch,
-					     SOF_IPC_FRAME_S24_4LE, nch);
-		break;
-	default:
-		/* TODO: duplex mode */
-		break;
+/*
+ * Sets up data access of opened file: maps the whole input file or the
+ * output file growing on demand if requested, allocates text parser buffer
+ * for stdio text input.
+ */
+static int file_open_data(struct file_state *fs, bool use_mmap)
+{
+	struct stat st;
+
+	if (fs->mode == FILE_WRITE) {
+		if (use_mmap)
+			return file_map_grow(fs, 0);
+
+		return 0;
 	}
 
-	cd->fs.n += n_samples;
-	return n_samples;
+	if (fs->mode != FILE_READ)
+		return 0;
+
+	if (use_mmap) {
+		if (fstat(fileno(fs->rfh), &st) < 0)
+			return -errno;
+
+		/* nothing to map in empty file, it is at eof already */
+		if (st.st_size) {
+			fs->map = mmap(NULL, st.st_size, PROT_READ,
+				       MAP_PRIVATE, fileno(fs->rfh), 0);
+			if (fs->map == MAP_FAILED) {
+				fs->map = NULL;
+				return -errno;
+			}
+
+			fs->map_size = st.st_size;
+			madvise(fs->map, fs->map_size, MADV_SEQUENTIAL);
+		}
+	}
+
+	if (fs->f_format != FILE_TEXT)
+		return 0;
+
+	if (fs->map) {
+		/* parse the mapping directly */
+		fs->text_buf = fs->map;
+		fs->text_len = fs->map_size;
+		return 0;
+	}
+
+	fs->text_buf = malloc(FILE_TEXT_BUF_SIZE);
+	if (!fs->text_buf)
+		return -ENOMEM;
+
+	return 0;
+}
+
+/* releases file data access, truncates mapped output to written size */
+static void file_close_data(struct file_state *fs)
+{
+	if (fs->map) {
+		munmap(fs->map, fs->map_size);
+		if (fs->mode == FILE_WRITE &&
+		    ftruncate(fileno(fs->wfh), fs->map_pos) < 0)
+			fprintf(stderr, "error: truncating file %s\n", fs->fn);
+	} else if (fs->mode == FILE_READ) {
+		free(fs->text_buf);
+	}
+
+	if (fs->rfh)
+		fclose(fs->rfh);
+	if (fs->wfh)
+		fclose(fs->wfh);
 }
 
 static enum file_format get_file_format(char *filename)
@@ -472,7 +541,8 @@ static struct comp_dev *file_new(const struct comp_driver *drv,
 		}
 		break;
 	case FILE_WRITE:
-		cd->fs.wfh = fopen(cd->fs.fn, "w");
+		/* mapping for write needs read access to the file as well */
+		cd->fs.wfh = fopen(cd->fs.fn, ipc_file->use_mmap ? "w+" : "w");
 		if (!cd->fs.wfh) {
 			fprintf(stderr, "error: opening file %s\n", cd->fs.fn);
 			free(cd);
@@ -485,6 +555,14 @@ static struct comp_dev *file_new(const struct comp_driver *drv,
 		break;
 	}
 
+	if (file_open_data(&cd->fs, ipc_file->use_mmap) < 0) {
+		fprintf(stderr, "error: mapping file %s\n", cd->fs.fn);
+		file_close_data(&cd->fs);
+		free(cd);
+		free(dev);
+		return NULL;
+	}
+
 	cd->fs.reached_eof = 0;
 	cd->fs.n = 0;
 
@@ -499,10 +577,7 @@ static void file_free(struct comp_dev *dev)
 
 	comp_dbg(dev, "file_free()");
 
-	if (cd->fs.mode == FILE_READ)
-		fclose(cd->fs.rfh);
-	else
-		fclose(cd->fs.wfh);
+	file_close_data(&cd->fs);
 
 	free(cd->fs.fn);
 	free(cd);
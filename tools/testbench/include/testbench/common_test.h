@@ -45,6 +45,10 @@ struct testbench_prm {
 	int sched_id;
 	int max_pipeline_id;
 	enum sof_ipc_frame frame_fmt;
+	bool use_mmap; /* memory map input and output files */
+	bool threads; /* run pipelines on worker threads */
+	char *profile_file; /* component profile json file */
+	bool profile; /* profile component copies */
 };
 
 struct shared_lib_table {
@@ -83,6 +87,10 @@ int get_index_by_type(uint32_t comp_type,
 int get_index_by_uuid(struct sof_ipc_comp_ext *comp_ext,
 		      struct shared_lib_table *lib_table);
 
+void tb_profile_enable(void);
+
+int tb_profile_report(struct ipc *ipc, const char *json_file);
+
 int parse_topology(struct sof *sof, struct shared_lib_table *library_table,
 		   struct testbench_prm *tp, char *pipeline_msg);
 #endif
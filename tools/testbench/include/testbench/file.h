@@ -31,6 +31,12 @@ struct file_state {
 	int n;
 	enum file_mode mode;
 	enum file_format f_format;
+	void *map; /* mapped file data, NULL if using stdio */
+	size_t map_size;
+	size_t map_pos; /* read/write position in mapped data */
+	char *text_buf; /* text input parser buffer */
+	size_t text_len;
+	size_t text_pos;
 };
 
 /* file comp data */
@@ -56,5 +62,6 @@ struct sof_ipc_comp_file {
 	char *fn;
 	enum file_mode mode;
 	enum sof_ipc_frame frame_fmt;
+	bool use_mmap; /* access file data through memory mapping */
 } __attribute__((packed));
 #endif
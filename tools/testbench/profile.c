@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Copyright(c) 2020 Intel Corporation. All rights reserved.
+
+/* per component copy profile report of testbench run */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sof/audio/comp_profile.h>
+#include <sof/audio/component.h>
+#include <sof/drivers/ipc.h>
+#include <sof/list.h>
+#include "testbench/common_test.h"
+
+/* reported copy time percentiles */
+static const uint32_t tb_profile_pct[] = { 50, 95, 99 };
+
+static const char *tb_profile_comp_name(struct comp_dev *dev)
+{
+	switch (dev_comp_type(dev)) {
+	case SOF_COMP_HOST:
+	case SOF_COMP_DAI:
+	case SOF_COMP_FILEREAD:
+	case SOF_COMP_FILEWRITE:
+		return "file";
+	case SOF_COMP_VOLUME:
+		return "volume";
+	case SOF_COMP_SRC:
+		return "src";
+	case SOF_COMP_ASRC:
+		return "asrc";
+	case SOF_COMP_EQ_FIR:
+		return "eq-fir";
+	case SOF_COMP_EQ_IIR:
+		return "eq-iir";
+	case SOF_COMP_DCBLOCK:
+		return "dcblock";
+	case SOF_COMP_MIXER:
+		return "mixer";
+	case SOF_COMP_MUX:
+		return "mux";
+	case SOF_COMP_DEMUX:
+		return "demux";
+	case SOF_COMP_KPB:
+		return "kpb";
+	case SOF_COMP_SELECTOR:
+		return "selector";
+	default:
+		/* process components, e.g. crossover and tdfb */
+		return "process";
+	}
+}
+
+void tb_profile_enable(void)
+{
+	comp_profile_enabled = true;
+}
+
+static void tb_profile_print(struct comp_dev *dev)
+{
+	struct comp_profile *prof = &dev->profile;
+	int i;
+
+	printf("%4u %-10s %8" PRIu64 " %10" PRIu64 " %9.2f %9.2f",
+	       dev_comp_id(dev), tb_profile_comp_name(dev), prof->count,
+	       prof->frames, prof->time_min / 1e3,
+	       prof->time_sum / 1e3 / prof->count);
+	for (i = 0; i < ARRAY_SIZE(tb_profile_pct); i++)
+		printf(" %9.2f", comp_profile_percentile(prof,
+							 tb_profile_pct[i]) / 1e3);
+	printf(" %9.2f %9.2f\n", prof->time_max / 1e3,
+	       comp_profile_mcps(prof));
+}
+
+static void tb_profile_json(FILE *out, struct comp_dev *dev, bool first)
+{
+	struct comp_profile *prof = &dev->profile;
+	int i;
+
+	fprintf(out, "%s\n\t\t{\"id\": %u, \"name\": \"%s\", \"pipeline\": %u,",
+		first ? "" : ",", dev_comp_id(dev), tb_profile_comp_name(dev),
+		dev_comp_pipe_id(dev));
+	fprintf(out, " \"copies\": %" PRIu64 ", \"frames\": %" PRIu64 ",",
+		prof->count, prof->frames);
+	fprintf(out, " \"rate\": %u,\n\t\t \"time_ns\": {\"min\": %" PRIu64,
+		prof->rate, prof->time_min);
+	fprintf(out, ", \"avg\": %" PRIu64, prof->time_sum / prof->count);
+	for (i = 0; i < ARRAY_SIZE(tb_profile_pct); i++)
+		fprintf(out, ", \"p%u\": %" PRIu64, tb_profile_pct[i],
+			comp_profile_percentile(prof, tb_profile_pct[i]));
+	fprintf(out, ", \"max\": %" PRIu64 "},\n\t\t \"mcps\": %.3f}",
+		prof->time_max, comp_profile_mcps(prof));
+}
+
+/*
+ * Print profile of all components that copied data as table and write
+ * it to json_file if not NULL.
+ */
+int tb_profile_report(struct ipc *ipc, const char *json_file)
+{
+	struct list_item *clist;
+	struct ipc_comp_dev *icd;
+	FILE *out = NULL;
+	bool first = true;
+
+	if (json_file) {
+		out = fopen(json_file, "w");
+		if (!out) {
+			fprintf(stderr, "error: opening file %s\n", json_file);
+			return -errno;
+		}
+		fprintf(out, "{\n\t\"components\": [");
+	}
+
+	printf("==========================================================\n");
+	printf("		       Component Profile\n");
+	printf("==========================================================\n");
+	printf("  id name         copies     frames    min us    avg us");
+	printf("    p50 us    p95 us    p99 us    max us      MCPS\n");
+
+	list_for_item(clist, &ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type != COMP_TYPE_COMPONENT || !icd->cd->profile.count)
+			continue;
+
+		tb_profile_print(icd->cd);
+		if (out)
+			tb_profile_json(out, icd->cd, first);
+		first = false;
+	}
+
+	if (out) {
+		fprintf(out, "\n\t]\n}\n");
+		fclose(out);
+	}
+
+	return 0;
+}
@@ -8,6 +8,7 @@
 //         Ranjani Sridharan <ranjani.sridharan@linux.intel.com>
 
 #include <sof/audio/component.h>
+#include <sof/schedule/edf_schedule.h>
 #include <sof/schedule/task.h>
 #include <stdint.h>
 #include <sof/lib/wait.h>
@@ -25,9 +26,19 @@ int schedule_task_init(struct task *task,
 		       uint16_t priority, enum task_state (*run)(void *data),
 		       void *data, uint16_t core, uint32_t flags)
 {
+	struct edf_task_pdata *edf_pdata;
+
 	if (type >= SOF_SCHEDULE_COUNT)
 		return -EINVAL;
 
+	/* every task runs on EDF scheduler, which keeps it in its heap */
+	edf_pdata = calloc(1, sizeof(*edf_pdata));
+	if (!edf_pdata)
+		return -ENOMEM;
+
+	edf_pdata->task = task;
+	edf_sch_set_pdata(task, edf_pdata);
+
 	task->uid = uid;
 	task->type = SOF_SCHEDULE_EDF; /* Note: Force EDF scheduler */
 	task->priority = priority;
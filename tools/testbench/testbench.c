@@ -9,6 +9,7 @@
 #include <sof/list.h>
 #include <getopt.h>
 #include <dlfcn.h>
+#include <pthread.h>
 #include "testbench/common_test.h"
 #include <tplg_parser/topology.h>
 #include "testbench/trace.h"
@@ -32,6 +33,27 @@ DECLARE_SOF_TB_UUID("tdfb", tdfb_uuid,  0xdd511749, 0xd9fa, 0x455c,
 
 #define TESTBENCH_NCH 2 /* Stereo */
 
+/* max number of pipelines run on own worker threads */
+#define TESTBENCH_MAX_WORKERS	16
+
+struct tb_threads;
+
+/* worker thread running one pipeline */
+struct tb_worker {
+	pthread_t thread;
+	struct pipeline *p;
+	struct tb_threads *threads;
+};
+
+/* worker threads synchronized once per period */
+struct tb_threads {
+	struct tb_worker worker[TESTBENCH_MAX_WORKERS];
+	int count;
+	bool stop;
+	pthread_barrier_t start; /* period start, main thread and workers */
+	pthread_barrier_t done; /* period done, main thread and workers */
+};
+
 /* shared library look up table */
 struct shared_lib_table lib_table[NUM_WIDGETS_SUPPORTED] = {
 	{"file", "", SOF_COMP_HOST, NULL, 0, NULL}, /* File must be first */
@@ -139,8 +161,12 @@ static void print_usage(char *executable)
 	printf("Usage: %s -i <input_file> ", executable);
 	printf("-o <output_file1,output_file2,...> ");
 	printf("-t <tplg_file> -b <input_format> -c <channels>");
-	printf("-a <comp1=comp1_library,comp2=comp2_library>\n");
+	printf("-a <comp1=comp1_library,comp2=comp2_library> [-m] [-T]");
+	printf(" [-p[json_file]]\n");
 	printf("input_format should be S16_LE, S32_LE, S24_LE or FLOAT_LE\n");
+	printf("-m memory maps input and output files\n");
+	printf("-T runs each pipeline on own thread, synchronized per period\n");
+	printf("-p prints component copy profile, -pfile.json also saves it\n");
 	printf("Example Usage:\n");
 	printf("%s -i in.txt -o out.txt -t test.tplg ", executable);
 	printf("-r 48000 -R 96000 -c 2");
@@ -159,18 +185,18 @@ static void free_comps(void)
 		switch (icd->type) {
 		case COMP_TYPE_COMPONENT:
 			comp_free(icd->cd);
-			list_item_del(&icd->list);
+			ipc_comp_dev_del(icd);
 			rfree(icd);
 			break;
 		case COMP_TYPE_BUFFER:
 			rfree(icd->cb->stream.addr);
 			rfree(icd->cb);
-			list_item_del(&icd->list);
+			ipc_comp_dev_del(icd);
 			rfree(icd);
 			break;
 		default:
 			rfree(icd->pipeline);
-			list_item_del(&icd->list);
+			ipc_comp_dev_del(icd);
 			rfree(icd);
 			break;
 		}
@@ -182,7 +208,7 @@ static void parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 	int option = 0;
 	int ret = 0;
 
-	while ((option = getopt(argc, argv, "hdi:o:t:b:a:r:R:c:")) != -1) {
+	while ((option = getopt(argc, argv, "hdmTi:o:t:b:a:r:R:c:p::")) != -1) {
 		switch (option) {
 		/* input sample file */
 		case 'i':
@@ -230,6 +256,23 @@ static void parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 			debug = 1;
 			break;
 
+		/* memory map input and output files */
+		case 'm':
+			tp->use_mmap = true;
+			break;
+
+		/* run pipelines on worker threads */
+		case 'T':
+			tp->threads = true;
+			break;
+
+		/* profile component copies, optionally save it as json */
+		case 'p':
+			tp->profile = true;
+			if (optarg)
+				tp->profile_file = strdup(optarg);
+			break;
+
 		/* print usage */
 		case 'h':
 		default:
@@ -242,17 +285,161 @@ static void parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 	}
 }
 
+/* run pipelines scheduled together with p serially until input EOF */
+static void tb_run_serial(struct testbench_prm *tp, struct pipeline *p,
+			  struct file_comp_data *frcd)
+{
+	struct ipc_comp_dev *pcm_dev;
+	struct pipeline *curr_p;
+	int i;
+
+	while (frcd->fs.reached_eof == 0) {
+		/*
+		 * Schedule copy for all pipelines which have the same schedule
+		 * component as the working one.
+		 *
+		 * In common convention pipelines are added with monotonic
+		 * increasing IDs started from 1, we could take care of it in
+		 * test topologies so this for-loop will walk all pipelines.
+		 */
+		for (i = 1; i <= tp->max_pipeline_id; i++) {
+			pcm_dev = ipc_get_comp_by_ppl_id(sof.ipc,
+							 COMP_TYPE_PIPELINE, i);
+			if (pcm_dev) {
+				curr_p = pcm_dev->pipeline;
+				if (pipeline_is_same_sched_comp(p, curr_p))
+					pipeline_schedule_copy(curr_p, 0);
+			}
+		}
+	}
+}
+
+static void *tb_worker_run(void *arg)
+{
+	struct tb_worker *worker = arg;
+	struct tb_threads *tt = worker->threads;
+
+	for (;;) {
+		pthread_barrier_wait(&tt->start);
+		if (tt->stop)
+			break;
+
+		pipeline_schedule_copy(worker->p, 0);
+
+		pthread_barrier_wait(&tt->done);
+	}
+
+	return NULL;
+}
+
+/*
+ * Buffers connecting two pipelines are accessed from two worker threads,
+ * so treat them the same way as buffers connecting two cores.
+ */
+static void tb_lock_shared_buffers(void)
+{
+	struct list_item *clist;
+	struct ipc_comp_dev *icd;
+	struct comp_buffer *buffer;
+
+	list_for_item(clist, &sof.ipc->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type != COMP_TYPE_BUFFER)
+			continue;
+
+		buffer = icd->cb;
+		if (buffer->source && buffer->sink &&
+		    buffer->source->pipeline != buffer->sink->pipeline)
+			buffer->inter_core = true;
+	}
+}
+
+/*
+ * Run each pipeline scheduled together with p on own worker thread
+ * until input EOF. All workers copy one period and wait for each other
+ * before the next one, the same as pipelines on different DSP cores.
+ */
+static int tb_run_threaded(struct testbench_prm *tp, struct pipeline *p,
+			   struct file_comp_data *frcd)
+{
+	struct tb_threads tt = { .count = 0, .stop = false };
+	struct ipc_comp_dev *pcm_dev;
+	struct pipeline *curr_p;
+	int ret;
+	int i;
+
+	for (i = 1; i <= tp->max_pipeline_id; i++) {
+		pcm_dev = ipc_get_comp_by_ppl_id(sof.ipc, COMP_TYPE_PIPELINE,
+						 i);
+		if (!pcm_dev)
+			continue;
+
+		curr_p = pcm_dev->pipeline;
+		if (!pipeline_is_same_sched_comp(p, curr_p))
+			continue;
+
+		if (tt.count == TESTBENCH_MAX_WORKERS) {
+			fprintf(stderr, "error: max worker number is %d\n",
+				TESTBENCH_MAX_WORKERS);
+			return -EINVAL;
+		}
+
+		tt.worker[tt.count].p = curr_p;
+		tt.worker[tt.count].threads = &tt;
+		tt.count++;
+	}
+
+	tb_lock_shared_buffers();
+
+	pthread_barrier_init(&tt.start, NULL, tt.count + 1);
+	pthread_barrier_init(&tt.done, NULL, tt.count + 1);
+
+	for (i = 0; i < tt.count; i++) {
+		ret = pthread_create(&tt.worker[i].thread, NULL,
+				     tb_worker_run, &tt.worker[i]);
+		if (ret) {
+			fprintf(stderr, "error: worker thread create %d\n",
+				ret);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	while (frcd->fs.reached_eof == 0) {
+		pthread_barrier_wait(&tt.start);
+		pthread_barrier_wait(&tt.done);
+	}
+
+	/*
+	 * Data crosses from a pipeline to the next one in the following
+	 * period, let the downstream pipelines process the last input.
+	 */
+	for (i = 1; i < tt.count; i++) {
+		pthread_barrier_wait(&tt.start);
+		pthread_barrier_wait(&tt.done);
+	}
+
+	tt.stop = true;
+	pthread_barrier_wait(&tt.start);
+
+	for (i = 0; i < tt.count; i++)
+		pthread_join(tt.worker[i].thread, NULL);
+
+	pthread_barrier_destroy(&tt.start);
+	pthread_barrier_destroy(&tt.done);
+
+	return 0;
+}
+
 int main(int argc, char **argv)
 {
 	struct testbench_prm tp;
 	struct ipc_comp_dev *pcm_dev;
 	struct pipeline *p;
-	struct pipeline *curr_p;
 	struct sof_ipc_pipe_new *ipc_pipe;
 	struct comp_dev *cd;
 	struct file_comp_data *frcd, *fwcd;
 	char pipeline[DEBUG_MSG_LEN];
-	clock_t tic, toc;
+	struct timespec tic, toc;
 	double c_realtime, t_exec;
 	int n_in, n_out, ret;
 	int i;
@@ -268,6 +455,10 @@ int main(int argc, char **argv)
 	tp.output_file_num = 0;
 	tp.channels = TESTBENCH_NCH;
 	tp.max_pipeline_id = 0;
+	tp.use_mmap = false;
+	tp.threads = false;
+	tp.profile = false;
+	tp.profile_file = NULL;
 
 	/* command line arguments*/
 	parse_input_args(argc, argv, &tp);
@@ -327,33 +518,22 @@ int main(int argc, char **argv)
 
 	cd = pcm_dev->cd;
 	tb_enable_trace(false); /* reduce trace output */
-	tic = clock();
+	if (tp.profile)
+		tb_profile_enable();
+	clock_gettime(CLOCK_MONOTONIC, &tic);
 
-	while (frcd->fs.reached_eof == 0) {
-		/*
-		 * Schedule copy for all pipelines which have the same schedule
-		 * component as the working one.
-		 *
-		 * In common convention pipelines are added with monotonic
-		 * increasing IDs started from 1, we could take care of it in
-		 * test topologies so this for-loop will walk all pipelines.
-		 */
-		for (i = 1; i <= tp.max_pipeline_id; i++) {
-			pcm_dev = ipc_get_comp_by_ppl_id(sof.ipc,
-							 COMP_TYPE_PIPELINE, i);
-			if (pcm_dev) {
-				curr_p = pcm_dev->pipeline;
-				if (pipeline_is_same_sched_comp(p, curr_p))
-					pipeline_schedule_copy(curr_p, 0);
-			}
-		}
+	if (tp.threads) {
+		if (tb_run_threaded(&tp, p, frcd) < 0)
+			exit(EXIT_FAILURE);
+	} else {
+		tb_run_serial(&tp, p, frcd);
 	}
 
 	if (!frcd->fs.reached_eof)
 		printf("warning: possible pipeline xrun\n");
 
 	/* reset and free pipeline */
-	toc = clock();
+	clock_gettime(CLOCK_MONOTONIC, &toc);
 	tb_enable_trace(true);
 	pipeline_trigger(p, cd, COMP_TRIGGER_STOP);
 	ret = pipeline_reset(p, cd);
@@ -364,9 +544,15 @@ int main(int argc, char **argv)
 
 	n_in = frcd->fs.n;
 	n_out = fwcd->fs.n;
-	t_exec = (double)(toc - tic) / CLOCKS_PER_SEC;
+	/* wall clock time, worker threads run in parallel */
+	t_exec = (double)(toc.tv_sec - tic.tv_sec) +
+		(double)(toc.tv_nsec - tic.tv_nsec) / 1e9;
 	c_realtime = (double)n_out / tp.channels / tp.fs_out / t_exec;
 
+	/* profile needs the components, report it before freeing */
+	if (tp.profile && tb_profile_report(sof.ipc, tp.profile_file) < 0)
+		fprintf(stderr, "error: profile report\n");
+
 	/* free all components/buffers in pipeline */
 	free_comps();
 
@@ -392,6 +578,7 @@ int main(int argc, char **argv)
 	free(tp.bits_in);
 	free(tp.input_file);
 	free(tp.tplg_file);
+	free(tp.profile_file);
 	for (i = 0; i < tp.output_file_num; i++)
 		free(tp.output_file[i]);
 
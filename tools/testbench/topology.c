@@ -314,6 +314,7 @@ static int load_fileread(void *dev, int comp_id, int pipeline_id,
 	fileread.rate = tp->fs_in;
 	fileread.channels = tp->channels;
 	fileread.frame_fmt = tp->frame_fmt;
+	fileread.use_mmap = tp->use_mmap;
 
 	/* Set type depending on direction */
 	fileread.comp.type = (dir == SOF_IPC_STREAM_PLAYBACK) ?
@@ -363,6 +364,7 @@ static int load_filewrite(struct sof *sof, int comp_id, int pipeline_id,
 	filewrite.rate = tp->fs_out;
 	filewrite.channels = tp->channels;
 	filewrite.frame_fmt = tp->frame_fmt;
+	filewrite.use_mmap = tp->use_mmap;
 
 	/* Set type depending on direction */
 	filewrite.comp.type = (dir == SOF_IPC_STREAM_PLAYBACK) ?
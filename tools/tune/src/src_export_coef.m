@@ -61,11 +61,11 @@ else
                         end
                         fprintf(fh,'\n\n};');
                 case 'int32'
-			print_int_coef(src, fh, vtype, vfn, 32);
+			sym = print_int_coef(src, fh, vtype, vfn, 32);
                 case 'int24'
-			print_int_coef(src, fh, vtype, vfn, 24);
+			sym = print_int_coef(src, fh, vtype, vfn, 24);
                 case 'int16'
-			print_int_coef(src, fh, vtype, vfn, 16);
+			sym = print_int_coef(src, fh, vtype, vfn, 16);
                 otherwise
                         error('Unknown type %s !!!', ctype);
         end
@@ -81,11 +81,11 @@ else
                                 src.gain, vfn);
                 case { 'int16' 'int24' 'int32' }
                         fprintf(fh, 'struct src_stage %s = {\n', sfn);
-			fprintf(fh, '\t%d, %d, %d, %d, %d, %d, %d, %d, %d,\n\t%s};\n', ...
+			fprintf(fh, '\t%d, %d, %d, %d, %d, %d, %d, %d, %d,\n\t%s, %d};\n', ...
                                 src.idm, src.odm, src.num_of_subfilters, ...
                                 src.subfilter_length, src.filter_length, ...
                                 src.blk_in, src.blk_out, src.halfband, ...
-                                src.shift, vfn);
+                                src.shift, vfn, sym);
                 otherwise
                         error('Unknown type %s !!!', ctype);
         end
@@ -96,13 +96,23 @@ end
 
 end
 
-function print_int_coef(src, fh, vtype, vfn, nbits)
+function sym = print_int_coef(src, fh, vtype, vfn, nbits)
+        cint = coef_quant(src, nbits);
+
+        % Symmetric filters are stored as the first half only, the firmware
+        % mirrors the rest when the conversion is used.
+        sym = isequal(cint(:), flipud(cint(:)));
+        if sym
+                len = ceil(src.filter_length / 2);
+        else
+                len = src.filter_length;
+        end
+
         fprintf(fh, 'const %s %s[%d] = {\n', ...
-                vtype, vfn, src.filter_length);
+                vtype, vfn, len);
 
-        cint = coef_quant(src, nbits);
         fprintf(fh,'\t%d', cint(1));
-        for n=2:src.filter_length
+        for n=2:len
                 fprintf(fh, ',\n');
                 fprintf(fh,'\t%d', cint(n));
         end